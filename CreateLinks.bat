@@ -18,6 +18,9 @@ mklink /J "%ENGINE_SOURCE_LOCATION%\Engine\Source\ThirdParty\Klawr" "%BATCH_FILE
 echo Creating Engine\Plugins\Klawr Junction...
 mklink /J "%ENGINE_SOURCE_LOCATION%\Engine\Plugins\Klawr" "%BATCH_FILE_LOCATION%\Engine\Plugins\Klawr"
 
+echo Creating Engine\Source\Programs\KlawrCodeGeneratorTest Junction...
+mklink /J "%ENGINE_SOURCE_LOCATION%\Engine\Source\Programs\KlawrCodeGeneratorTest" "%BATCH_FILE_LOCATION%\Engine\Source\Programs\KlawrCodeGeneratorTest"
+
 echo Done!
 pause
 
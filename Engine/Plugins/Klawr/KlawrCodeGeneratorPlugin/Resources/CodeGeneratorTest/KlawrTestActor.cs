@@ -0,0 +1,205 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Collections.Generic;
+using Klawr.ClrHost.Interfaces;
+using Klawr.ClrHost.Managed;
+using Klawr.ClrHost.Managed.SafeHandles;
+using Klawr.ClrHost.Managed.Collections;
+
+namespace Klawr.UnrealEngine
+{
+    [System.CodeDom.Compiler.GeneratedCode("KlawrCodeGenerator", "1.0")]
+    public class AKlawrTestActor : AActor
+    {
+        public AKlawrTestActor(UObjectHandle nativeObject) : base(nativeObject)
+        {
+        }
+
+        public new static UClass StaticClass()
+        {
+            return (UClass)typeof(AKlawrTestActor);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void ResetAllAction(UObjectHandle self);
+        private static ResetAllAction _ResetAll;
+        public void ResetAll()
+        {
+            _ResetAll((UObjectHandle)this);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void TakeValuesAction(UObjectHandle self, int Count, float Scale, [MarshalAs(UnmanagedType.U1)] bool bEnabled, [MarshalAs(UnmanagedType.U1)] bool bFlag, string Text, FScriptName Tag, FVector Location, UObjectHandle Actor, UObjectHandle Class, UObjectHandle ActorClass);
+        private static TakeValuesAction _TakeValues;
+        public void TakeValues(int Count, float Scale, bool bEnabled, bool bFlag, string Text, FScriptName Tag, FVector Location, AActor Actor, UClass Class, TSubclassOf<AActor> ActorClass)
+        {
+            _TakeValues((UObjectHandle)this, Count, Scale, bEnabled, bFlag, Text, Tag, Location, (UObjectHandle)Actor, (UObjectHandle)Class, (UObjectHandle)ActorClass);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void TakeRefsAction(UObjectHandle self, ref int Count, ref float Scale, [MarshalAs(UnmanagedType.U1)] ref bool bEnabled, ref FScriptName Tag, ref FTransform Transform);
+        private static TakeRefsAction _TakeRefs;
+        public void TakeRefs(ref int Count, ref float Scale, ref bool bEnabled, ref FScriptName Tag, ref FTransform Transform)
+        {
+            _TakeRefs((UObjectHandle)this, ref Count, ref Scale, ref bEnabled, ref Tag, ref Transform);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void GetOutsAction(UObjectHandle self, out int OutCount, out float OutScale, [MarshalAs(UnmanagedType.U1)] out bool bOutEnabled, out FScriptName OutTag, out FLinearColor OutLinearColor, out FColor OutColor);
+        private static GetOutsAction _GetOuts;
+        public void GetOuts(out int OutCount, out float OutScale, out bool bOutEnabled, out FScriptName OutTag, out FLinearColor OutLinearColor, out FColor OutColor)
+        {
+            _GetOuts((UObjectHandle)this, out OutCount, out OutScale, out bOutEnabled, out OutTag, out OutLinearColor, out OutColor);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void TakeConstRefsAction(UObjectHandle self, string Text, FScriptName Tag, FQuat Rotation, FVector4 Plane, UObjectHandle Actor);
+        private static TakeConstRefsAction _TakeConstRefs;
+        public void TakeConstRefs(string Text, FScriptName Tag, FQuat Rotation, FVector4 Plane, AActor Actor)
+        {
+            _TakeConstRefs((UObjectHandle)this, Text, Tag, Rotation, Plane, (UObjectHandle)Actor);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int GetCountFunc(UObjectHandle self);
+        private static GetCountFunc _GetCount;
+        public int GetCount()
+        {
+            var value = _GetCount((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate float GetScaleFunc(UObjectHandle self);
+        private static GetScaleFunc _GetScale;
+        public float GetScale()
+        {
+            var value = _GetScale((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private delegate bool IsEnabledFunc(UObjectHandle self);
+        private static IsEnabledFunc _IsEnabled;
+        public bool IsEnabled()
+        {
+            var value = _IsEnabled((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate StringRef GetTextFunc(UObjectHandle self);
+        private static GetTextFunc _GetText;
+        public string GetText()
+        {
+            var value = _GetText((UObjectHandle)this);
+            return value.ToString();
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FScriptName GetTagFunc(UObjectHandle self);
+        private static GetTagFunc _GetTag;
+        public FScriptName GetTag()
+        {
+            var value = _GetTag((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FVector2D GetSizeFunc(UObjectHandle self);
+        private static GetSizeFunc _GetSize;
+        public FVector2D GetSize()
+        {
+            var value = _GetSize((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FTransform GetTransformFunc(UObjectHandle self);
+        private static GetTransformFunc _GetTransform;
+        public FTransform GetTransform()
+        {
+            var value = _GetTransform((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle GetOwnerActorFunc(UObjectHandle self);
+        private static GetOwnerActorFunc _GetOwnerActor;
+        public AActor GetOwnerActor()
+        {
+            var value = _GetOwnerActor((UObjectHandle)this);
+            return new AActor(value);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle GetActorClassFunc(UObjectHandle self);
+        private static GetActorClassFunc _GetActorClass;
+        public UClass GetActorClass()
+        {
+            var value = _GetActorClass((UObjectHandle)this);
+            return (UClass)value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle GetSpawnClassFunc(UObjectHandle self);
+        private static GetSpawnClassFunc _GetSpawnClass;
+        public TSubclassOf<AActor> GetSpawnClass()
+        {
+            var value = _GetSpawnClass((UObjectHandle)this);
+            return (UClass)value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle FindActorFunc(UObjectHandle self, FScriptName Tag, [MarshalAs(UnmanagedType.U1)] out bool bFound);
+        private static FindActorFunc _FindActor;
+        public AActor FindActor(FScriptName Tag, out bool bFound)
+        {
+            var value = _FindActor((UObjectHandle)this, Tag, out bFound);
+            return new AActor(value);
+        }
+
+        static AKlawrTestActor()
+        {
+            var manager = AppDomain.CurrentDomain.DomainManager as IEngineAppDomainManager;
+            var nativeFuncPtrs = manager.GetNativeFunctionPointers("AKlawrTestActor");
+            _ResetAll = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[0], typeof(ResetAllAction)) as ResetAllAction;
+            _TakeValues = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[1], typeof(TakeValuesAction)) as TakeValuesAction;
+            _TakeRefs = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[2], typeof(TakeRefsAction)) as TakeRefsAction;
+            _GetOuts = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[3], typeof(GetOutsAction)) as GetOutsAction;
+            _TakeConstRefs = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[4], typeof(TakeConstRefsAction)) as TakeConstRefsAction;
+            _GetCount = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[5], typeof(GetCountFunc)) as GetCountFunc;
+            _GetScale = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[6], typeof(GetScaleFunc)) as GetScaleFunc;
+            _IsEnabled = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[7], typeof(IsEnabledFunc)) as IsEnabledFunc;
+            _GetText = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[8], typeof(GetTextFunc)) as GetTextFunc;
+            _GetTag = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[9], typeof(GetTagFunc)) as GetTagFunc;
+            _GetSize = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[10], typeof(GetSizeFunc)) as GetSizeFunc;
+            _GetTransform = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[11], typeof(GetTransformFunc)) as GetTransformFunc;
+            _GetOwnerActor = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[12], typeof(GetOwnerActorFunc)) as GetOwnerActorFunc;
+            _GetActorClass = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[13], typeof(GetActorClassFunc)) as GetActorClassFunc;
+            _GetSpawnClass = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[14], typeof(GetSpawnClassFunc)) as GetSpawnClassFunc;
+            _FindActor = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[15], typeof(FindActorFunc)) as FindActorFunc;
+        }
+    }
+
+    [System.CodeDom.Compiler.GeneratedCode("KlawrCodeGenerator", "1.0")]
+    public abstract class AKlawrTestActorScriptObject : AKlawrTestActor, IScriptObject
+    {
+        private readonly long _instanceID;
+
+        public long InstanceID
+        {
+            get { return _instanceID; }
+        }
+
+        public AKlawrTestActorScriptObject(long instanceID, UObjectHandle nativeObject) : base(nativeObject)
+        {
+            _instanceID = instanceID;
+        }
+
+        public virtual void BeginPlay() {}
+        public virtual void Tick(float deltaTime) {}
+        public virtual void Destroy() {}
+    }
+}
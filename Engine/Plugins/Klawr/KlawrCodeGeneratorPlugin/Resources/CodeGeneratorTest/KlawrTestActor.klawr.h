@@ -0,0 +1,387 @@
+#pragma once
+
+namespace Klawr {
+namespace NativeGlue {
+
+struct KlawrTestActor
+{
+	static void ResetAll(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::ResetAll"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("ResetAll"));
+		Obj->ProcessEvent(Function, NULL);
+	}
+
+	static void TakeValues(void* self, int32 Count, float Scale, uint8 bEnabled, uint8 bFlag, const TCHAR* Text, FScriptName Tag, FVector Location, void* Actor, void* Class, void* ActorClass)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::TakeValues"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			int32 Count;
+			float Scale;
+			bool bEnabled;
+			uint8 bFlag;
+			FString Text;
+			FName Tag;
+			FVector Location;
+			AActor* Actor;
+			UClass* Class;
+			TSubclassOf<AActor> ActorClass;
+		}
+		Params =
+		{
+			Count,
+			Scale,
+			!!bEnabled,
+			bFlag,
+			Text,
+			ScriptNameToName(Tag),
+			Location,
+			static_cast<AActor*>(Actor),
+			static_cast<UClass*>(Class),
+			static_cast<UClass*>(ActorClass),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("TakeValues"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+	}
+
+	static void TakeRefs(void* self, int32* Count, float* Scale, uint8* bEnabled, FScriptName* Tag, FTransform* Transform)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::TakeRefs"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			int32 Count;
+			float Scale;
+			bool bEnabled;
+			FName Tag;
+			FTransform Transform;
+		}
+		Params =
+		{
+			(*Count),
+			(*Scale),
+			!!(*bEnabled),
+			ScriptNameToName((*Tag)),
+			(*Transform),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("TakeRefs"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		*Count = Params.Count;
+		*Scale = Params.Scale;
+		*bEnabled = Params.bEnabled;
+		*Tag = NameToScriptName(Params.Tag);
+		*Transform = Params.Transform;
+	}
+
+	static void GetOuts(void* self, int32* OutCount, float* OutScale, uint8* bOutEnabled, FScriptName* OutTag, FLinearColor* OutLinearColor, FColor* OutColor)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetOuts"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			int32 OutCount;
+			float OutScale;
+			bool bOutEnabled;
+			FName OutTag;
+			FLinearColor OutLinearColor;
+			FColor OutColor;
+		}
+		Params =
+		{
+			(*OutCount),
+			(*OutScale),
+			!!(*bOutEnabled),
+			ScriptNameToName((*OutTag)),
+			(*OutLinearColor),
+			(*OutColor),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetOuts"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		*OutCount = Params.OutCount;
+		*OutScale = Params.OutScale;
+		*bOutEnabled = Params.bOutEnabled;
+		*OutTag = NameToScriptName(Params.OutTag);
+		*OutLinearColor = Params.OutLinearColor;
+		*OutColor = Params.OutColor;
+	}
+
+	static void TakeConstRefs(void* self, const TCHAR* Text, FScriptName* Tag, FQuat* Rotation, FVector4* Plane, void* Actor)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::TakeConstRefs"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FString Text;
+			FName Tag;
+			FQuat Rotation;
+			FVector4 Plane;
+			AActor* Actor;
+		}
+		Params =
+		{
+			Text,
+			ScriptNameToName((*Tag)),
+			(*Rotation),
+			(*Plane),
+			static_cast<AActor*>(Actor),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("TakeConstRefs"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+	}
+
+	static int32 GetCount(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetCount"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			int32 ReturnValue;
+		}
+		Params =
+		{
+			int32(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetCount"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static float GetScale(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetScale"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			float ReturnValue;
+		}
+		Params =
+		{
+			float(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetScale"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static uint8 IsEnabled(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::IsEnabled"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			bool ReturnValue;
+		}
+		Params =
+		{
+			bool(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("IsEnabled"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static StringRef GetText(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetText"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FString ReturnValue;
+		}
+		Params =
+		{
+			FString(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetText"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return FThreadStringScratch::MakeStringRef(Params.ReturnValue);
+	}
+
+	static FScriptName GetTag(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetTag"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FName ReturnValue;
+		}
+		Params =
+		{
+			FName(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetTag"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return NameToScriptName(Params.ReturnValue);
+	}
+
+	static FVector2D GetSize(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetSize"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FVector2D ReturnValue;
+		}
+		Params =
+		{
+			FVector2D(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetSize"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static FTransform GetTransform(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetTransform"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FTransform ReturnValue;
+		}
+		Params =
+		{
+			FTransform(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetTransform"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static void* GetOwnerActor(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetOwnerActor"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			AActor* ReturnValue;
+		}
+		Params =
+		{
+			nullptr,
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetOwnerActor"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		if (Params.ReturnValue)
+		{
+			FObjectReferencer::AddObjectRef(Params.ReturnValue);
+		}
+		return static_cast<UObject*>(Params.ReturnValue);
+	}
+
+	static void* GetActorClass(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetActorClass"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			UClass* ReturnValue;
+		}
+		Params =
+		{
+			nullptr,
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetActorClass"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return static_cast<UObject*>(Params.ReturnValue);
+	}
+
+	static void* GetSpawnClass(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::GetSpawnClass"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			TSubclassOf<AActor> ReturnValue;
+		}
+		Params =
+		{
+			nullptr,
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetSpawnClass"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return static_cast<UObject*>(Params.ReturnValue);
+	}
+
+	static void* FindActor(void* self, FScriptName Tag, uint8* bFound)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestActor::FindActor"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			FName Tag;
+			bool bFound;
+			AActor* ReturnValue;
+		}
+		Params =
+		{
+			ScriptNameToName(Tag),
+			!!(*bFound),
+			nullptr,
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("FindActor"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		*bFound = Params.bFound;
+		if (Params.ReturnValue)
+		{
+			FObjectReferencer::AddObjectRef(Params.ReturnValue);
+		}
+		return static_cast<UObject*>(Params.ReturnValue);
+	}
+
+}
+;
+static void* KlawrTestActor_WrapperFunctions[] =
+{
+	KlawrTestActor::ResetAll,
+	KlawrTestActor::TakeValues,
+	KlawrTestActor::TakeRefs,
+	KlawrTestActor::GetOuts,
+	KlawrTestActor::TakeConstRefs,
+	KlawrTestActor::GetCount,
+	KlawrTestActor::GetScale,
+	KlawrTestActor::IsEnabled,
+	KlawrTestActor::GetText,
+	KlawrTestActor::GetTag,
+	KlawrTestActor::GetSize,
+	KlawrTestActor::GetTransform,
+	KlawrTestActor::GetOwnerActor,
+	KlawrTestActor::GetActorClass,
+	KlawrTestActor::GetSpawnClass,
+	KlawrTestActor::FindActor,
+}
+;
+}} // namespace Klawr::NativeGlue
@@ -0,0 +1,58 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Collections.Generic;
+using Klawr.ClrHost.Interfaces;
+using Klawr.ClrHost.Managed;
+using Klawr.ClrHost.Managed.SafeHandles;
+using Klawr.ClrHost.Managed.Collections;
+
+namespace Klawr.UnrealEngine
+{
+    [System.CodeDom.Compiler.GeneratedCode("KlawrCodeGenerator", "1.0")]
+    public class AKlawrTestDerivedActor : AKlawrTestActor
+    {
+        public AKlawrTestDerivedActor(UObjectHandle nativeObject) : base(nativeObject)
+        {
+        }
+
+        public new static UClass StaticClass()
+        {
+            return (UClass)typeof(AKlawrTestDerivedActor);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate float GetSpeedFunc(UObjectHandle self);
+        private static GetSpeedFunc _GetSpeed;
+        public float GetSpeed()
+        {
+            var value = _GetSpeed((UObjectHandle)this);
+            return value;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate float Get_SpeedFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_SpeedAction(UObjectHandle self, float Speed);
+        private static Get_SpeedFunc _Get_Speed;
+        private static Set_SpeedAction _Set_Speed;
+        public float Speed
+        {
+            get
+            {
+                var value = _Get_Speed((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_Speed((UObjectHandle)this, value); }
+        }
+
+        static AKlawrTestDerivedActor()
+        {
+            var manager = AppDomain.CurrentDomain.DomainManager as IEngineAppDomainManager;
+            var nativeFuncPtrs = manager.GetNativeFunctionPointers("AKlawrTestDerivedActor");
+            _Get_Speed = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[0], typeof(Get_SpeedFunc)) as Get_SpeedFunc;
+            _Set_Speed = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[1], typeof(Set_SpeedAction)) as Set_SpeedAction;
+            _GetSpeed = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[2], typeof(GetSpeedFunc)) as GetSpeedFunc;
+        }
+    }
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace Klawr {
+namespace NativeGlue {
+
+struct KlawrTestDerivedActor
+{
+	static float GetSpeed(void* self)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestDerivedActor::GetSpeed"));
+		UObject* Obj = static_cast<UObject*>(self);
+		struct FDispatchParams
+		{
+			float ReturnValue;
+		}
+		Params =
+		{
+			float(),
+		}
+		;
+		static UFunction* Function = Obj->FindFunctionChecked(TEXT("GetSpeed"));
+		check(Function->ParmsSize == sizeof(FDispatchParams));
+		Obj->ProcessEvent(Function, &Params);
+		return Params.ReturnValue;
+	}
+
+	static float Get_Speed(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(AKlawrTestDerivedActor::StaticClass(), TEXT("Speed"));
+		float PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_Speed(void* self, float Speed)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("AKlawrTestDerivedActor::Set_Speed"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(AKlawrTestDerivedActor::StaticClass(), TEXT("Speed"));
+		float PropertyValue = Speed;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+}
+;
+static void* KlawrTestDerivedActor_WrapperFunctions[] =
+{
+	KlawrTestDerivedActor::Get_Speed,
+	KlawrTestDerivedActor::Set_Speed,
+	KlawrTestDerivedActor::GetSpeed,
+}
+;
+}} // namespace Klawr::NativeGlue
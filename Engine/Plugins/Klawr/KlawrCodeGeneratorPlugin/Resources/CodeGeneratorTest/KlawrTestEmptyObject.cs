@@ -0,0 +1,25 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Collections.Generic;
+using Klawr.ClrHost.Interfaces;
+using Klawr.ClrHost.Managed;
+using Klawr.ClrHost.Managed.SafeHandles;
+using Klawr.ClrHost.Managed.Collections;
+
+namespace Klawr.UnrealEngine
+{
+    [System.CodeDom.Compiler.GeneratedCode("KlawrCodeGenerator", "1.0")]
+    public class UKlawrTestEmptyObject : UObject
+    {
+        public UKlawrTestEmptyObject(UObjectHandle nativeObject) : base(nativeObject)
+        {
+        }
+
+        public new static UClass StaticClass()
+        {
+            return (UClass)typeof(UKlawrTestEmptyObject);
+        }
+
+    }
+
+}
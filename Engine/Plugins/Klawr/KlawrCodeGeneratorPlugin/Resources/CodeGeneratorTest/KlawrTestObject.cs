@@ -0,0 +1,513 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Collections.Generic;
+using Klawr.ClrHost.Interfaces;
+using Klawr.ClrHost.Managed;
+using Klawr.ClrHost.Managed.SafeHandles;
+using Klawr.ClrHost.Managed.Collections;
+
+namespace Klawr.UnrealEngine
+{
+    [System.CodeDom.Compiler.GeneratedCode("KlawrCodeGenerator", "1.0")]
+    public class UKlawrTestObject : UObject
+    {
+        public UKlawrTestObject(UObjectHandle nativeObject) : base(nativeObject)
+        {
+        }
+
+        public new static UClass StaticClass()
+        {
+            return (UClass)typeof(UKlawrTestObject);
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate int Get_IntValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_IntValueAction(UObjectHandle self, int IntValue);
+        private static Get_IntValueFunc _Get_IntValue;
+        private static Set_IntValueAction _Set_IntValue;
+        public int IntValue
+        {
+            get
+            {
+                var value = _Get_IntValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_IntValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate float Get_FloatValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_FloatValueAction(UObjectHandle self, float FloatValue);
+        private static Get_FloatValueFunc _Get_FloatValue;
+        private static Set_FloatValueAction _Set_FloatValue;
+        public float FloatValue
+        {
+            get
+            {
+                var value = _Get_FloatValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_FloatValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private delegate bool Get_bNativeBoolValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_bNativeBoolValueAction(UObjectHandle self, [MarshalAs(UnmanagedType.U1)] bool bNativeBoolValue);
+        private static Get_bNativeBoolValueFunc _Get_bNativeBoolValue;
+        private static Set_bNativeBoolValueAction _Set_bNativeBoolValue;
+        public bool bNativeBoolValue
+        {
+            get
+            {
+                var value = _Get_bNativeBoolValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_bNativeBoolValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        private delegate bool Get_bBitfieldBoolValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_bBitfieldBoolValueAction(UObjectHandle self, [MarshalAs(UnmanagedType.U1)] bool bBitfieldBoolValue);
+        private static Get_bBitfieldBoolValueFunc _Get_bBitfieldBoolValue;
+        private static Set_bBitfieldBoolValueAction _Set_bBitfieldBoolValue;
+        public bool bBitfieldBoolValue
+        {
+            get
+            {
+                var value = _Get_bBitfieldBoolValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_bBitfieldBoolValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate StringRef Get_StrValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_StrValueAction(UObjectHandle self, string StrValue);
+        private static Get_StrValueFunc _Get_StrValue;
+        private static Set_StrValueAction _Set_StrValue;
+        public string StrValue
+        {
+            get
+            {
+                var value = _Get_StrValue((UObjectHandle)this);
+                return value.ToString();
+            }
+            set { _Set_StrValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FScriptName Get_NameValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_NameValueAction(UObjectHandle self, FScriptName NameValue);
+        private static Get_NameValueFunc _Get_NameValue;
+        private static Set_NameValueAction _Set_NameValue;
+        public FScriptName NameValue
+        {
+            get
+            {
+                var value = _Get_NameValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_NameValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle Get_ObjectValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_ObjectValueAction(UObjectHandle self, UObjectHandle ObjectValue);
+        private static Get_ObjectValueFunc _Get_ObjectValue;
+        private static Set_ObjectValueAction _Set_ObjectValue;
+        public AActor ObjectValue
+        {
+            get
+            {
+                var value = _Get_ObjectValue((UObjectHandle)this);
+                return new AActor(value);
+            }
+            set { _Set_ObjectValue((UObjectHandle)this, (UObjectHandle)value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle Get_ClassValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_ClassValueAction(UObjectHandle self, UObjectHandle ClassValue);
+        private static Get_ClassValueFunc _Get_ClassValue;
+        private static Set_ClassValueAction _Set_ClassValue;
+        public UClass ClassValue
+        {
+            get
+            {
+                var value = _Get_ClassValue((UObjectHandle)this);
+                return (UClass)value;
+            }
+            set { _Set_ClassValue((UObjectHandle)this, (UObjectHandle)value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate UObjectHandle Get_SubclassOfValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_SubclassOfValueAction(UObjectHandle self, UObjectHandle SubclassOfValue);
+        private static Get_SubclassOfValueFunc _Get_SubclassOfValue;
+        private static Set_SubclassOfValueAction _Set_SubclassOfValue;
+        public TSubclassOf<AActor> SubclassOfValue
+        {
+            get
+            {
+                var value = _Get_SubclassOfValue((UObjectHandle)this);
+                return (UClass)value;
+            }
+            set { _Set_SubclassOfValue((UObjectHandle)this, (UObjectHandle)value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate IntPtr Get_AssetValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_AssetValueAction(UObjectHandle self, IntPtr AssetValue);
+        private static Get_AssetValueFunc _Get_AssetValue;
+        private static Set_AssetValueAction _Set_AssetValue;
+        public IntPtr AssetValue
+        {
+            get
+            {
+                var value = _Get_AssetValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_AssetValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FVector2D Get_Vector2DValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_Vector2DValueAction(UObjectHandle self, FVector2D Vector2DValue);
+        private static Get_Vector2DValueFunc _Get_Vector2DValue;
+        private static Set_Vector2DValueAction _Set_Vector2DValue;
+        public FVector2D Vector2DValue
+        {
+            get
+            {
+                var value = _Get_Vector2DValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_Vector2DValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FVector Get_VectorValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_VectorValueAction(UObjectHandle self, FVector VectorValue);
+        private static Get_VectorValueFunc _Get_VectorValue;
+        private static Set_VectorValueAction _Set_VectorValue;
+        public FVector VectorValue
+        {
+            get
+            {
+                var value = _Get_VectorValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_VectorValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FVector4 Get_Vector4ValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_Vector4ValueAction(UObjectHandle self, FVector4 Vector4Value);
+        private static Get_Vector4ValueFunc _Get_Vector4Value;
+        private static Set_Vector4ValueAction _Set_Vector4Value;
+        public FVector4 Vector4Value
+        {
+            get
+            {
+                var value = _Get_Vector4Value((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_Vector4Value((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FQuat Get_QuatValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_QuatValueAction(UObjectHandle self, FQuat QuatValue);
+        private static Get_QuatValueFunc _Get_QuatValue;
+        private static Set_QuatValueAction _Set_QuatValue;
+        public FQuat QuatValue
+        {
+            get
+            {
+                var value = _Get_QuatValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_QuatValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FTransform Get_TransformValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_TransformValueAction(UObjectHandle self, FTransform TransformValue);
+        private static Get_TransformValueFunc _Get_TransformValue;
+        private static Set_TransformValueAction _Set_TransformValue;
+        public FTransform TransformValue
+        {
+            get
+            {
+                var value = _Get_TransformValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_TransformValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FLinearColor Get_LinearColorValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_LinearColorValueAction(UObjectHandle self, FLinearColor LinearColorValue);
+        private static Get_LinearColorValueFunc _Get_LinearColorValue;
+        private static Set_LinearColorValueAction _Set_LinearColorValue;
+        public FLinearColor LinearColorValue
+        {
+            get
+            {
+                var value = _Get_LinearColorValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_LinearColorValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate FColor Get_ColorValueFunc(UObjectHandle self);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate void Set_ColorValueAction(UObjectHandle self, FColor ColorValue);
+        private static Get_ColorValueFunc _Get_ColorValue;
+        private static Set_ColorValueAction _Set_ColorValue;
+        public FColor ColorValue
+        {
+            get
+            {
+                var value = _Get_ColorValue((UObjectHandle)this);
+                return value;
+            }
+            set { _Set_ColorValue((UObjectHandle)this, value); }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_IntArrayFunc(UObjectHandle self);
+        private static Get_IntArrayFunc _Get_IntArray;
+        private ArrayList<int> _IntArray;
+
+        public ArrayList<int> IntArray
+        {
+            get
+            {
+                if (_IntArray == null)
+                {
+                    var arrayHandle = _Get_IntArray((UObjectHandle)this);
+                    _IntArray = new ArrayList<int>(new Int32ArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _IntArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_FloatArrayFunc(UObjectHandle self);
+        private static Get_FloatArrayFunc _Get_FloatArray;
+        private ArrayList<float> _FloatArray;
+
+        public ArrayList<float> FloatArray
+        {
+            get
+            {
+                if (_FloatArray == null)
+                {
+                    var arrayHandle = _Get_FloatArray((UObjectHandle)this);
+                    _FloatArray = new ArrayList<float>(new FloatArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _FloatArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_BoolArrayFunc(UObjectHandle self);
+        private static Get_BoolArrayFunc _Get_BoolArray;
+        private ArrayList<bool> _BoolArray;
+
+        public IList<bool> BoolArray
+        {
+            get
+            {
+                if (_BoolArray == null)
+                {
+                    var arrayHandle = _Get_BoolArray((UObjectHandle)this);
+                    _BoolArray = new ArrayList<bool>(new BoolArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _BoolArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_StrArrayFunc(UObjectHandle self);
+        private static Get_StrArrayFunc _Get_StrArray;
+        private ArrayList<string> _StrArray;
+
+        public IList<string> StrArray
+        {
+            get
+            {
+                if (_StrArray == null)
+                {
+                    var arrayHandle = _Get_StrArray((UObjectHandle)this);
+                    _StrArray = new ArrayList<string>(new StringArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _StrArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_NameArrayFunc(UObjectHandle self);
+        private static Get_NameArrayFunc _Get_NameArray;
+        private ArrayList<FScriptName> _NameArray;
+
+        public IList<FScriptName> NameArray
+        {
+            get
+            {
+                if (_NameArray == null)
+                {
+                    var arrayHandle = _Get_NameArray((UObjectHandle)this);
+                    _NameArray = new ArrayList<FScriptName>(new NameArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _NameArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_ObjectArrayFunc(UObjectHandle self);
+        private static Get_ObjectArrayFunc _Get_ObjectArray;
+        private ArrayList<AActor> _ObjectArray;
+
+        public IList<AActor> ObjectArray
+        {
+            get
+            {
+                if (_ObjectArray == null)
+                {
+                    var arrayHandle = _Get_ObjectArray((UObjectHandle)this);
+                    _ObjectArray = new ArrayList<AActor>(new ObjectArrayProperty<AActor>((UObjectHandle)this, arrayHandle));
+                }
+                return _ObjectArray;
+            }
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        private delegate ArrayHandle Get_VectorArrayFunc(UObjectHandle self);
+        private static Get_VectorArrayFunc _Get_VectorArray;
+        private ArrayList<FVector> _VectorArray;
+
+        public ArrayList<FVector> VectorArray
+        {
+            get
+            {
+                if (_VectorArray == null)
+                {
+                    var arrayHandle = _Get_VectorArray((UObjectHandle)this);
+                    _VectorArray = new ArrayList<FVector>(new VectorArrayProperty((UObjectHandle)this, arrayHandle));
+                }
+                return _VectorArray;
+            }
+        }
+
+        private bool _isDisposed = false;
+
+        protected override void Dispose(bool isDisposing)
+        {
+            if (!_isDisposed)
+            {
+                if (isDisposing)
+                {
+                    if (_IntArray != null)
+                    {
+                        _IntArray.Dispose();
+                    }
+                    if (_FloatArray != null)
+                    {
+                        _FloatArray.Dispose();
+                    }
+                    if (_BoolArray != null)
+                    {
+                        _BoolArray.Dispose();
+                    }
+                    if (_StrArray != null)
+                    {
+                        _StrArray.Dispose();
+                    }
+                    if (_NameArray != null)
+                    {
+                        _NameArray.Dispose();
+                    }
+                    if (_ObjectArray != null)
+                    {
+                        _ObjectArray.Dispose();
+                    }
+                    if (_VectorArray != null)
+                    {
+                        _VectorArray.Dispose();
+                    }
+                }
+                _isDisposed = true;
+                base.Dispose(isDisposing);
+            }
+        }
+
+        static UKlawrTestObject()
+        {
+            var manager = AppDomain.CurrentDomain.DomainManager as IEngineAppDomainManager;
+            var nativeFuncPtrs = manager.GetNativeFunctionPointers("UKlawrTestObject");
+            _Get_IntValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[0], typeof(Get_IntValueFunc)) as Get_IntValueFunc;
+            _Set_IntValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[1], typeof(Set_IntValueAction)) as Set_IntValueAction;
+            _Get_FloatValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[2], typeof(Get_FloatValueFunc)) as Get_FloatValueFunc;
+            _Set_FloatValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[3], typeof(Set_FloatValueAction)) as Set_FloatValueAction;
+            _Get_bNativeBoolValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[4], typeof(Get_bNativeBoolValueFunc)) as Get_bNativeBoolValueFunc;
+            _Set_bNativeBoolValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[5], typeof(Set_bNativeBoolValueAction)) as Set_bNativeBoolValueAction;
+            _Get_bBitfieldBoolValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[6], typeof(Get_bBitfieldBoolValueFunc)) as Get_bBitfieldBoolValueFunc;
+            _Set_bBitfieldBoolValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[7], typeof(Set_bBitfieldBoolValueAction)) as Set_bBitfieldBoolValueAction;
+            _Get_StrValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[8], typeof(Get_StrValueFunc)) as Get_StrValueFunc;
+            _Set_StrValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[9], typeof(Set_StrValueAction)) as Set_StrValueAction;
+            _Get_NameValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[10], typeof(Get_NameValueFunc)) as Get_NameValueFunc;
+            _Set_NameValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[11], typeof(Set_NameValueAction)) as Set_NameValueAction;
+            _Get_ObjectValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[12], typeof(Get_ObjectValueFunc)) as Get_ObjectValueFunc;
+            _Set_ObjectValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[13], typeof(Set_ObjectValueAction)) as Set_ObjectValueAction;
+            _Get_ClassValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[14], typeof(Get_ClassValueFunc)) as Get_ClassValueFunc;
+            _Set_ClassValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[15], typeof(Set_ClassValueAction)) as Set_ClassValueAction;
+            _Get_SubclassOfValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[16], typeof(Get_SubclassOfValueFunc)) as Get_SubclassOfValueFunc;
+            _Set_SubclassOfValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[17], typeof(Set_SubclassOfValueAction)) as Set_SubclassOfValueAction;
+            _Get_AssetValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[18], typeof(Get_AssetValueFunc)) as Get_AssetValueFunc;
+            _Set_AssetValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[19], typeof(Set_AssetValueAction)) as Set_AssetValueAction;
+            _Get_Vector2DValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[20], typeof(Get_Vector2DValueFunc)) as Get_Vector2DValueFunc;
+            _Set_Vector2DValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[21], typeof(Set_Vector2DValueAction)) as Set_Vector2DValueAction;
+            _Get_VectorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[22], typeof(Get_VectorValueFunc)) as Get_VectorValueFunc;
+            _Set_VectorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[23], typeof(Set_VectorValueAction)) as Set_VectorValueAction;
+            _Get_Vector4Value = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[24], typeof(Get_Vector4ValueFunc)) as Get_Vector4ValueFunc;
+            _Set_Vector4Value = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[25], typeof(Set_Vector4ValueAction)) as Set_Vector4ValueAction;
+            _Get_QuatValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[26], typeof(Get_QuatValueFunc)) as Get_QuatValueFunc;
+            _Set_QuatValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[27], typeof(Set_QuatValueAction)) as Set_QuatValueAction;
+            _Get_TransformValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[28], typeof(Get_TransformValueFunc)) as Get_TransformValueFunc;
+            _Set_TransformValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[29], typeof(Set_TransformValueAction)) as Set_TransformValueAction;
+            _Get_LinearColorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[30], typeof(Get_LinearColorValueFunc)) as Get_LinearColorValueFunc;
+            _Set_LinearColorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[31], typeof(Set_LinearColorValueAction)) as Set_LinearColorValueAction;
+            _Get_ColorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[32], typeof(Get_ColorValueFunc)) as Get_ColorValueFunc;
+            _Set_ColorValue = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[33], typeof(Set_ColorValueAction)) as Set_ColorValueAction;
+            _Get_IntArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[34], typeof(Get_IntArrayFunc)) as Get_IntArrayFunc;
+            _Get_FloatArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[35], typeof(Get_FloatArrayFunc)) as Get_FloatArrayFunc;
+            _Get_BoolArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[36], typeof(Get_BoolArrayFunc)) as Get_BoolArrayFunc;
+            _Get_StrArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[37], typeof(Get_StrArrayFunc)) as Get_StrArrayFunc;
+            _Get_NameArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[38], typeof(Get_NameArrayFunc)) as Get_NameArrayFunc;
+            _Get_ObjectArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[39], typeof(Get_ObjectArrayFunc)) as Get_ObjectArrayFunc;
+            _Get_VectorArray = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[40], typeof(Get_VectorArrayFunc)) as Get_VectorArrayFunc;
+        }
+    }
+
+}
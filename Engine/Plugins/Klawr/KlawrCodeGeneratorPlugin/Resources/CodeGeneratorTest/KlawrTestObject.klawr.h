@@ -0,0 +1,425 @@
+#pragma once
+
+namespace Klawr {
+namespace NativeGlue {
+
+struct KlawrTestObject
+{
+	static int32 Get_IntValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("IntValue"));
+		int32 PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_IntValue(void* self, int32 IntValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_IntValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("IntValue"));
+		int32 PropertyValue = IntValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static float Get_FloatValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("FloatValue"));
+		float PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_FloatValue(void* self, float FloatValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_FloatValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("FloatValue"));
+		float PropertyValue = FloatValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static uint8 Get_bNativeBoolValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("bNativeBoolValue"));
+		bool PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_bNativeBoolValue(void* self, uint8 bNativeBoolValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_bNativeBoolValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("bNativeBoolValue"));
+		bool PropertyValue = !!bNativeBoolValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static uint8 Get_bBitfieldBoolValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("bBitfieldBoolValue"));
+		uint8 PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_bBitfieldBoolValue(void* self, uint8 bBitfieldBoolValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_bBitfieldBoolValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("bBitfieldBoolValue"));
+		uint8 PropertyValue = bBitfieldBoolValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static StringRef Get_StrValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("StrValue"));
+		return MakeStringRef(*Property->ContainerPtrToValuePtr<FString>(Obj));
+	}
+
+	static void Set_StrValue(void* self, const TCHAR* StrValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_StrValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("StrValue"));
+		FString PropertyValue = StrValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FScriptName Get_NameValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("NameValue"));
+		FName PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return NameToScriptName(PropertyValue);
+	}
+
+	static void Set_NameValue(void* self, FScriptName NameValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_NameValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("NameValue"));
+		FName PropertyValue = ScriptNameToName(NameValue);
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static void* Get_ObjectValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ObjectValue"));
+		AActor* PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		if (PropertyValue)
+		{
+			FObjectReferencer::AddObjectRef(PropertyValue);
+		}
+		return static_cast<UObject*>(PropertyValue);
+	}
+
+	static void Set_ObjectValue(void* self, void* ObjectValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_ObjectValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ObjectValue"));
+		AActor* PropertyValue = static_cast<AActor*>(ObjectValue);
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static void* Get_ClassValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ClassValue"));
+		UClass* PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return static_cast<UObject*>(PropertyValue);
+	}
+
+	static void Set_ClassValue(void* self, void* ClassValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_ClassValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ClassValue"));
+		UClass* PropertyValue = static_cast<UClass*>(ClassValue);
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static void* Get_SubclassOfValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("SubclassOfValue"));
+		TSubclassOf<AActor> PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return static_cast<UObject*>(PropertyValue);
+	}
+
+	static void Set_SubclassOfValue(void* self, void* SubclassOfValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_SubclassOfValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("SubclassOfValue"));
+		TSubclassOf<AActor> PropertyValue = static_cast<UClass*>(SubclassOfValue);
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static void* Get_AssetValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("AssetValue"));
+		TAssetPtr<AActor> PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		if (PropertyValue)
+		{
+			FObjectReferencer::AddObjectRef(PropertyValue);
+		}
+		return static_cast<UObject*>(PropertyValue);
+	}
+
+	static void Set_AssetValue(void* self, void* AssetValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_AssetValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("AssetValue"));
+		TAssetPtr<AActor> PropertyValue = static_cast<TAssetPtr<AActor>>(AssetValue);
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FVector2D Get_Vector2DValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("Vector2DValue"));
+		FVector2D PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_Vector2DValue(void* self, FVector2D Vector2DValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_Vector2DValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("Vector2DValue"));
+		FVector2D PropertyValue = Vector2DValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FVector Get_VectorValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("VectorValue"));
+		FVector PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_VectorValue(void* self, FVector VectorValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_VectorValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("VectorValue"));
+		FVector PropertyValue = VectorValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FVector4 Get_Vector4Value(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("Vector4Value"));
+		FVector4 PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_Vector4Value(void* self, FVector4 Vector4Value)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_Vector4Value"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("Vector4Value"));
+		FVector4 PropertyValue = Vector4Value;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FQuat Get_QuatValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("QuatValue"));
+		FQuat PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_QuatValue(void* self, FQuat QuatValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_QuatValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("QuatValue"));
+		FQuat PropertyValue = QuatValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FTransform Get_TransformValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("TransformValue"));
+		FTransform PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_TransformValue(void* self, FTransform TransformValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_TransformValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("TransformValue"));
+		FTransform PropertyValue = TransformValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FLinearColor Get_LinearColorValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("LinearColorValue"));
+		FLinearColor PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_LinearColorValue(void* self, FLinearColor LinearColorValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_LinearColorValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("LinearColorValue"));
+		FLinearColor PropertyValue = LinearColorValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FColor Get_ColorValue(void* self)
+	{
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ColorValue"));
+		FColor PropertyValue;
+
+		Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));
+		return PropertyValue;
+	}
+
+	static void Set_ColorValue(void* self, FColor ColorValue)
+	{
+		KLAWR_CHECK_NOT_CONCURRENT(TEXT("UKlawrTestObject::Set_ColorValue"));
+		UObject* Obj = static_cast<UObject*>(self);
+		static UProperty* Property = FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ColorValue"));
+		FColor PropertyValue = ColorValue;
+		Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);
+	}
+
+	static FArrayHelper* Get_IntArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("IntArray")));
+		return new TArrayHelper<int32>(&self->IntArray, prop);
+	}
+
+	static FArrayHelper* Get_FloatArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("FloatArray")));
+		return new TArrayHelper<float>(&self->FloatArray, prop);
+	}
+
+	static FArrayHelper* Get_BoolArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("BoolArray")));
+		return new TArrayHelper<bool>(&self->BoolArray, prop);
+	}
+
+	static FArrayHelper* Get_StrArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("StrArray")));
+		return new TArrayHelper<FString>(&self->StrArray, prop);
+	}
+
+	static FArrayHelper* Get_NameArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("NameArray")));
+		return new TArrayHelper<FName>(&self->NameArray, prop);
+	}
+
+	static FArrayHelper* Get_ObjectArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("ObjectArray")));
+		return new TArrayHelper<AActor*>(&self->ObjectArray, prop);
+	}
+
+	static FArrayHelper* Get_VectorArray(UKlawrTestObject* self)
+	{
+		static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(UKlawrTestObject::StaticClass(), TEXT("VectorArray")));
+		return new TArrayHelper<FVector>(&self->VectorArray, prop);
+	}
+
+}
+;
+static void* KlawrTestObject_WrapperFunctions[] =
+{
+	KlawrTestObject::Get_IntValue,
+	KlawrTestObject::Set_IntValue,
+	KlawrTestObject::Get_FloatValue,
+	KlawrTestObject::Set_FloatValue,
+	KlawrTestObject::Get_bNativeBoolValue,
+	KlawrTestObject::Set_bNativeBoolValue,
+	KlawrTestObject::Get_bBitfieldBoolValue,
+	KlawrTestObject::Set_bBitfieldBoolValue,
+	KlawrTestObject::Get_StrValue,
+	KlawrTestObject::Set_StrValue,
+	KlawrTestObject::Get_NameValue,
+	KlawrTestObject::Set_NameValue,
+	KlawrTestObject::Get_ObjectValue,
+	KlawrTestObject::Set_ObjectValue,
+	KlawrTestObject::Get_ClassValue,
+	KlawrTestObject::Set_ClassValue,
+	KlawrTestObject::Get_SubclassOfValue,
+	KlawrTestObject::Set_SubclassOfValue,
+	KlawrTestObject::Get_AssetValue,
+	KlawrTestObject::Set_AssetValue,
+	KlawrTestObject::Get_Vector2DValue,
+	KlawrTestObject::Set_Vector2DValue,
+	KlawrTestObject::Get_VectorValue,
+	KlawrTestObject::Set_VectorValue,
+	KlawrTestObject::Get_Vector4Value,
+	KlawrTestObject::Set_Vector4Value,
+	KlawrTestObject::Get_QuatValue,
+	KlawrTestObject::Set_QuatValue,
+	KlawrTestObject::Get_TransformValue,
+	KlawrTestObject::Set_TransformValue,
+	KlawrTestObject::Get_LinearColorValue,
+	KlawrTestObject::Set_LinearColorValue,
+	KlawrTestObject::Get_ColorValue,
+	KlawrTestObject::Set_ColorValue,
+	KlawrTestObject::Get_IntArray,
+	KlawrTestObject::Get_FloatArray,
+	KlawrTestObject::Get_BoolArray,
+	KlawrTestObject::Get_StrArray,
+	KlawrTestObject::Get_NameArray,
+	KlawrTestObject::Get_ObjectArray,
+	KlawrTestObject::Get_VectorArray,
+}
+;
+}} // namespace Klawr::NativeGlue
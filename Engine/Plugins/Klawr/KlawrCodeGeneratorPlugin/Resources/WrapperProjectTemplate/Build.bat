@@ -13,12 +13,12 @@ call "%VsComnToolsPath%/../../VC/bin/x86_amd64/vcvarsx86_amd64.bat" >NUL
 goto ReadyToCompile
 
 :ReadyToCompile
-msbuild Klawr.UnrealEngine.csproj /t:Rebuild /p:Platform=AnyCPU /p:Configuration=Release /nologo
+msbuild Klawr.UnrealEngine.Wrappers.proj /m /p:Platform=AnyCPU /p:Configuration=Release /nologo
 if %ERRORLEVEL% == 0 goto Exit
 goto Error_BuildFailed
 
 :Error_BuildFailed
-echo ERROR: Failed to build Klawr.UnrealEngine.csproj
+echo ERROR: Failed to build the Klawr.UnrealEngine wrapper assemblies
 pause
 goto Exit
 
@@ -1,12 +1,16 @@
 ﻿using Klawr.ClrHost.Interfaces;
 using Klawr.ClrHost.Managed;
 using Klawr.ClrHost.Managed.SafeHandles;
+using System;
+using System.Runtime.InteropServices;
 
 namespace Klawr.UnrealEngine
 {
     public abstract class UKlawrScriptComponent : UActorComponent
     {
         private readonly long _instanceID;
+        // the native component stores its current tick LOD at this address
+        private readonly IntPtr _tickLodAddress;
 
         public long InstanceID
         {
@@ -17,6 +21,7 @@ namespace Klawr.UnrealEngine
             : base(nativeComponent)
         {
             _instanceID = instanceID;
+            _tickLodAddress = ScriptComponentUtils.GetTickLodAddress(nativeComponent);
         }
 
         public new static UClass StaticClass()
@@ -29,5 +34,76 @@ namespace Klawr.UnrealEngine
         
         public virtual void InitializeComponent() { }
         public virtual void TickComponent(float deltaTime) { }
+
+        /// <summary>
+        /// Set the number of seconds between calls to TickComponent(), overriding the interval
+        /// specified by TickSettingsAttribute.
+        /// </summary>
+        /// <param name="interval">Seconds between ticks, zero to tick every frame.</param>
+        /// <param name="stagger">true to delay the next tick by a fraction of the interval, so
+        /// that components that share the same interval don't all tick in the same frame.</param>
+        public void SetTickInterval(float interval, bool stagger = true)
+        {
+            ScriptComponentUtils.SetTickInterval(NativeObject, interval, stagger);
+        }
+
+        /// <summary>
+        /// Set the tick group TickComponent() is called in, overriding the group specified by
+        /// TickSettingsAttribute. This has no effect on components that tick concurrently.
+        /// </summary>
+        public void SetTickGroup(ScriptTickGroup tickGroup)
+        {
+            ScriptComponentUtils.SetTickGroup(NativeObject, tickGroup);
+        }
+
+        /// <summary>
+        /// Stop calling TickComponent() until Wake() is called.
+        /// </summary>
+        public void Sleep()
+        {
+            ScriptComponentUtils.Sleep(NativeObject);
+        }
+
+        /// <summary>
+        /// Resume calling TickComponent() after Sleep() was called, the delta time passed to the
+        /// next tick doesn't include the time spent sleeping.
+        /// </summary>
+        public void Wake()
+        {
+            ScriptComponentUtils.Wake(NativeObject);
+        }
+
+        /// <summary>
+        /// Check if the component was put to sleep.
+        /// </summary>
+        public bool IsSleeping
+        {
+            get { return ScriptComponentUtils.IsSleeping(NativeObject); }
+        }
+
+        /// <summary>
+        /// The rate the component currently ticks at, this is always TickLod.Full unless the 
+        /// component type is marked with TickLodAttribute. Reading this doesn't call into native
+        /// code.
+        /// </summary>
+        public TickLod TickLod
+        {
+            get { return (TickLod)Marshal.ReadInt32(_tickLodAddress); }
+        }
+
+        /// <summary>
+        /// Override to customize how the tick LOD of a component whose type is marked with 
+        /// TickLodAttribute is selected, this is called once per frame.
+        /// </summary>
+        /// <param name="viewDistance">Distance from the owner to the nearest player view.</param>
+        /// <param name="wasRecentlyRendered">true if the owner was recently rendered.</param>
+        /// <param name="defaultLod">The tick LOD selected based on the TickLodAttribute settings.</param>
+        /// <returns>The tick LOD to use until the next call.</returns>
+        protected virtual TickLod SelectTickLod(
+            float viewDistance, bool wasRecentlyRendered, TickLod defaultLod
+        )
+        {
+            return defaultLod;
+        }
     }
 }
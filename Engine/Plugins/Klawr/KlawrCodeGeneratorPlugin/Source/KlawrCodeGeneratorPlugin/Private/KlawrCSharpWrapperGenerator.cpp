@@ -25,10 +25,14 @@
 #include "KlawrCodeGeneratorPluginPrivatePCH.h"
 #include "KlawrCSharpWrapperGenerator.h"
 #include "KlawrCodeFormatter.h"
-#include "KlawrCodeGenerator.h"
+#include "KlawrExportedApi.h"
 
 namespace Klawr {
 
+// distinguishes the generated wrapper classes from the ones in the wrapper project template
+const FString FCSharpWrapperGenerator::GeneratedCodeAttribute =
+	TEXT("[System.CodeDom.Compiler.GeneratedCode(\"KlawrCodeGenerator\", \"1.0\")]");
+
 const FString FCSharpWrapperGenerator::UnmanagedFunctionPointerAttribute = 
 #ifdef UNICODE
 	TEXT("[UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]");
@@ -45,14 +49,14 @@ const FString FCSharpWrapperGenerator::MarshalBoolParameterAsUint8Attribute =
 const FString FCSharpWrapperGenerator::NativeThisPointer = TEXT("(UObjectHandle)this");
 
 FCSharpWrapperGenerator::FCSharpWrapperGenerator(
-	const UClass* Class, const UClass* InWrapperSuperClass, FCodeFormatter& CodeFormatter)
-	: WrapperSuperClass(InWrapperSuperClass)
+	const FExportedClass& Class, FCodeFormatter& CodeFormatter)
+	: WrapperSuperClassName(Class.WrapperSuperClassNativeName)
+	, FriendlyClassName(Class.Name)
+	, NativeClassName(Class.NativeName)
 	, GeneratedGlue(CodeFormatter)
+	, bShouldGenerateManagedWrapper(Class.bShouldGenerateManagedWrapper)
+	, bShouldGenerateScriptObjectClass(Class.bShouldGenerateScriptObjectClass)
 {
-	Class->GetName(FriendlyClassName);
-	NativeClassName = FString::Printf(TEXT("%s%s"), Class->GetPrefixCPP(), *FriendlyClassName);
-	bShouldGenerateManagedWrapper = ShouldGenerateManagedWrapper(Class);
-	bShouldGenerateScriptObjectClass = ShouldGenerateScriptObjectClass(Class);
 }
 
 const UClass* FCSharpWrapperGenerator::GetWrapperSuperClass(
@@ -78,11 +82,9 @@ void FCSharpWrapperGenerator::GenerateHeader()
 {
 	FString classDecl = FString::Printf(TEXT("public class %s"), *NativeClassName);
 		
-	if (WrapperSuperClass)
+	if (!WrapperSuperClassName.IsEmpty())
 	{
-		classDecl += FString::Printf(
-			TEXT(" : %s%s"), WrapperSuperClass->GetPrefixCPP(), *WrapperSuperClass->GetName()
-		);
+		classDecl += FString::Printf(TEXT(" : %s"), *WrapperSuperClassName);
 	}
 		
 	GeneratedGlue 
@@ -104,6 +106,7 @@ void FCSharpWrapperGenerator::GenerateHeader()
 	{ 
 		GeneratedGlue
 			// declare class
+			<< GeneratedCodeAttribute
 			<< classDecl 
 			<< FCodeFormatter::OpenBrace()
 
@@ -156,20 +159,21 @@ void FCSharpWrapperGenerator::GenerateFooter()
 	GeneratedGlue << FCodeFormatter::CloseBrace();
 }
 
-void FCSharpWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
+void FCSharpWrapperGenerator::GenerateFunctionWrapper(const FExportedFunction& Function)
 {
 	FString formalInteropArgs, actualInteropArgs, formalManagedArgs, actualManagedArgs;
-	UProperty* returnValue = GetWrapperArgsAndReturnType(
+	const FExportedProperty* returnValue = GetWrapperArgsAndReturnType(
 		Function, formalInteropArgs, actualInteropArgs, formalManagedArgs, actualManagedArgs
 	);
 	const bool bHasReturnValue = (returnValue != nullptr);
-	const bool bReturnsBool = (bHasReturnValue && returnValue->IsA(UBoolProperty::StaticClass()));
+	const bool bReturnsBool = 
+		(bHasReturnValue && (returnValue->Type.Kind == EExportedTypeKind::Bool));
 	const FString returnValueInteropTypeName = 
-		bHasReturnValue ? GetPropertyInteropType(returnValue) : TEXT("void");
+		bHasReturnValue ? GetReturnValueInteropType(returnValue->Type) : TEXT("void");
 	const FString returnValueManagedTypeName =
-		bHasReturnValue ? GetPropertyManagedType(returnValue) : TEXT("void");
-	const FString delegateTypeName = GetDelegateTypeName(Function->GetName(), bHasReturnValue);
-	const FString delegateName = GetDelegateName(Function->GetName());
+		bHasReturnValue ? GetPropertyManagedType(returnValue->Type) : TEXT("void");
+	const FString delegateTypeName = GetDelegateTypeName(Function.Name, bHasReturnValue);
+	const FString delegateName = GetDelegateName(Function.Name);
 
 	GeneratedGlue 
 		// declare a managed delegate type matching the type of the native wrapper function
@@ -188,7 +192,7 @@ void FCSharpWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
 		// declared above
 		<< FString::Printf(
 			TEXT("public %s %s(%s)"),
-			*returnValueManagedTypeName, *Function->GetName(), *formalManagedArgs
+			*returnValueManagedTypeName, *Function.Name, *formalManagedArgs
 		)
 		<< FCodeFormatter::OpenBrace();
 
@@ -197,29 +201,28 @@ void FCSharpWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
 	{
 		GeneratedGlue 
 			<< FString::Printf(TEXT("var value = %s(%s);"), *delegateName, *actualInteropArgs)
-			<< GetReturnValueHandler(returnValue);
+			<< GetReturnValueHandler(returnValue->Type);
 	}
 	else
 	{
-		GeneratedGlue << FString::Printf(TEXT("%s(%s);"), *delegateName, *actualInteropArgs);
+		GeneratedGlue.AppendLinef(TEXT("%s(%s);"), *delegateName, *actualInteropArgs);
 	}
 		
 	GeneratedGlue
 		<< FCodeFormatter::CloseBrace()
 		<< FCodeFormatter::LineTerminator();
 
-	FExportedFunction funcInfo;
+	FWrappedFunction funcInfo;
 	funcInfo.DelegateName = delegateName;
 	funcInfo.DelegateTypeName = delegateTypeName;
 	ExportedFunctions.Add(funcInfo);
 }
 
-void FCSharpWrapperGenerator::GeneratePropertyWrapper(const UProperty* prop)
+void FCSharpWrapperGenerator::GeneratePropertyWrapper(const FExportedProperty& prop)
 {
-	auto arrayProp = Cast<UArrayProperty>(prop);
-	if (arrayProp)
+	if (prop.Type.Kind == EExportedTypeKind::Array)
 	{
-		GenerateArrayPropertyWrapper(arrayProp);
+		GenerateArrayPropertyWrapper(prop);
 	}
 	else
 	{
@@ -227,21 +230,21 @@ void FCSharpWrapperGenerator::GeneratePropertyWrapper(const UProperty* prop)
 	}
 }
 
-void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const UProperty* Property)
+void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const FExportedProperty& Property)
 {
-	const FString getterName = FString::Printf(TEXT("Get_%s"), *Property->GetName());
-	const FString setterName = FString::Printf(TEXT("Set_%s"), *Property->GetName());
+	const FString getterName = FString::Printf(TEXT("Get_%s"), *Property.Name);
+	const FString setterName = FString::Printf(TEXT("Set_%s"), *Property.Name);
 	
-	FExportedProperty propertyInfo;
+	FWrappedProperty propertyInfo;
 	propertyInfo.GetterDelegateName = GetDelegateName(getterName);
 	propertyInfo.GetterDelegateTypeName = GetDelegateTypeName(getterName, true);
 	propertyInfo.SetterDelegateName = GetDelegateName(setterName);
 	propertyInfo.SetterDelegateTypeName = GetDelegateTypeName(setterName, false);
 	ExportedProperties.Add(propertyInfo);
 	
-	const bool bIsBoolProperty = Property->IsA<UBoolProperty>();
-	const FString interopTypeName = GetPropertyInteropType(Property);
-	const FString managedTypeName = GetPropertyManagedType(Property);
+	const bool bIsBoolProperty = (Property.Type.Kind == EExportedTypeKind::Bool);
+	const FString interopTypeName = GetPropertyInteropType(Property.Type);
+	const FString managedTypeName = GetPropertyManagedType(Property.Type);
 	FString setterParamType = interopTypeName;
 	if (bIsBoolProperty)
 	{
@@ -251,9 +254,9 @@ void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const UProperty* P
 	}
 	FString getterValue(TEXT("value"));
 	FString setterValue(TEXT("value"));
-	if (Property->IsA<UObjectProperty>())
+	if (Property.Type.IsObject())
 	{
-		if (Property->IsA<UClassProperty>())
+		if (Property.Type.Kind == EExportedTypeKind::Class)
 		{
 			getterValue = TEXT("(UClass)value");
 		}
@@ -270,13 +273,13 @@ void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const UProperty* P
 		<< (bIsBoolProperty ? MarshalReturnedBoolAsUint8Attribute : FString())
 		<< FString::Printf(
 			TEXT("private delegate %s %s(UObjectHandle self);"),
-			*interopTypeName, *propertyInfo.GetterDelegateTypeName
+			*GetReturnValueInteropType(Property.Type), *propertyInfo.GetterDelegateTypeName
 		)
 		// declare setter delegate type
 		<< UnmanagedFunctionPointerAttribute
 		<< FString::Printf(
 			TEXT("private delegate void %s(UObjectHandle self, %s %s);"),
-			*propertyInfo.SetterDelegateTypeName, *setterParamType, *Property->GetName()
+			*propertyInfo.SetterDelegateTypeName, *setterParamType, *Property.Name
 		)
 		// declare delegate instances that will be bound to the native wrapper functions
 		<< FString::Printf(
@@ -289,14 +292,14 @@ void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const UProperty* P
 		)
 		// define a property that calls the native wrapper functions through the delegates 
 		// declared above
-		<< FString::Printf(TEXT("public %s %s"), *managedTypeName, *Property->GetName())
+		<< FString::Printf(TEXT("public %s %s"), *managedTypeName, *Property.Name)
 		<< FCodeFormatter::OpenBrace()
 			<< TEXT("get")
 			<< FCodeFormatter::OpenBrace()
 				<< FString::Printf(TEXT("var value = %s(%s);"), 
 					*propertyInfo.GetterDelegateName, *NativeThisPointer
 				)
-				<< GetReturnValueHandler(Property)
+				<< GetReturnValueHandler(Property.Type)
 			<< FCodeFormatter::CloseBrace()
 			<< FString::Printf(
 				TEXT("set { %s(%s, %s); }"), 
@@ -306,20 +309,30 @@ void FCSharpWrapperGenerator::GenerateStandardPropertyWrapper(const UProperty* P
 		<< FCodeFormatter::LineTerminator();
 }
 
-void FCSharpWrapperGenerator::GenerateArrayPropertyWrapper(const UArrayProperty* arrayProp)
+void FCSharpWrapperGenerator::GenerateArrayPropertyWrapper(const FExportedProperty& arrayProp)
 {
-	const FString getterName = FString::Printf(TEXT("Get_%s"), *arrayProp->GetName());
+	const FString getterName = FString::Printf(TEXT("Get_%s"), *arrayProp.Name);
 	
-	FExportedProperty propertyInfo;
+	FWrappedProperty propertyInfo;
 	propertyInfo.GetterDelegateName = GetDelegateName(getterName);
 	propertyInfo.GetterDelegateTypeName = GetDelegateTypeName(getterName, true);
 	propertyInfo.SetterDelegateName.Empty();
 	propertyInfo.SetterDelegateTypeName.Empty();
 	ExportedProperties.Add(propertyInfo);
 	
-	const FString managedTypeName = GetPropertyManagedType(arrayProp->Inner);
-	const FString backingFieldName = FString::Printf(TEXT("_%s"), *arrayProp->GetName());
+	const FString managedTypeName = GetPropertyManagedType(arrayProp.ElementType);
+	const FString backingFieldName = FString::Printf(TEXT("_%s"), *arrayProp.Name);
 	const FString arrayPropertyWrapperTypeName = GetArrayPropertyWrapperType(arrayProp);
+	// int32, float and FVector arrays are exposed as ArrayList<T> rather than IList<T> so that
+	// the native bulk operations in ArrayListExtensions can be used without casting, the
+	// extensions don't support any other element types
+	const FExportedType& elementType = arrayProp.ElementType;
+	const bool bHasBulkOperations = (elementType.Kind == EExportedTypeKind::Int)
+		|| (elementType.Kind == EExportedTypeKind::Float)
+		|| (elementType.Kind == EExportedTypeKind::Struct);
+	const FString propertyTypeName = FString::Printf(
+		TEXT("%s<%s>"), bHasBulkOperations ? TEXT("ArrayList") : TEXT("IList"), *managedTypeName
+	);
 	
 	DisposableMembers.Add(backingFieldName);
 
@@ -340,7 +353,7 @@ void FCSharpWrapperGenerator::GenerateArrayPropertyWrapper(const UArrayProperty*
 		<< FCodeFormatter::LineTerminator()
 		// define a property that calls the native wrapper function through the delegate
 		// declared above
-		<< FString::Printf(TEXT("public IList<%s> %s"), *managedTypeName, *arrayProp->GetName())
+		<< FString::Printf(TEXT("public %s %s"), *propertyTypeName, *arrayProp.Name)
 		<< FCodeFormatter::OpenBrace()
 			<< TEXT("get")
 			<< FCodeFormatter::OpenBrace()
@@ -412,7 +425,7 @@ void FCSharpWrapperGenerator::GenerateManagedStaticConstructor()
 		return;
 	}
 
-	GeneratedGlue << FString::Printf(TEXT("static %s()"), *NativeClassName);
+	GeneratedGlue.AppendLinef(TEXT("static %s()"), *NativeClassName);
 	GeneratedGlue << FCodeFormatter::OpenBrace();
 	
 	// bind managed delegates to pointers to native wrapper functions
@@ -423,11 +436,11 @@ void FCSharpWrapperGenerator::GenerateManagedStaticConstructor()
 		);
 	
 	int32 functionIdx = 0;
-	for (const FExportedProperty& propInfo : ExportedProperties)
+	for (const FWrappedProperty& propInfo : ExportedProperties)
 	{
 		if (!propInfo.GetterDelegateName.IsEmpty())
 		{
-			GeneratedGlue << FString::Printf(
+			GeneratedGlue.AppendLinef(
 				TEXT("%s = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[%d], typeof(%s)) as %s;"),
 				*propInfo.GetterDelegateName, functionIdx, *propInfo.GetterDelegateTypeName,
 				*propInfo.GetterDelegateTypeName
@@ -436,7 +449,7 @@ void FCSharpWrapperGenerator::GenerateManagedStaticConstructor()
 		}
 		if (!propInfo.SetterDelegateName.IsEmpty())
 		{
-			GeneratedGlue << FString::Printf(
+			GeneratedGlue.AppendLinef(
 				TEXT("%s = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[%d], typeof(%s)) as %s;"),
 				*propInfo.SetterDelegateName, functionIdx, *propInfo.SetterDelegateTypeName,
 				*propInfo.SetterDelegateTypeName
@@ -445,10 +458,10 @@ void FCSharpWrapperGenerator::GenerateManagedStaticConstructor()
 		}
 	}
 		
-	for (const FExportedFunction& funcInfo : ExportedFunctions)
+	for (const FWrappedFunction& funcInfo : ExportedFunctions)
 	{
 		// FIXME: don't generate the delegate type and name again, get it from FExportedFunction
-		GeneratedGlue << FString::Printf(
+		GeneratedGlue.AppendLinef(
 			TEXT("%s = Marshal.GetDelegateForFunctionPointer(nativeFuncPtrs[%d], typeof(%s)) as %s;"),
 			*funcInfo.DelegateName,	functionIdx, *funcInfo.DelegateTypeName, 
 			*funcInfo.DelegateTypeName
@@ -468,6 +481,7 @@ void FCSharpWrapperGenerator::GenerateManagedScriptObjectClass()
 	// the user can then simply subclass this abstract class.
 
 	GeneratedGlue
+		<< GeneratedCodeAttribute
 		<< FString::Printf(
 			TEXT("public abstract class %sScriptObject : %s, IScriptObject"),
 			*NativeClassName, *NativeClassName
@@ -496,28 +510,27 @@ void FCSharpWrapperGenerator::GenerateManagedScriptObjectClass()
 		<< FCodeFormatter::CloseBrace();
 }
 
-UProperty* FCSharpWrapperGenerator::GetWrapperArgsAndReturnType(
-	const UFunction* Function, FString& OutFormalInteropArgs, FString& OutActualInteropArgs,
-	FString& OutFormalManagedArgs, FString& OutActualManagedArgs
+const FExportedProperty* FCSharpWrapperGenerator::GetWrapperArgsAndReturnType(
+	const FExportedFunction& Function, FString& OutFormalInteropArgs, 
+	FString& OutActualInteropArgs, FString& OutFormalManagedArgs, FString& OutActualManagedArgs
 )
 {
 	OutFormalInteropArgs = TEXT("UObjectHandle self");
 	OutActualInteropArgs = NativeThisPointer;
 	OutFormalManagedArgs.Empty();
 	OutActualManagedArgs.Empty();
-	UProperty* returnValue = nullptr;
+	const FExportedProperty* returnValue = nullptr;
 
-	for (TFieldIterator<UProperty> paramIt(Function); paramIt; ++paramIt)
+	for (const FExportedProperty& param : Function.Params)
 	{
-		UProperty* param = *paramIt;
-		if (param->GetPropertyFlags() & CPF_ReturnParm)
+		if (param.HasAnyPropertyFlags(CPF_ReturnParm))
 		{
-			returnValue = param;
+			returnValue = &param;
 		}
 		else
 		{
-			FString argName = param->GetName();
-			FString argInteropType = GetPropertyInteropType(param);
+			FString argName = param.Name;
+			FString argInteropType = GetPropertyInteropType(param.Type);
 			FString argAttrs = GetPropertyInteropTypeAttributes(param);
 			FString argMods = GetPropertyInteropTypeModifiers(param);
 			
@@ -543,7 +556,7 @@ UProperty* FCSharpWrapperGenerator::GetWrapperArgsAndReturnType(
 				OutActualInteropArgs += argMods;
 			}
 			OutActualInteropArgs += TEXT(" ");
-			if (param->IsA<UObjectProperty>())
+			if (param.Type.IsObject())
 			{
 				OutActualInteropArgs += TEXT("(UObjectHandle)");
 			}
@@ -557,7 +570,7 @@ UProperty* FCSharpWrapperGenerator::GetWrapperArgsAndReturnType(
 			{
 				OutFormalManagedArgs += argMods + TEXT(" ");
 			}
-			FString ArgManagedType = GetPropertyManagedType(param);
+			FString ArgManagedType = GetPropertyManagedType(param.Type);
 			OutFormalManagedArgs += FString::Printf(TEXT("%s %s"), *ArgManagedType, *argName);
 			
 			if (!OutActualManagedArgs.IsEmpty())
@@ -571,85 +584,81 @@ UProperty* FCSharpWrapperGenerator::GetWrapperArgsAndReturnType(
 	return returnValue;
 }
 
-FString FCSharpWrapperGenerator::GetReturnValueHandler(const UProperty* ReturnValue)
-{
-	if (ReturnValue)
-	{
-		if (ReturnValue->IsA<UClassProperty>())
-		{
-			return TEXT("return (UClass)value;");
-		}
-		else if (ReturnValue->IsA<UObjectProperty>())
-		{
-			FString wrapperTypeName = FCodeGenerator::GetPropertyCPPType(ReturnValue);
-			wrapperTypeName.RemoveFromEnd(TEXT("*"));
-			return FString::Printf(
-				TEXT("return new %s(value);"), *wrapperTypeName
-			);
-		}
-		else
-		{
-			return TEXT("return value;");
-		}
-	}
-	return FString();
-}
-
-FString FCSharpWrapperGenerator::GetPropertyInteropType(const UProperty* Property)
+FString FCSharpWrapperGenerator::GetReturnValueHandler(const FExportedType& ReturnValueType)
 {
-	if (Property->IsA<UObjectProperty>())
-	{
-		return TEXT("UObjectHandle");
-	}
-	else if (Property->IsA<UObjectPropertyBase>())
-	{
-		return TEXT("IntPtr");
-	}
-	else if (Property->IsA<UBoolProperty>())
-	{
-		return TEXT("bool");
-	}
-	else if (Property->IsA<UIntProperty>())
+	if (ReturnValueType.Kind == EExportedTypeKind::Class)
 	{
-		return TEXT("int");
+		return TEXT("return (UClass)value;");
 	}
-	else if (Property->IsA<UFloatProperty>())
+	else if (ReturnValueType.IsObject())
 	{
-		return TEXT("float");
+		FString wrapperTypeName = ReturnValueType.CPPType;
+		wrapperTypeName.RemoveFromEnd(TEXT("*"));
+		return FString::Printf(
+			TEXT("return new %s(value);"), *wrapperTypeName
+		);
 	}
-	else if (Property->IsA<UDoubleProperty>())
+	else if (ReturnValueType.Kind == EExportedTypeKind::Str)
 	{
-		return TEXT("double");
+		return TEXT("return value.ToString();");
 	}
-	else if (Property->IsA<UStrProperty>())
+	else
 	{
-		return TEXT("string");
+		return TEXT("return value;");
 	}
-	else if (Property->IsA<UNameProperty>())
+}
+
+FString FCSharpWrapperGenerator::GetReturnValueInteropType(const FExportedType& ReturnValueType)
+{
+	// native wrapper functions return strings as a pointer and length pair
+	if (ReturnValueType.Kind == EExportedTypeKind::Str)
 	{
-		return TEXT("FScriptName");
+		return TEXT("StringRef");
 	}
-	else
-	{
-		return FCodeGenerator::GetPropertyCPPType(Property);
+	return GetPropertyInteropType(ReturnValueType);
+}
+
+FString FCSharpWrapperGenerator::GetPropertyInteropType(const FExportedType& PropertyType)
+{
+	switch (PropertyType.Kind)
+	{
+		case EExportedTypeKind::Object:
+		case EExportedTypeKind::Class:
+			return TEXT("UObjectHandle");
+		case EExportedTypeKind::OtherObject:
+			return TEXT("IntPtr");
+		case EExportedTypeKind::Bool:
+			return TEXT("bool");
+		case EExportedTypeKind::Int:
+			return TEXT("int");
+		case EExportedTypeKind::Float:
+			return TEXT("float");
+		case EExportedTypeKind::Double:
+			return TEXT("double");
+		case EExportedTypeKind::Str:
+			return TEXT("string");
+		case EExportedTypeKind::Name:
+			return TEXT("FScriptName");
+		default:
+			return PropertyType.CPPType;
 	}
 }
 
-FString FCSharpWrapperGenerator::GetPropertyManagedType(const UProperty* Property)
+FString FCSharpWrapperGenerator::GetPropertyManagedType(const FExportedType& PropertyType)
 {
-	if (Property->IsA<UObjectProperty>())
+	if (PropertyType.IsObject())
 	{
-		static FString pointer(TEXT("*"));
-		FString typeName = FCodeGenerator::GetPropertyCPPType(Property);
+		const FString pointer(TEXT("*"));
+		FString typeName = PropertyType.CPPType;
 		typeName.RemoveFromEnd(pointer);
 		return typeName;
 	}
-	return GetPropertyInteropType(Property);
+	return GetPropertyInteropType(PropertyType);
 }
 
-FString FCSharpWrapperGenerator::GetPropertyInteropTypeAttributes(const UProperty* Property)
+FString FCSharpWrapperGenerator::GetPropertyInteropTypeAttributes(const FExportedProperty& Property)
 {
-	if (Property->IsA<UBoolProperty>())
+	if (Property.Type.Kind == EExportedTypeKind::Bool)
 	{
 		// by default C# bool gets marshaled to unmanaged BOOL (4-bytes),
 		// marshal it to uint8 instead (which is the size of an MSVC bool)
@@ -677,17 +686,17 @@ FString FCSharpWrapperGenerator::GetPropertyInteropTypeAttributes(const UPropert
 	return FString();
 }
 
-FString FCSharpWrapperGenerator::GetPropertyInteropTypeModifiers(const UProperty* Property)
+FString FCSharpWrapperGenerator::GetPropertyInteropTypeModifiers(const FExportedProperty& Property)
 {
-	if (!Property->IsA<UObjectPropertyBase>())
+	if (!Property.Type.IsAnyObject())
 	{
-		if (!Property->HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm))
+		if (!Property.HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm))
 		{
-			if (Property->HasAnyPropertyFlags(CPF_ReferenceParm))
+			if (Property.HasAnyPropertyFlags(CPF_ReferenceParm))
 			{
 				return TEXT("ref");
 			}
-			else if (Property->HasAnyPropertyFlags(CPF_OutParm))
+			else if (Property.HasAnyPropertyFlags(CPF_OutParm))
 			{
 				return TEXT("out");
 			}
@@ -715,30 +724,44 @@ FString FCSharpWrapperGenerator::GetDelegateName(const FString& FunctionName)
 	return FString(TEXT("_")) + FunctionName;
 }
 
-FString FCSharpWrapperGenerator::GetArrayPropertyWrapperType(const UArrayProperty* arrayProperty)
+FString FCSharpWrapperGenerator::GetArrayPropertyWrapperType(const FExportedProperty& arrayProperty)
 {
-	const UProperty* elementProperty = arrayProperty->Inner;
-	if (elementProperty->IsA<UStrProperty>())
+	const FExportedType& elementType = arrayProperty.ElementType;
+	if (elementType.Kind == EExportedTypeKind::Str)
 	{
 		return TEXT("StringArrayProperty");
 	}
-	else if (elementProperty->IsA<UNameProperty>())
+	else if (elementType.Kind == EExportedTypeKind::Name)
 	{
 		return TEXT("NameArrayProperty");
 	}
-	else if (elementProperty->IsA<UObjectProperty>())
+	else if (elementType.IsObject())
 	{
 		return FString::Printf(
-			TEXT("ObjectArrayProperty<%s>"), *GetPropertyManagedType(elementProperty)
+			TEXT("ObjectArrayProperty<%s>"), *GetPropertyManagedType(elementType)
 		);
 	}
-	else if (elementProperty->IsA<UBoolProperty>())
+	else if (elementType.Kind == EExportedTypeKind::Bool)
 	{
 		return TEXT("BoolArrayProperty");
 	}
+	else if (elementType.Kind == EExportedTypeKind::Int)
+	{
+		return TEXT("Int32ArrayProperty");
+	}
+	else if (elementType.Kind == EExportedTypeKind::Float)
+	{
+		return TEXT("FloatArrayProperty");
+	}
+	else if (elementType.Kind == EExportedTypeKind::Struct)
+	{
+		// only TArray<FVector> is currently supported (see FCodeGenerator::IsPropertyTypeSupported)
+		check(elementType.StructName == TEXT("Vector"));
+		return TEXT("VectorArrayProperty");
+	}
 	else
 	{
-		return FString::Printf(TEXT("%sArrayProperty"), *elementProperty->GetCPPType());
+		return FString::Printf(TEXT("%sArrayProperty"), *elementType.CPPType);
 	}
 }
 
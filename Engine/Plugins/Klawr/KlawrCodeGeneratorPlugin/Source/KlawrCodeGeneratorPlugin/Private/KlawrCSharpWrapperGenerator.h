@@ -25,17 +25,20 @@
 
 namespace Klawr {
 
+struct FExportedClass;
+struct FExportedFunction;
+struct FExportedProperty;
+struct FExportedType;
+
 /** Generates a C# wrapper class for a UObject-derived class. */
 class FCSharpWrapperGenerator
 {
 public:
-	FCSharpWrapperGenerator(
-		const UClass* Class, const UClass* InWrapperSuperClass, class FCodeFormatter& CodeFormatter
-	);
+	FCSharpWrapperGenerator(const FExportedClass& Class, class FCodeFormatter& CodeFormatter);
 
 	void GenerateHeader();
-	void GenerateFunctionWrapper(const UFunction* Function);
-	void GeneratePropertyWrapper(const UProperty* Property);
+	void GenerateFunctionWrapper(const FExportedFunction& Function);
+	void GeneratePropertyWrapper(const FExportedProperty& Property);
 	void GenerateFooter();
 
 	/** Get number of properties wrapped. */
@@ -46,9 +49,11 @@ public:
 	static const UClass* GetWrapperSuperClass(
 		const UClass* Class, const TArray<const UClass*>& ExportedClasses
 	);
+	static bool ShouldGenerateManagedWrapper(const UClass* Class);
+	static bool ShouldGenerateScriptObjectClass(const UClass* Class);
 
 private:
-	struct FExportedProperty
+	struct FWrappedProperty
 	{
 		FString GetterDelegateName;
 		FString GetterDelegateTypeName;
@@ -56,45 +61,46 @@ private:
 		FString SetterDelegateTypeName;
 	};
 
-	struct FExportedFunction
+	struct FWrappedFunction
 	{
 		FString DelegateName;
 		FString DelegateTypeName;
 	};
 
 private:
-	void GenerateStandardPropertyWrapper(const UProperty* Property);
-	void GenerateArrayPropertyWrapper(const UArrayProperty* Property);
-	static bool ShouldGenerateManagedWrapper(const UClass* Class);
-	static bool ShouldGenerateScriptObjectClass(const UClass* Class);
+	void GenerateStandardPropertyWrapper(const FExportedProperty& Property);
+	void GenerateArrayPropertyWrapper(const FExportedProperty& Property);
 	void GenerateDisposeMethod();
 	void GenerateManagedStaticConstructor();
 	void GenerateManagedScriptObjectClass();
-	static UProperty* GetWrapperArgsAndReturnType(
-		const UFunction* Function, FString& OutFormalInteropArgs, FString& OutActualInteropArgs,
-		FString& OutFormalManagedArgs, FString& OutActualManagedArgs
+	static const FExportedProperty* GetWrapperArgsAndReturnType(
+		const FExportedFunction& Function, FString& OutFormalInteropArgs, 
+		FString& OutActualInteropArgs, FString& OutFormalManagedArgs, 
+		FString& OutActualManagedArgs
 	);
-	static FString GetReturnValueHandler(const UProperty* ReturnValue);
-	static FString GetPropertyInteropType(const UProperty* Property);
-	static FString GetPropertyManagedType(const UProperty* Property);
-	static FString GetPropertyInteropTypeAttributes(const UProperty* Property);
-	static FString GetPropertyInteropTypeModifiers(const UProperty* Property);
+	static FString GetReturnValueHandler(const FExportedType& ReturnValueType);
+	static FString GetReturnValueInteropType(const FExportedType& ReturnValueType);
+	static FString GetPropertyInteropType(const FExportedType& PropertyType);
+	static FString GetPropertyManagedType(const FExportedType& PropertyType);
+	static FString GetPropertyInteropTypeAttributes(const FExportedProperty& Property);
+	static FString GetPropertyInteropTypeModifiers(const FExportedProperty& Property);
 	static FString GetDelegateTypeName(const FString& FunctionName, bool bHasReturnValue);
 	static FString GetDelegateName(const FString& FunctionName);
-	static FString GetArrayPropertyWrapperType(const UArrayProperty* ArrayProperty);
+	static FString GetArrayPropertyWrapperType(const FExportedProperty& ArrayProperty);
 
 private:
-	const UClass* WrapperSuperClass;
+	FString WrapperSuperClassName;
 	FString FriendlyClassName;
 	FString NativeClassName;
 	class FCodeFormatter& GeneratedGlue;
 	bool bShouldGenerateManagedWrapper;
 	bool bShouldGenerateScriptObjectClass;
-	TArray<FExportedFunction> ExportedFunctions;
-	TArray<FExportedProperty> ExportedProperties;
+	TArray<FWrappedFunction> ExportedFunctions;
+	TArray<FWrappedProperty> ExportedProperties;
 	// names of members of the generated C# class that need to be disposed
 	TArray<FString>DisposableMembers;
 
+	static const FString GeneratedCodeAttribute;
 	static const FString UnmanagedFunctionPointerAttribute;
 	static const FString MarshalReturnedBoolAsUint8Attribute;
 	static const FString MarshalBoolParameterAsUint8Attribute;
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrCodeGeneratorPluginPrivatePCH.h"
+#include "KlawrCodeFormatter.h"
+
+namespace Klawr {
+
+FCodeFormatter::FCodeFormatter(TCHAR InSpace, int32 InTabSize)
+	: Length(0)
+	, IndentLevel(0)
+	, Space(InSpace)
+	, TabSize(InTabSize)
+{
+}
+
+FCodeFormatter& FCodeFormatter::AppendLinef(const TCHAR* Format, ...)
+{
+	// most lines fit in the stack buffer, longer ones are formatted into an ever larger heap buffer
+	TCHAR stackBuffer[512];
+	TArray<TCHAR> heapBuffer;
+	TCHAR* buffer = stackBuffer;
+	int32 bufferSize = ARRAY_COUNT(stackBuffer);
+	int32 textLength;
+	for (;;)
+	{
+		const TCHAR* format = Format;
+		va_list argPtr;
+		va_start(argPtr, Format);
+		textLength = FCString::GetVarArgs(buffer, bufferSize, bufferSize - 1, format, argPtr);
+		va_end(argPtr);
+		if (textLength >= 0)
+		{
+			break;
+		}
+		heapBuffer.SetNumUninitialized(bufferSize * 2);
+		buffer = heapBuffer.GetData();
+		bufferSize = heapBuffer.Num();
+	}
+
+	if (textLength > 0)
+	{
+		AppendLine(buffer, textLength);
+	}
+	return *this;
+}
+
+SIZE_T FCodeFormatter::GetAllocatedSize() const
+{
+	SIZE_T allocatedSize = Chunks.GetAllocatedSize() + IndentCache.GetAllocatedSize();
+	for (const TArray<TCHAR>& chunk : Chunks)
+	{
+		allocatedSize += chunk.GetAllocatedSize();
+	}
+	return allocatedSize;
+}
+
+bool FCodeFormatter::IsPureAscii() const
+{
+	for (const TArray<TCHAR>& chunk : Chunks)
+	{
+		for (TCHAR c : chunk)
+		{
+			if (c > 0x7f)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+FString FCodeFormatter::ToString() const
+{
+	FString result;
+	result.Reserve(Length);
+	for (const TArray<TCHAR>& chunk : Chunks)
+	{
+		result.AppendChars(chunk.GetData(), chunk.Num());
+	}
+	return result;
+}
+
+void FCodeFormatter::AppendIndent()
+{
+	const int32 indentLength = IndentLevel * TabSize;
+	if (indentLength > IndentCache.Len())
+	{
+		IndentCache = FString::ChrN(indentLength, Space);
+	}
+	Append(*IndentCache, indentLength);
+}
+
+void FCodeFormatter::Append(const TCHAR* Text, int32 TextLength)
+{
+	Length += TextLength;
+	while (TextLength > 0)
+	{
+		if ((Chunks.Num() == 0) || (Chunks.Last().Num() == Chunks.Last().Max()))
+		{
+			// most classes only need a few KB of wrappers, so start small and double the size 
+			// of each new chunk, a handful of chunks are enough to hold the wrappers of even the
+			// largest classes
+			const int32 chunkSize = (Chunks.Num() == 0) 
+				? MinChunkSize : FMath::Min(Chunks.Last().Max() * 2, MaxChunkSize);
+			Chunks.AddDefaulted();
+			Chunks.Last().Reserve(chunkSize);
+		}
+		// text that doesn't fit in the current chunk spills over into the next one
+		TArray<TCHAR>& chunk = Chunks.Last();
+		const int32 copyLength = FMath::Min(TextLength, chunk.Max() - chunk.Num());
+		chunk.Append(Text, copyLength);
+		Text += copyLength;
+		TextLength -= copyLength;
+	}
+}
+
+} // namespace Klawr
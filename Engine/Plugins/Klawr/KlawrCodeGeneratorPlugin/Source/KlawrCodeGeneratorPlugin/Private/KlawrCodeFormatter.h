@@ -25,61 +25,23 @@
 
 namespace Klawr {
 
-/** Automatically indents and terminates lines of code. */
+/** 
+ * Automatically indents and terminates lines of code.
+ *
+ * The formatted code is accumulated in chunks that are never reallocated, so appending a line 
+ * never copies any of the previously formatted code, and lines are copied (or formatted) straight
+ * into the current chunk without creating any temporary strings along the way. The chunks start 
+ * small and grow geometrically, so a formatter only holds on to a little more memory than the code
+ * it contains. Once the code is complete it can be streamed out chunk by chunk with ForEachChunk().
+ */
 class FCodeFormatter
 {
 public:
-	/** Keeps track of the indentation level in generated code. */
-	class FIndent
-	{
-	public:
-		/** String that should be prefixed to a line of text to ensure it is indented properly. */
-		FString Text;
-
-		FIndent(TCHAR InSpace, int32 InTabSize)
-			: Level(0)
-			, Space(InSpace)
-			, TabSize(InTabSize)
-		{
-		}
-
-		/** Increment the indent by one level. */
-		FIndent& operator++() // prefix increment
-		{
-			++Level;
-			Text = FString::ChrN(Level * TabSize, Space);
-			return *this;
-		}
-
-		/** Decrement the indent by one level. */
-		FIndent& operator--() // prefix decrement
-		{
-			check(Level > 0);
-			--Level;
-			Text = FString::ChrN(Level * TabSize, Space);
-			return *this;
-		}
-	private:
-		int32 Level;
-		// character used for indentation
-		TCHAR Space;
-		// number of characters that make up a single tab
-		int32 TabSize;
-	};
-
 	struct OpenBrace {};
 	struct CloseBrace {};
 	struct LineTerminator {};
 
-	/** Current indent. */
-	FIndent Indent;
-	/** The formatted code. */
-	FString Content;
-
-	FCodeFormatter(TCHAR InSpace, int32 InTabSize)
-		: Indent(InSpace, InTabSize)
-	{
-	}
+	FCodeFormatter(TCHAR InSpace, int32 InTabSize);
 
 	/** 
 	 * Append the given line of code.
@@ -89,7 +51,7 @@ public:
 	{
 		if (!Text.IsEmpty())
 		{
-			Content += Indent.Text + Text + LINE_TERMINATOR;
+			AppendLine(*Text, Text.Len());
 		}
 		return *this;
 	}
@@ -100,7 +62,7 @@ public:
 	 */
 	FCodeFormatter& operator<<(const TCHAR* Text)
 	{
-		Content += Indent.Text + Text + LINE_TERMINATOR;
+		AppendLine(Text, FCString::Strlen(Text));
 		return *this;
 	}
 
@@ -111,8 +73,8 @@ public:
 	 */
 	FCodeFormatter& operator<<(const OpenBrace&)
 	{
-		Content += Indent.Text + TEXT("{") LINE_TERMINATOR;
-		++Indent;
+		AppendLine(TEXT("{"), 1);
+		++IndentLevel;
 		return *this;
 	}
 
@@ -123,17 +85,79 @@ public:
 	 */
 	FCodeFormatter& operator<<(const CloseBrace&)
 	{
-		--Indent;
-		Content += Indent.Text + TEXT("}") LINE_TERMINATOR;
+		check(IndentLevel > 0);
+		--IndentLevel;
+		AppendLine(TEXT("}"), 1);
 		return *this;
 	}
 
 	/** Append a line terminator. */
 	FCodeFormatter& operator<<(const LineTerminator&)
 	{
-		Content += LINE_TERMINATOR;
+		Append(LINE_TERMINATOR, LineTerminatorLength);
 		return *this;
 	}
+
+	/** 
+	 * Format and append the given line of code (unless it's empty), this is equivalent to 
+	 * *this << FString::Printf(Format, ...) but the line is formatted directly into the buffer.
+	 */
+	FCodeFormatter& AppendLinef(const TCHAR* Format, ...);
+
+	/** Get the number of characters formatted so far. */
+	int32 Len() const { return Length; }
+
+	/** Get the number of bytes allocated to hold the code formatted so far. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Check if all the characters formatted so far are 7-bit ASCII. */
+	bool IsPureAscii() const;
+
+	/** 
+	 * Call the given function with each chunk of formatted code in order, the function should 
+	 * have the signature void(const TCHAR* Text, int32 TextLength).
+	 */
+	template<typename FunctionType>
+	void ForEachChunk(FunctionType Function) const
+	{
+		for (const TArray<TCHAR>& chunk : Chunks)
+		{
+			Function(chunk.GetData(), chunk.Num());
+		}
+	}
+
+	/** Concatenate all the formatted code into a single string. */
+	FString ToString() const;
+
+private:
+	/** Number of characters in the first chunk, each subsequent chunk is twice the size. */
+	static const int32 MinChunkSize = 1024;
+	/** Maximum number of characters in a chunk. */
+	static const int32 MaxChunkSize = 64 * 1024;
+	static const int32 LineTerminatorLength = ARRAY_COUNT(LINE_TERMINATOR) - 1;
+
+	/** Append an indented and terminated line of code. */
+	void AppendLine(const TCHAR* Text, int32 TextLength)
+	{
+		AppendIndent();
+		Append(Text, TextLength);
+		Append(LINE_TERMINATOR, LineTerminatorLength);
+	}
+
+	void AppendIndent();
+	void Append(const TCHAR* Text, int32 TextLength);
+
+private:
+	TArray<TArray<TCHAR>> Chunks;
+	int32 Length;
+	int32 IndentLevel;
+	// character used for indentation
+	TCHAR Space;
+	// number of characters that make up a single tab
+	int32 TabSize;
+	// The text needed to indent to the deepest level reached so far, any shallower indent is just
+	// a prefix of this text.
+	FString IndentCache;
 };
 
-} // namespace
+} // namespace Klawr
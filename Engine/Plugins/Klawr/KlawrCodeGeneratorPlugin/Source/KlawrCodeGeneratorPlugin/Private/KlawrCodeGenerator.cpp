@@ -28,6 +28,7 @@
 #include "pugixml.hpp"
 #include "KlawrNativeWrapperGenerator.h"
 #include "KlawrCSharpWrapperGenerator.h"
+#include "ParallelFor.h"
 
 namespace Klawr {
 
@@ -41,6 +42,13 @@ const FName FCodeGenerator::Name_LinearColor("LinearColor");
 const FName FCodeGenerator::Name_Color("Color");
 
 const FString FCodeGenerator::ClrHostManagedAssemblyName = TEXT("Klawr.ClrHost.Managed");
+const FString FCodeGenerator::WrapperAssemblyName = TEXT("Klawr.UnrealEngine");
+
+// must match NativeGlue::ShardCount in KlawrRuntimePlugin/Private/KlawrNativeGlue.h
+const int32 FCodeGenerator::NativeGlueShardCount = 8;
+
+// the manifest stores the signature of the wrapper project template under this name
+static const TCHAR* const WrapperProjectTemplateEntryName = TEXT("@WrapperProjectTemplate");
 
 FCodeGenerator::FCodeGenerator(
 	const FString& InRootLocalPath, const FString& InRootBuildPath, 
@@ -50,18 +58,58 @@ FCodeGenerator::FCodeGenerator(
 	, RootLocalPath(InRootLocalPath)
 	, RootBuildPath(InRootBuildPath)
 	, IncludeBase(InIncludeBase)
+	, bWrappersChanged(false)
 {
-	 
+	GeneratorSignature = GetGeneratorSignature();
+	LoadManifest();
+
+	GConfig->GetString(
+		TEXT("Plugins"), TEXT("KlawrWrapperUsageFile"), WrapperUsageFilename, GEngineIni
+	);
+	if (!WrapperUsageFilename.IsEmpty())
+	{
+		TArray<FString> lines;
+		if (!FFileHelper::LoadANSITextFileToStrings(*WrapperUsageFilename, nullptr, lines))
+		{
+			FError::Throwf(TEXT("Failed to load wrapper usage from '%s'"), *WrapperUsageFilename);
+		}
+		for (FString& line : lines)
+		{
+			line.Trim();
+			line.TrimTrailing();
+			if (!line.IsEmpty())
+			{
+				WrapperUsage.Add(line);
+			}
+		}
+		UE_LOG(
+			LogKlawrCodeGenerator, Log, TEXT("Trimming wrappers to the %d names listed in '%s'"),
+			WrapperUsage.Num(), *WrapperUsageFilename
+		);
+		// Get rid of the manifest before any trimmed wrappers are written out, so the next run 
+		// without a usage file regenerates the wrappers of every class even if this run fails.
+		IFileManager::Get().Delete(*GetManifestFilename());
+		PreviousExportSignatures.Empty();
+	}
+
+	bool bBenchmark = false;
+	GConfig->GetBool(TEXT("Plugins"), TEXT("KlawrBenchmarkCodeGenerator"), bBenchmark, GEngineIni);
+	if (bBenchmark)
+	{
+		BenchmarkWrapperGeneration();
+	}
 }
 
 FString FCodeGenerator::GetPropertyCPPType(const UProperty* Property)
 {
-	static const FString enumDecl(TEXT("enum "));
-	static const FString structDecl(TEXT("struct "));
-	static const FString classDecl(TEXT("class "));
-	static const FString enumAsByteDecl(TEXT("TEnumAsByte<enum "));
-	static const FString subclassOfDecl(TEXT("TSubclassOf<class "));
-	static const FString space(TEXT(" "));
+	// NOTE: these mustn't be function statics, this may be called on multiple threads at once
+	//       and function statics aren't initialized in a thread-safe manner by VS2013
+	const FString enumDecl(TEXT("enum "));
+	const FString structDecl(TEXT("struct "));
+	const FString classDecl(TEXT("class "));
+	const FString enumAsByteDecl(TEXT("TEnumAsByte<enum "));
+	const FString subclassOfDecl(TEXT("TSubclassOf<class "));
+	const FString space(TEXT(" "));
 
 	FString cppTypeName = Property->GetCPPType(NULL, CPPF_ArgumentOrReturnValue);
 	
@@ -186,6 +234,12 @@ bool FCodeGenerator::IsPropertyTypeSupported(const UProperty* Property)
 			// TArray<TSubclassOf<UWhatever>> is not currently supported
 			bSupported = false;
 		}
+		else if (arrayProp->Inner->IsA<UStructProperty>() && 
+			(CastChecked<UStructProperty>(arrayProp->Inner)->Struct->GetFName() != Name_Vector))
+		{
+			// TArray<FVector> is the only array of structs that has a managed wrapper
+			bSupported = false;
+		}
 		else
 		{
 			bSupported = IsPropertyTypeSupported(arrayProp->Inner);
@@ -272,6 +326,153 @@ bool FCodeGenerator::CanExportProperty(const UClass* Class, const UProperty* Pro
 	return IsPropertyTypeSupported(Property);
 }
 
+FExportedClass FCodeGenerator::GetExportedClass(
+	const UClass* Class, const UClass* WrapperSuperClass, bool bCanExport, 
+	const FString& SourceHeaderFilename
+)
+{
+	FExportedClass exportedClass;
+	Class->GetName(exportedClass.Name);
+	exportedClass.NativeName = 
+		FString::Printf(TEXT("%s%s"), Class->GetPrefixCPP(), *exportedClass.Name);
+	if (WrapperSuperClass)
+	{
+		exportedClass.WrapperSuperClassNativeName = FString::Printf(
+			TEXT("%s%s"), WrapperSuperClass->GetPrefixCPP(), *WrapperSuperClass->GetName()
+		);
+	}
+	exportedClass.SourceHeaderFilename = SourceHeaderFilename;
+	// the outermost package of a native class is named after its module, e.g. "/Script/Engine"
+	exportedClass.ModuleName = FPackageName::GetShortName(Class->GetOutermost()->GetName());
+	exportedClass.bCanExport = bCanExport;
+	exportedClass.bShouldGenerateManagedWrapper = 
+		FCSharpWrapperGenerator::ShouldGenerateManagedWrapper(Class);
+	exportedClass.bShouldGenerateScriptObjectClass = 
+		FCSharpWrapperGenerator::ShouldGenerateScriptObjectClass(Class);
+
+	if (!bCanExport)
+	{
+		return exportedClass;
+	}
+
+	// The inheritance hierarchy is mirrored in the C# wrapper classes, so there's no need to
+	// redefine functions or properties from a base class (assuming that base class has also been 
+	// exported), CanExportFunction() and CanExportProperty() take care of skipping those.
+	// However, this also means that functions that are defined in UObject (which isn't exported)
+	// are not available in the C# wrapper classes, but that's not a problem for now.
+	TFieldIterator<UFunction> funcIt(Class, EFieldIteratorFlags::ExcludeSuper);
+	for ( ; funcIt; ++funcIt)
+	{
+		const UFunction* function = *funcIt;
+		if (CanExportFunction(Class, function))
+		{
+			FExportedFunction exportedFunction;
+			exportedFunction.Name = function->GetName();
+			exportedFunction.FunctionFlags = function->FunctionFlags;
+			exportedFunction.ParmsSize = function->ParmsSize;
+			for (TFieldIterator<UProperty> paramIt(function); paramIt; ++paramIt)
+			{
+				exportedFunction.Params.Add(GetExportedProperty(*paramIt));
+			}
+			exportedClass.Functions.Add(exportedFunction);
+		}
+	}
+
+	TFieldIterator<UProperty> propertyIt(Class, EFieldIteratorFlags::ExcludeSuper);
+	for ( ; propertyIt; ++propertyIt)
+	{
+		const UProperty* property = *propertyIt;
+		if (CanExportProperty(Class, property))
+		{
+			UE_LOG(
+				LogKlawrCodeGenerator, Log, 
+				TEXT("  %s %s"), *property->GetClass()->GetName(), *property->GetName()
+			);
+			exportedClass.Properties.Add(GetExportedProperty(property));
+		}
+	}
+
+	return exportedClass;
+}
+
+FExportedProperty FCodeGenerator::GetExportedProperty(const UProperty* Property)
+{
+	FExportedProperty exportedProperty;
+	exportedProperty.Name = Property->GetName();
+	exportedProperty.Type = GetExportedType(Property);
+	if (auto arrayProperty = Cast<UArrayProperty>(Property))
+	{
+		exportedProperty.ElementType = GetExportedType(arrayProperty->Inner);
+	}
+	exportedProperty.PropertyFlags = static_cast<uint64>(Property->GetPropertyFlags());
+	exportedProperty.Offset = Property->GetOffset_ForInternal();
+	exportedProperty.Size = Property->GetSize();
+	return exportedProperty;
+}
+
+FExportedType FCodeGenerator::GetExportedType(const UProperty* Property)
+{
+	FExportedType exportedType;
+	exportedType.CPPType = GetPropertyCPPType(Property);
+	exportedType.PropertyClassName = Property->GetClass()->GetName();
+
+	// UClassProperty is derived from UObjectProperty, which is derived from UObjectPropertyBase, 
+	// so the order of these checks matters
+	if (Property->IsA<UClassProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Class;
+	}
+	else if (Property->IsA<UObjectProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Object;
+	}
+	else if (Property->IsA<UObjectPropertyBase>())
+	{
+		exportedType.Kind = EExportedTypeKind::OtherObject;
+	}
+	else if (Property->IsA<UBoolProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Bool;
+		exportedType.bIsNativeBool = CastChecked<UBoolProperty>(Property)->IsNativeBool();
+	}
+	else if (Property->IsA<UIntProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Int;
+	}
+	else if (Property->IsA<UFloatProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Float;
+	}
+	else if (Property->IsA<UDoubleProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Double;
+	}
+	else if (Property->IsA<UStrProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Str;
+	}
+	else if (Property->IsA<UNameProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Name;
+	}
+	else if (Property->IsA<UStructProperty>())
+	{
+		auto structProperty = CastChecked<UStructProperty>(Property);
+		exportedType.Kind = EExportedTypeKind::Struct;
+		exportedType.StructName = structProperty->Struct->GetName();
+		exportedType.bIsInteropStruct = IsStructPropertyTypeSupported(structProperty);
+	}
+	else if (Property->IsA<UArrayProperty>())
+	{
+		exportedType.Kind = EExportedTypeKind::Array;
+	}
+	else
+	{
+		exportedType.Kind = EExportedTypeKind::Other;
+	}
+	return exportedType;
+}
+
 void FCodeGenerator::ExportClass(
 	UClass* Class, const FString& SourceHeaderFilename, const FString& GeneratedHeaderFilename, 
 	bool bHasChanged
@@ -294,287 +495,1309 @@ void FCodeGenerator::ExportClass(
 	// still be used as a function parameter in a function that is exported by another class
 	AllExportedClasses.Add(Class);
 	
-	FCodeFormatter nativeGlueCode(TEXT('\t'), 1);
-	FCodeFormatter managedGlueCode(TEXT(' '), 4);
-	FNativeWrapperGenerator nativeWrapperGenerator(Class, nativeGlueCode);
-	FCSharpWrapperGenerator csharpWrapperGenerator(
-		Class, 
-		FCSharpWrapperGenerator::GetWrapperSuperClass(Class, AllExportedClasses), 
-		managedGlueCode
+	const UClass* wrapperSuperClass = 
+		FCSharpWrapperGenerator::GetWrapperSuperClass(Class, AllExportedClasses);
+	const bool bCanExport = CanExportClass(Class);
+
+	// the wrappers are generated in bulk by FinishExport(), which also figures out which classes
+	// have changed since the previous run, because that depends on the classes exported later
+	ExportedApi.Classes.Add(
+		GetExportedClass(Class, wrapperSuperClass, bCanExport, SourceHeaderFilename)
 	);
+}
 
-	bool bCanExport = CanExportClass(Class);
-	if (bCanExport)
+void FCodeGenerator::QueueChangedClassExports()
+{
+	// prefixed class name -> "<prefixed class name> <hash of the exported class>"
+	TMap<FString, FString> classSignatures;
+	for (FExportedClass& exportedClass : ExportedApi.Classes)
 	{
-		ClassesWithNativeWrappers.Add(Class);
-		nativeWrapperGenerator.GenerateHeader();
+		classSignatures.Add(
+			exportedClass.NativeName, 
+			exportedClass.NativeName + TEXT(" ") + GetExportSignature(exportedClass)
+		);
+	}
+
+	for (int32 classIndex = 0; classIndex < ExportedApi.Classes.Num(); ++classIndex)
+	{
+		const FExportedClass& exportedClass = ExportedApi.Classes[classIndex];
+
+		// The generated wrappers also depend on the wrapper super class and the classes that 
+		// are referenced by the exported members, so if any of those change, or stop being 
+		// exported, the wrappers have to be regenerated. 
+		TArray<FString> dependencies;
+		if (const FString* superClassSignature = 
+			classSignatures.Find(exportedClass.WrapperSuperClassNativeName))
+		{
+			dependencies.Add(*superClassSignature);
+		}
+		for (const FExportedFunction& function : exportedClass.Functions)
+		{
+			for (const FExportedProperty& param : function.Params)
+			{
+				AddReferencedClassInfo(param.Type, classSignatures, dependencies);
+			}
+		}
+		for (const FExportedProperty& property : exportedClass.Properties)
+		{
+			AddReferencedClassInfo(property.Type, classSignatures, dependencies);
+			AddReferencedClassInfo(property.ElementType, classSignatures, dependencies);
+		}
+		// the order in which the dependencies were found doesn't matter
+		dependencies.Sort();
+
+		FMD5 md5;
+		auto updateSignature = [&md5](const FString& Signature)
+		{
+			md5.Update(
+				reinterpret_cast<const uint8*>(*Signature), Signature.Len() * sizeof(TCHAR)
+			);
+		};
+		updateSignature(GeneratorSignature);
+		updateSignature(classSignatures[exportedClass.NativeName]);
+		for (const FString& dependency : dependencies)
+		{
+			updateSignature(dependency);
+		}
+		uint8 digest[16];
+		md5.Final(digest);
+		const FString exportSignature = BytesToHex(digest, sizeof(digest));
+		ExportSignatures.Add(exportedClass.Name, exportSignature);
+
+		// skip classes whose wrappers were generated by a previous run and haven't changed since
+		const FString nativeGlueFilename = GetNativeGlueFilename(exportedClass.Name);
+		const FString managedGlueFilename = GetManagedGlueFilename(exportedClass.Name);
+		const FString* previousExportSignature = PreviousExportSignatures.Find(exportedClass.Name);
+		if (previousExportSignature && (*previousExportSignature == exportSignature)
+			&& (!exportedClass.bCanExport || FPaths::FileExists(nativeGlueFilename))
+			&& FPaths::FileExists(managedGlueFilename))
+		{
+			continue;
+		}
+		bWrappersChanged = true;
+
+		FPendingClassExport pendingExport;
+		pendingExport.ClassIndex = classIndex;
+		pendingExport.NativeGlueFilename = nativeGlueFilename;
+		pendingExport.ManagedGlueFilename = managedGlueFilename;
+		PendingClassExports.Add(pendingExport);
 	}
+	UE_LOG(
+		LogKlawrCodeGenerator, Log, TEXT("Wrappers of %d of %d classes changed"),
+		PendingClassExports.Num(), ExportedApi.Classes.Num()
+	);
+}
+
+bool FCodeGenerator::GenerateClassWrappers(
+	const FExportedClass& Class, FCodeFormatter& OutNativeGlue, 
+	FCodeFormatter& OutManagedGlue, FString& OutError
+)
+{
+	FNativeWrapperGenerator nativeWrapperGenerator(Class, OutNativeGlue);
+	FCSharpWrapperGenerator csharpWrapperGenerator(Class, OutManagedGlue);
 
-	// some internal classes like UObjectProperty don't have an associated source header file,
-	// no native wrapper functions are generated for those types, and perhaps we shouldn't generate
-	// any C# wrappers for those either?
-	if (!SourceHeaderFilename.IsEmpty())
+	if (Class.bCanExport)
 	{
-		// NOTE: Ideally when no native wrapper functions are generated for a class the corresponding
-		//       header need not be included, however the class may still be referenced in the
-		//       wrapper functions of other classes and if the header isn't included the compilation
-		//       will fail. The compilation error is usually a cryptic error C2664, and occurs while 
-		//       attempting to upcast a pointer to the class into a UObject*, this fails because the
-		//       class is only forward declared at that point and as such the compiler is unaware that
-		//       the class is derived from UObject.
-		AllSourceClassHeaders.Add(SourceHeaderFilename);
+		nativeWrapperGenerator.GenerateHeader();
 	}
-	
+
 	csharpWrapperGenerator.GenerateHeader();
 		
-	if (bCanExport)
+	if (Class.bCanExport)
 	{
-		// export functions
-		TFieldIterator<UFunction> funcIt(Class, EFieldIteratorFlags::ExcludeSuper);
-		for ( ; funcIt; ++funcIt)
+		for (const FExportedFunction& function : Class.Functions)
 		{
-			UFunction* function = *funcIt;
-			if (CanExportFunction(Class, function))
-			{
-				// The inheritance hierarchy is mirrored in the C# wrapper classes, so there's no need to
-				// redefine functions from a base class (assuming that base class has also been exported).
-				// However, this also means that functions that are defined in UObject (which isn't exported)
-				// are not available in the C# wrapper classes, but that's not a problem for now.
-				if (function->GetOwnerClass() == Class)
-				{
-					nativeWrapperGenerator.GenerateFunctionWrapper(function);
-					csharpWrapperGenerator.GenerateFunctionWrapper(function);
-				}
-			}
+			nativeWrapperGenerator.GenerateFunctionWrapper(function);
+			csharpWrapperGenerator.GenerateFunctionWrapper(function);
 		}
 
-		// export properties
-		TFieldIterator<UProperty> propertyIt(Class, EFieldIteratorFlags::ExcludeSuper);
-		for ( ; propertyIt; ++propertyIt)
+		for (const FExportedProperty& property : Class.Properties)
 		{
-			UProperty* property = *propertyIt;
-			if (CanExportProperty(Class, property))
-			{
-				UE_LOG(
-					LogKlawrCodeGenerator, Log, 
-					TEXT("  %s %s"), *property->GetClass()->GetName(), *property->GetName()
-				);
-				
-				// Only wrap properties that are actually in this class, inheritance will take care of the 
-				// properties from base classes.
-				if (property->GetOwnerClass() == Class)
-				{
-					nativeWrapperGenerator.GeneratePropertyWrapper(property);
-					csharpWrapperGenerator.GeneratePropertyWrapper(property);
-				}
-			}
+			nativeWrapperGenerator.GeneratePropertyWrapper(property);
+			csharpWrapperGenerator.GeneratePropertyWrapper(property);
 		}
 
 		if (nativeWrapperGenerator.GetPropertyCount() != csharpWrapperGenerator.GetPropertyCount())
 		{
-			FError::Throwf(TEXT("Native and C# property wrapper count doesn't match!"));
+			OutError = TEXT("Native and C# property wrapper count doesn't match!");
+			return false;
 		}
 
 		if (nativeWrapperGenerator.GetFunctionCount() != csharpWrapperGenerator.GetFunctionCount())
 		{
-			FError::Throwf(TEXT("Native and C# function wrapper count doesn't match!"));
+			OutError = TEXT("Native and C# function wrapper count doesn't match!");
+			return false;
 		}
 
 		nativeWrapperGenerator.GenerateFooter();
-				
-		const FString nativeGlueFilename = GeneratedCodePath / (Class->GetName() + TEXT(".klawr.h"));
-		AllScriptHeaders.Add(nativeGlueFilename);
-		WriteToFile(nativeGlueFilename, nativeGlueCode.Content);
 	}
 
 	csharpWrapperGenerator.GenerateFooter();
-
-	const FString managedGlueFilename = GeneratedCodePath / (Class->GetName() + TEXT(".cs"));
-	AllManagedWrapperFiles.Add(managedGlueFilename);
-	WriteToFile(managedGlueFilename, managedGlueCode.Content);
+	return true;
 }
 
-void FCodeGenerator::GenerateManagedWrapperProject()
-{
-	const FString resourcesBasePath = 
-		FPaths::EnginePluginsDir() / TEXT("Klawr/KlawrCodeGeneratorPlugin/Resources/WrapperProjectTemplate");
-	const FString projectBasePath = FPaths::EngineIntermediateDir() / TEXT("ProjectFiles/Klawr");
 
-	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (!platformFile.CopyDirectoryTree(*projectBasePath, *resourcesBasePath, true))
+void FCodeGenerator::TrimExportedApi()
+{
+	TMap<FString, int32> classIndices;
+	TMap<FString, FString> classNames;
+	for (int32 classIndex = 0; classIndex < ExportedApi.Classes.Num(); ++classIndex)
 	{
-		FError::Throwf(TEXT("Failed to copy wrapper template!"));
+		const FString& nativeName = ExportedApi.Classes[classIndex].NativeName;
+		classIndices.Add(nativeName, classIndex);
+		classNames.Add(nativeName, nativeName);
 	}
 
-	const FString projectName("Klawr.UnrealEngine.csproj");
-	const FString projectTemplateFilename = resourcesBasePath / projectName;
-	const FString projectOutputFilename = projectBasePath / projectName;
-
-	// load the template .csproj
-	pugi::xml_document xmlDoc;
-	pugi::xml_parse_result result = xmlDoc.load_file(
-		*projectTemplateFilename, pugi::parse_default | pugi::parse_declaration | pugi::parse_comments
-	);
-
-	if (!result)
+	// start with the classes the scripts use, and keep adding the classes the wrappers of the 
+	// kept classes reference until there's nothing left to add
+	TArray<FString> pendingClasses;
+	for (const FString& name : WrapperUsage)
 	{
-		FError::Throwf(TEXT("Failed to load %s"), *projectTemplateFilename);
+		FString className;
+		pendingClasses.Add(name.Split(TEXT("."), &className, nullptr) ? className : name);
 	}
-	else
+	TSet<FString> keptClasses;
+	int32 keptMemberCount = 0;
+	while (pendingClasses.Num() > 0)
 	{
-		// add a reference to the CLR host managed assembly
-		auto referencesNode = xmlDoc.first_element_by_path(TEXT("/Project/ItemGroup/Reference")).parent();
-		if (referencesNode)
+		const FString className = pendingClasses.Pop();
+		const int32* classIndex = classIndices.Find(className);
+		if (!classIndex || keptClasses.Contains(className))
 		{
-			FString assemblyPath =
-				FPaths::RootDir()
-				/ TEXT("Engine/Source/ThirdParty/Klawr/ClrHostManaged/bin/$(Configuration)")
-				/ ClrHostManagedAssemblyName + TEXT(".dll");
-			FPaths::MakePathRelativeTo(assemblyPath, *projectOutputFilename);
-			FPaths::MakePlatformFilename(assemblyPath);
-
-			auto refNode = referencesNode.append_child(TEXT("Reference"));
-			refNode.append_attribute(TEXT("Include")) = *ClrHostManagedAssemblyName;
-			refNode.append_child(TEXT("HintPath")).text() = *assemblyPath;
+			continue;
 		}
+		keptClasses.Add(className);
 
-		// include all the generated C# wrapper classes in the project file
-		auto sourceNode = xmlDoc.first_element_by_path(TEXT("/Project/ItemGroup/Compile")).parent();
-		if (sourceNode)
+		FExportedClass& exportedClass = ExportedApi.Classes[*classIndex];
+		pendingClasses.Add(exportedClass.WrapperSuperClassNativeName);
+		// property accessors are listed under the property name, so a property is either kept 
+		// along with both its accessors or removed entirely
+		exportedClass.Functions.RemoveAll([this, &className](const FExportedFunction& Function)
 		{
-			FString linkFilename;
-			for (FString managedGlueFilename : AllManagedWrapperFiles)
+			return !WrapperUsage.Contains(className + TEXT(".") + Function.Name);
+		});
+		exportedClass.Properties.RemoveAll([this, &className](const FExportedProperty& Property)
+		{
+			return !WrapperUsage.Contains(className + TEXT(".") + Property.Name);
+		});
+		for (const FExportedFunction& function : exportedClass.Functions)
+		{
+			for (const FExportedProperty& param : function.Params)
 			{
-				FPaths::MakePathRelativeTo(managedGlueFilename, *projectOutputFilename);
-				FPaths::MakePlatformFilename(managedGlueFilename);
-				// group all generated .cs files under a virtual folder in the project file
-				linkFilename = TEXT("Generated\\");
-				linkFilename += FPaths::GetCleanFilename(managedGlueFilename);
-
-				auto compileNode = sourceNode.append_child(TEXT("Compile"));
-				compileNode.append_attribute(TEXT("Include")) = *managedGlueFilename;
-				compileNode.append_child(TEXT("Link")).text() = *linkFilename;
+				AddReferencedClassInfo(param.Type, classNames, pendingClasses);
 			}
 		}
-
-		// add a post-build event to copy the C# wrapper assembly to the engine binaries dir
-		FString assemblyDestPath = FPlatformProcess::BaseDir();
-		FPaths::NormalizeFilename(assemblyDestPath);
-		FPaths::CollapseRelativeDirectories(assemblyDestPath);
-		FPaths::MakePlatformFilename(assemblyDestPath);
-		
-		FString postBuildCmd = FString::Printf(
-			TEXT("xcopy \"$(TargetPath)\" \"%s\" /Y"), *assemblyDestPath
-		);
-
-		xmlDoc
-			.child(TEXT("Project"))
-				.append_child(TEXT("PropertyGroup"))
-					.append_child(TEXT("PostBuildEvent")).text() = *postBuildCmd;
-
-		// preserve the BOM and line endings of the template .csproj when writing out the new file
-		unsigned int outputFlags =
-			pugi::format_default | pugi::format_write_bom | pugi::format_save_file_text;
-
-		if (!xmlDoc.save_file(*projectOutputFilename, TEXT("  "), outputFlags))
+		for (const FExportedProperty& property : exportedClass.Properties)
 		{
-			FError::Throwf(TEXT("Failed to save %s"), *projectOutputFilename);
+			AddReferencedClassInfo(property.Type, classNames, pendingClasses);
+			AddReferencedClassInfo(property.ElementType, classNames, pendingClasses);
+		}
+		keptMemberCount += exportedClass.Functions.Num() + exportedClass.Properties.Num();
+		// there's nothing to register for a class without any members
+		if ((exportedClass.Functions.Num() == 0) && (exportedClass.Properties.Num() == 0))
+		{
+			exportedClass.bCanExport = false;
 		}
 	}
-}
-
-void FCodeGenerator::BuildManagedWrapperProject()
-{
-	FString buildFilename = FPaths::EngineIntermediateDir() / TEXT("ProjectFiles/Klawr/Build.bat");
-	FPaths::CollapseRelativeDirectories(buildFilename);
-	FPaths::MakePlatformFilename(buildFilename);
-	int32 returnCode = 0;
-	FString stdOut;
-	FString stdError;
 
-	FPlatformProcess::ExecProcess(
-		*buildFilename, TEXT(""), &returnCode, &stdOut, &stdError
+	const int32 exportedClassCount = ExportedApi.Classes.Num();
+	ExportedApi.Classes.RemoveAll([&keptClasses](const FExportedClass& Class)
+	{
+		return !keptClasses.Contains(Class.NativeName);
+	});
+	UE_LOG(
+		LogKlawrCodeGenerator, Log, TEXT("Trimmed wrappers to %d of %d classes (%d members)"),
+		ExportedApi.Classes.Num(), exportedClassCount, keptMemberCount
 	);
 
-	if (returnCode != 0)
+	// the trimmed wrappers of every class differ from the ones generated by a normal run
+	PendingClassExports.Empty();
+	for (int32 classIndex = 0; classIndex < ExportedApi.Classes.Num(); ++classIndex)
 	{
-		FError::Throwf(TEXT("Failed to build Klawr.UnrealEngine assembly!"));
+		FPendingClassExport pendingExport;
+		pendingExport.ClassIndex = classIndex;
+		pendingExport.NativeGlueFilename = 
+			GetNativeGlueFilename(ExportedApi.Classes[classIndex].Name);
+		pendingExport.ManagedGlueFilename = 
+			GetManagedGlueFilename(ExportedApi.Classes[classIndex].Name);
+		PendingClassExports.Add(pendingExport);
 	}
+	bWrappersChanged = true;
 }
 
-void FCodeGenerator::FinishExport()
-{
-	GlueAllNativeWrapperFiles();
-	GenerateManagedWrapperProject();
-	BuildManagedWrapperProject();
-}
-
-void FCodeGenerator::GlueAllNativeWrapperFiles()
+void FCodeGenerator::GenerateAllClassWrappers()
 {
-	// generate the file that will be included by ScriptPlugin.cpp
-	FString glueFilename = GeneratedCodePath / TEXT("KlawrGeneratedNativeWrappers.inl");
-	FCodeFormatter generatedGlue(TEXT('\t'), 1);
+	const double startTime = FPlatformTime::Seconds();
+	TArray<FGeneratedClassWrappers> generatedWrappers;
+	generatedWrappers.SetNum(PendingClassExports.Num());
 
-	generatedGlue 
-		<< TEXT("// This file is autogenerated, DON'T EDIT it, if you do your changes will be lost!")
-		<< FCodeFormatter::LineTerminator();
+	// Each class is generated independently of all others into its own slot, the generators only 
+	// read reflection data, so this is safe to do on multiple threads at once. 
+	ParallelFor(PendingClassExports.Num(), [this, &generatedWrappers](int32 index)
+	{
+		auto& generated = generatedWrappers[index];
+		generated.bSucceeded = GenerateClassWrappers(
+			ExportedApi.Classes[PendingClassExports[index].ClassIndex], generated.NativeGlue, 
+			generated.ManagedGlue, generated.Error
+		);
+	});
 
-	// include all source header files
-	generatedGlue << TEXT("// The native classes which will be made scriptable:");
-	for (const auto& headerFilename : AllSourceClassHeaders)
+	// errors are reported in the order the classes were exported, so that the same error is 
+	// reported no matter how the work was split between threads
+	for (int32 i = 0; i < PendingClassExports.Num(); ++i)
 	{
-		// re-base to make sure we're including the right files on a remote machine
-		FString newFilename(RebaseToBuildPath(headerFilename));
-		generatedGlue << FString::Printf(TEXT("#include \"%s\""), *newFilename);
+		if (!generatedWrappers[i].bSucceeded)
+		{
+			FError::Throwf(
+				TEXT("%s: %s"), *ExportedApi.Classes[PendingClassExports[i].ClassIndex].Name, 
+				*generatedWrappers[i].Error
+			);
+		}
 	}
 
-	// include all script glue headers
-	generatedGlue << TEXT("// The autogenerated native wrappers:");
-	for (const auto& headerFilename : AllScriptHeaders)
+	int64 generatedLength = 0;
+	for (const auto& generated : generatedWrappers)
 	{
-		FString newFilename(FPaths::GetCleanFilename(headerFilename));
-		generatedGlue << FString::Printf(TEXT("#include \"%s\""), *newFilename);
+		generatedLength += generated.NativeGlue.Len() + generated.ManagedGlue.Len();
 	}
-	
-	// generate a function that feeds all the native wrapper functions to the CLR host
-	generatedGlue
-		<< FCodeFormatter::LineTerminator()
-		<< TEXT("namespace Klawr {")
-		<< TEXT("namespace NativeGlue {")
-		<< FCodeFormatter::LineTerminator()
-		<< TEXT("void RegisterWrapperClasses()")
-		<< FCodeFormatter::OpenBrace();
+	UE_LOG(
+		LogKlawrCodeGenerator, Log, TEXT("Generated wrappers for %d classes (%lld chars) in %.3f s"),
+		PendingClassExports.Num(), generatedLength, FPlatformTime::Seconds() - startTime
+	);
 
-	for (auto wrappedClass : ClassesWithNativeWrappers)
+	// every class writes to its own files, so these can be written out concurrently too
+	ParallelFor(PendingClassExports.Num(), [this, &generatedWrappers](int32 index)
 	{
-		const FString ClassName = wrappedClass->GetName();
-		const FString ClassNameCPP = FString::Printf(
-			TEXT("%s%s"), wrappedClass->GetPrefixCPP(), *ClassName
-		);
-		generatedGlue << FString::Printf(
-			TEXT("IClrHost::Get()->AddClass(TEXT(\"%s\"), %s_WrapperFunctions, ")
-			TEXT("sizeof(%s_WrapperFunctions) / sizeof(%s_WrapperFunctions[0]));"),
-			*ClassNameCPP, *ClassName, *ClassName, *ClassName
+		const auto& pendingExport = PendingClassExports[index];
+		if (ExportedApi.Classes[pendingExport.ClassIndex].bCanExport)
+		{
+			WriteToFile(pendingExport.NativeGlueFilename, generatedWrappers[index].NativeGlue);
+		}
+		WriteToFile(pendingExport.ManagedGlueFilename, generatedWrappers[index].ManagedGlue);
+	});
+
+	PendingClassExports.Empty();
+	UE_LOG(
+		LogKlawrCodeGenerator, Log, TEXT("Generated and saved class wrappers in %.3f s"),
+		FPlatformTime::Seconds() - startTime
+	);
+}
+
+void FCodeGenerator::BenchmarkWrapperGeneration()
+{
+	FExportedApi previousApi;
+	if (!previousApi.LoadFromFile(GetExportedApiFilename()))
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Warning, 
+			TEXT("Can't benchmark the wrapper generators, '%s' is missing or out of date."),
+			*GetExportedApiFilename()
 		);
+		return;
 	}
 
-	generatedGlue 
-		<< FCodeFormatter::CloseBrace()
-		<< FCodeFormatter::LineTerminator()
-		<< TEXT("}} // namespace Klawr::NativeGlue");
+	UE_LOG(
+		LogKlawrCodeGenerator, Display, TEXT("Benchmarking the wrapper generators with %d classes."),
+		previousApi.Classes.Num()
+	);
 
-	WriteToFile(glueFilename, generatedGlue.Content);
+	// The files on disk were generated from the same API by the previous run, so anything that 
+	// doesn't match them was caused by changes to the generators since then.
+	CheckWrapperGeneration(previousApi, GeneratedCodePath, false);
 }
 
-void FCodeGenerator::WriteToFile(const FString& Path, const FString& Content)
+int32 FCodeGenerator::CheckWrapperGeneration(
+	const FExportedApi& Api, const FString& ExpectedCodePath, bool bUpdateExpectedCode,
+	FWrapperGenerationStats* OutStats
+)
 {
-	FString diskContent;
-	FFileHelper::LoadFileToString(diskContent, *Path);
+	// generate everything in one go the same way GenerateAllClassWrappers() would
+	TArray<FGeneratedClassWrappers> generatedWrappers;
+	generatedWrappers.SetNum(Api.Classes.Num());
+	const double startTime = FPlatformTime::Seconds();
+	ParallelFor(Api.Classes.Num(), [&Api, &generatedWrappers](int32 index)
+	{
+		auto& generated = generatedWrappers[index];
+		generated.bSucceeded = GenerateClassWrappers(
+			Api.Classes[index], generated.NativeGlue, generated.ManagedGlue, generated.Error
+		);
+	});
+	const double elapsedTime = FPlatformTime::Seconds() - startTime;
 
-	const bool bContentChanged = (diskContent.Len() == 0) || FCString::Strcmp(*diskContent, *Content);
-	if (bContentChanged)
+	// the wrappers of every class are still in memory at this point, just like they are when
+	// GenerateAllClassWrappers() starts writing them out
+	int64 allocatedSize = generatedWrappers.GetAllocatedSize();
+	for (const auto& generated : generatedWrappers)
 	{
-		if (!FFileHelper::SaveStringToFile(Content, *Path))
+		allocatedSize += generated.NativeGlue.GetAllocatedSize() +
+			generated.ManagedGlue.GetAllocatedSize();
+	}
+	const uint64 peakUsedPhysical = FPlatformMemory::GetStats().PeakUsedPhysical;
+
+	// hash everything as it would be written out, so the output for an API can be checked
+	// without keeping a copy of every generated file
+	FMD5 md5;
+	TArray<uint8> ansiChunk;
+	auto hashGeneratedCode = [&md5, &ansiChunk](const FCodeFormatter& Code)
+	{
+		Code.ForEachChunk([&md5, &ansiChunk](const TCHAR* Text, int32 TextLength)
+		{
+			ansiChunk.Reset();
+			ansiChunk.AddUninitialized(TextLength);
+			for (int32 i = 0; i < TextLength; ++i)
+			{
+				ansiChunk[i] = (uint8)Text[i];
+			}
+			md5.Update(ansiChunk.GetData(), ansiChunk.Num());
+		});
+	};
+
+	int64 generatedLength = 0;
+	int32 numDifferences = 0;
+	for (int32 i = 0; i < Api.Classes.Num(); ++i)
+	{
+		const FExportedClass& exportedClass = Api.Classes[i];
+		const FGeneratedClassWrappers& generated = generatedWrappers[i];
+		if (!generated.bSucceeded)
+		{
+			UE_LOG(
+				LogKlawrCodeGenerator, Warning, TEXT("%s: %s"), *exportedClass.Name, *generated.Error
+			);
+			++numDifferences;
+			continue;
+		}
+
+		generatedLength += generated.NativeGlue.Len() + generated.ManagedGlue.Len();
+		if (exportedClass.bCanExport)
+		{
+			hashGeneratedCode(generated.NativeGlue);
+		}
+		hashGeneratedCode(generated.ManagedGlue);
+		if (ExpectedCodePath.IsEmpty())
+		{
+			continue;
+		}
+
+		const FString nativeGlueFilename = 
+			ExpectedCodePath / (exportedClass.Name + TEXT(".klawr.h"));
+		const FString managedGlueFilename = ExpectedCodePath / (exportedClass.Name + TEXT(".cs"));
+		if (bUpdateExpectedCode)
+		{
+			if (exportedClass.bCanExport)
+			{
+				WriteToFile(nativeGlueFilename, generated.NativeGlue);
+			}
+			WriteToFile(managedGlueFilename, generated.ManagedGlue);
+			continue;
+		}
+
+		if (exportedClass.bCanExport && 
+			!IsFileContentEqual(nativeGlueFilename, generated.NativeGlue))
+		{
+			UE_LOG(
+				LogKlawrCodeGenerator, Warning, TEXT("Native wrappers for %s differ from '%s'"),
+				*exportedClass.Name, *nativeGlueFilename
+			);
+			++numDifferences;
+		}
+		if (!IsFileContentEqual(managedGlueFilename, generated.ManagedGlue))
+		{
+			UE_LOG(
+				LogKlawrCodeGenerator, Warning, TEXT("C# wrappers for %s differ from '%s'"),
+				*exportedClass.Name, *managedGlueFilename
+			);
+			++numDifferences;
+		}
+	}
+
+	UE_LOG(
+		LogKlawrCodeGenerator, Display, 
+		TEXT("Generated %lld chars of wrappers for %d classes in %.3f s, using %.1f MB, ")
+		TEXT("%d differences found."),
+		generatedLength, Api.Classes.Num(), elapsedTime, allocatedSize / (1024.0 * 1024.0), 
+		numDifferences
+	);
+	if (OutStats)
+	{
+		uint8 digest[16];
+		md5.Final(digest);
+		OutStats->Seconds = elapsedTime;
+		OutStats->GeneratedLength = generatedLength;
+		OutStats->AllocatedSize = allocatedSize;
+		OutStats->PeakUsedPhysical = peakUsedPhysical;
+		OutStats->Digest = BytesToHex(digest, sizeof(digest));
+	}
+	return numDifferences;
+}
+
+FString FCodeGenerator::GetExportSignature(FExportedClass& Class)
+{
+	// the exported class contains everything the wrappers are generated from
+	TArray<uint8> data;
+	FMemoryWriter writer(data);
+	writer << Class;
+
+	uint8 digest[16];
+	FMD5 md5;
+	md5.Update(data.GetData(), data.Num());
+	md5.Final(digest);
+	return BytesToHex(digest, sizeof(digest));
+}
+
+FString FCodeGenerator::GetGeneratorSignature()
+{
+	// the engine is built from source, so the generator sources are always available
+	const FString sourceBasePath = 
+		FPaths::EnginePluginsDir() / TEXT("Klawr/KlawrCodeGeneratorPlugin/Source");
+
+	TArray<FString> sourceFilenames;
+	IFileManager::Get().FindFilesRecursive(
+		sourceFilenames, *sourceBasePath, TEXT("*"), true, false
+	);
+	// the order in which files are found isn't guaranteed
+	sourceFilenames.Sort();
+
+	FMD5 md5;
+	TArray<uint8> fileContent;
+	for (const FString& sourceFilename : sourceFilenames)
+	{
+		fileContent.Reset();
+		if (FFileHelper::LoadFileToArray(fileContent, *sourceFilename))
+		{
+			md5.Update(fileContent.GetData(), fileContent.Num());
+		}
+	}
+	if (sourceFilenames.Num() == 0)
+	{
+		// fall back to the time this file was compiled, which at least changes whenever the 
+		// generator is rebuilt after a change to this file
+		const ANSICHAR* buildTime = __DATE__ " " __TIME__;
+		md5.Update(reinterpret_cast<const uint8*>(buildTime), FCStringAnsi::Strlen(buildTime));
+	}
+
+	uint8 digest[16];
+	md5.Final(digest);
+	return BytesToHex(digest, sizeof(digest));
+}
+
+FString FCodeGenerator::GetWrapperProjectTemplateSignature()
+{
+	const FString resourcesBasePath = 
+		FPaths::EnginePluginsDir() / TEXT("Klawr/KlawrCodeGeneratorPlugin/Resources/WrapperProjectTemplate");
+
+	TArray<FString> templateFilenames;
+	IFileManager::Get().FindFilesRecursive(
+		templateFilenames, *resourcesBasePath, TEXT("*"), true, false
+	);
+	// the order in which files are found isn't guaranteed
+	templateFilenames.Sort();
+
+	FMD5 md5;
+	TArray<uint8> fileContent;
+	for (const FString& templateFilename : templateFilenames)
+	{
+		fileContent.Reset();
+		if (FFileHelper::LoadFileToArray(fileContent, *templateFilename))
+		{
+			md5.Update(fileContent.GetData(), fileContent.Num());
+		}
+	}
+
+	uint8 digest[16];
+	md5.Final(digest);
+	return BytesToHex(digest, sizeof(digest));
+}
+
+FString FCodeGenerator::GetManifestFilename() const
+{
+	return GeneratedCodePath / TEXT("KlawrGeneratedWrappers.manifest");
+}
+
+FString FCodeGenerator::GetExportedApiFilename() const
+{
+	return GeneratedCodePath / TEXT("KlawrExportedApi.bin");
+}
+
+FString FCodeGenerator::GetNativeGlueFilename(const FString& ClassName) const
+{
+	return GeneratedCodePath / (ClassName + TEXT(".klawr.h"));
+}
+
+FString FCodeGenerator::GetNativeGlueShardFilename(int32 ShardIndex) const
+{
+	return GeneratedCodePath / FString::Printf(
+		TEXT("KlawrGeneratedNativeWrappers_%d.inl"), ShardIndex
+	);
+}
+
+int64 FCodeGenerator::GetNativeGlueWeight(const FExportedClass& Class)
+{
+	// a rough estimate of how long the native wrappers of a class take to compile, a wrapper 
+	// function is generated for every function, and a getter and setter for every property
+	return 1 + Class.Functions.Num() + (2 * Class.Properties.Num());
+}
+
+FString FCodeGenerator::GetManagedGlueFilename(const FString& ClassName) const
+{
+	return GeneratedCodePath / (ClassName + TEXT(".cs"));
+}
+
+FString FCodeGenerator::GetWrapperProjectBasePath() const
+{
+	// Build.bat expects to be three levels below the engine dir
+	const TCHAR* projectDir = WrapperUsageFilename.IsEmpty() ? 
+		TEXT("ProjectFiles/Klawr") : TEXT("ProjectFiles/KlawrTrimmed");
+	return FPaths::EngineIntermediateDir() / projectDir;
+}
+
+FString FCodeGenerator::GetWrapperProjectFilename(const FWrapperAssembly& Assembly) const
+{
+	const FString projectBasePath = GetWrapperProjectBasePath();
+	const FString projectName = Assembly.Name + TEXT(".csproj");
+	// the core project goes where the template project was copied to
+	return (Assembly.Name == WrapperAssemblyName) ? 
+		projectBasePath / projectName : projectBasePath / TEXT("Modules") / Assembly.Name / projectName;
+}
+
+FString FCodeGenerator::GetWrapperProjectGuid(const FWrapperAssembly& Assembly)
+{
+	// derived from the assembly name so it doesn't change between runs
+	const FString hash = FMD5::HashAnsiString(*Assembly.Name).ToUpper();
+	return FString::Printf(
+		TEXT("{%s-%s-%s-%s-%s}"), 
+		*hash.Mid(0, 8), *hash.Mid(8, 4), *hash.Mid(12, 4), *hash.Mid(16, 4), *hash.Mid(20, 12)
+	);
+}
+
+FString FCodeGenerator::GetWrapperAssemblyPath() const
+{
+	// trimmed assemblies must not replace the ones the editor loads
+	return WrapperUsageFilename.IsEmpty() ? 
+		FString(FPlatformProcess::BaseDir()) : GetWrapperProjectBasePath() / TEXT("Binaries/");
+}
+
+FString FCodeGenerator::GetWrapperAssemblyFilename(const FWrapperAssembly& Assembly) const
+{
+	return GetWrapperAssemblyPath() / (Assembly.Name + TEXT(".dll"));
+}
+
+void FCodeGenerator::LoadManifest()
+{
+	TArray<FString> lines;
+	if (!FFileHelper::LoadANSITextFileToStrings(*GetManifestFilename(), nullptr, lines))
+	{
+		// everything will have to be regenerated
+		return;
+	}
+
+	// Each line contains a class name followed by its export signature, the signatures include
+	// a hash of the generator sources so they all change whenever the generators do.
+	FString className;
+	FString exportSignature;
+	for (int32 i = 0; i < lines.Num(); ++i)
+	{
+		if (lines[i].Split(TEXT(" "), &className, &exportSignature))
+		{
+			PreviousExportSignatures.Add(className, exportSignature);
+		}
+	}
+}
+
+void FCodeGenerator::SaveManifest()
+{
+	FString content;
+	for (const auto& entry : ExportSignatures)
+	{
+		content += FString::Printf(TEXT("%s %s\n"), *entry.Key, *entry.Value);
+	}
+	WriteToFile(GetManifestFilename(), content);
+}
+
+void FCodeGenerator::PartitionWrapperAssemblies()
+{
+	TMap<FString, FString> classModules;
+	TArray<FString> moduleNames;
+	for (const FExportedClass& exportedClass : ExportedApi.Classes)
+	{
+		classModules.Add(exportedClass.NativeName, exportedClass.ModuleName);
+		moduleNames.AddUnique(exportedClass.ModuleName);
+	}
+
+	// find the modules the wrappers of each module reference directly
+	TMap<FString, TArray<FString>> moduleReferences;
+	for (const FString& moduleName : moduleNames)
+	{
+		moduleReferences.Add(moduleName);
+	}
+	for (const FExportedClass& exportedClass : ExportedApi.Classes)
+	{
+		TArray<FString>& references = moduleReferences[exportedClass.ModuleName];
+		const FString* superClassModule = 
+			classModules.Find(exportedClass.WrapperSuperClassNativeName);
+		if (superClassModule)
+		{
+			references.AddUnique(*superClassModule);
+		}
+		for (const FExportedFunction& function : exportedClass.Functions)
+		{
+			for (const FExportedProperty& param : function.Params)
+			{
+				AddReferencedClassInfo(param.Type, classModules, references);
+			}
+		}
+		for (const FExportedProperty& property : exportedClass.Properties)
+		{
+			AddReferencedClassInfo(property.Type, classModules, references);
+			AddReferencedClassInfo(property.ElementType, classModules, references);
+		}
+		references.Remove(exportedClass.ModuleName);
+	}
+
+	// find the modules the wrappers of each module depend on (directly or indirectly)
+	TMap<FString, TArray<FString>> moduleDependencies;
+	for (const FString& moduleName : moduleNames)
+	{
+		TArray<FString> dependencies;
+		TArray<FString> pendingModules = moduleReferences[moduleName];
+		while (pendingModules.Num() > 0)
+		{
+			const FString dependency = pendingModules.Pop();
+			if (!dependencies.Contains(dependency))
+			{
+				dependencies.Add(dependency);
+				pendingModules.Append(moduleReferences[dependency]);
+			}
+		}
+		moduleDependencies.Add(moduleName, dependencies);
+	}
+
+	// The core assembly contains the wrappers of the modules the wrapper project template uses
+	// (e.g. UKlawrScriptComponent is derived from UActorComponent), along with the wrappers of 
+	// all the modules those depend on, so it never has to reference any other wrapper assembly.
+	WrapperAssemblies.Reset();
+	WrapperAssemblies.AddDefaulted();
+	WrapperAssemblies[0].Name = WrapperAssemblyName;
+	
+	TArray<FString> coreModuleNames;
+	coreModuleNames.Add(TEXT("CoreUObject"));
+	coreModuleNames.Add(TEXT("Engine"));
+	for (const FString& moduleName : moduleNames)
+	{
+		if (coreModuleNames.Contains(moduleName))
+		{
+			for (const FString& dependency : moduleDependencies[moduleName])
+			{
+				coreModuleNames.AddUnique(dependency);
+			}
+		}
+	}
+
+	TMap<FString, int32> moduleAssemblies;
+	for (const FString& moduleName : moduleNames)
+	{
+		if (coreModuleNames.Contains(moduleName))
+		{
+			WrapperAssemblies[0].ModuleNames.Add(moduleName);
+			moduleAssemblies.Add(moduleName, 0);
+		}
+	}
+
+	// every other module gets an assembly of its own, except that modules that depend on each 
+	// other have to share an assembly (assemblies can't reference each other)
+	for (const FString& moduleName : moduleNames)
+	{
+		if (moduleAssemblies.Contains(moduleName))
+		{
+			continue;
+		}
+		const int32 assemblyIndex = WrapperAssemblies.AddDefaulted();
+		FWrapperAssembly& assembly = WrapperAssemblies[assemblyIndex];
+		assembly.Name = WrapperAssemblyName + TEXT(".") + moduleName;
+		for (const FString& otherModuleName : moduleNames)
+		{
+			if ((otherModuleName == moduleName) || 
+				(!moduleAssemblies.Contains(otherModuleName)
+				&& moduleDependencies[moduleName].Contains(otherModuleName)
+				&& moduleDependencies[otherModuleName].Contains(moduleName)))
+			{
+				assembly.ModuleNames.Add(otherModuleName);
+				moduleAssemblies.Add(otherModuleName, assemblyIndex);
+			}
+		}
+	}
+
+	for (const FExportedClass& exportedClass : ExportedApi.Classes)
+	{
+		WrapperAssemblies[moduleAssemblies[exportedClass.ModuleName]].ManagedGlueFilenames.Add(
+			GetManagedGlueFilename(exportedClass.Name)
+		);
+	}
+
+	for (const FString& moduleName : moduleNames)
+	{
+		const int32 assemblyIndex = moduleAssemblies[moduleName];
+		for (const FString& reference : moduleReferences[moduleName])
+		{
+			const int32 referenceIndex = moduleAssemblies[reference];
+			if (referenceIndex != assemblyIndex)
+			{
+				WrapperAssemblies[assemblyIndex].References.AddUnique(referenceIndex);
+			}
+		}
+	}
+}
+
+void FCodeGenerator::GenerateManagedWrapperProjects()
+{
+	const FString resourcesBasePath = 
+		FPaths::EnginePluginsDir() / TEXT("Klawr/KlawrCodeGeneratorPlugin/Resources/WrapperProjectTemplate");
+	const FString projectBasePath = GetWrapperProjectBasePath();
+
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!platformFile.CopyDirectoryTree(*projectBasePath, *resourcesBasePath, true))
+	{
+		FError::Throwf(TEXT("Failed to copy wrapper template!"));
+	}
+	IFileManager::Get().MakeDirectory(*GetWrapperAssemblyPath(), true);
+
+	// get rid of the projects of assemblies that are no longer generated, otherwise they'd 
+	// still be built by Klawr.UnrealEngine.Wrappers.proj
+	const FString modulesBasePath = projectBasePath / TEXT("Modules");
+	TArray<FString> moduleProjectDirs;
+	IFileManager::Get().FindFiles(moduleProjectDirs, *(modulesBasePath / TEXT("*")), false, true);
+	for (const FString& moduleProjectDir : moduleProjectDirs)
+	{
+		const bool bIsStale = !WrapperAssemblies.ContainsByPredicate(
+			[&moduleProjectDir](const FWrapperAssembly& Assembly)
+			{
+				return Assembly.Name == moduleProjectDir;
+			}
+		);
+		if (bIsStale)
+		{
+			IFileManager::Get().DeleteDirectory(*(modulesBasePath / moduleProjectDir), false, true);
+		}
+	}
+
+	// the core assembly lists all the other wrapper assemblies so they can be loaded on demand
+	FCodeFormatter assemblyList(TEXT(' '), 4);
+	assemblyList 
+		<< TEXT("// This file is autogenerated, DON'T EDIT it, if you do your changes will be lost!")
+		<< FCodeFormatter::LineTerminator();
+	for (int32 assemblyIndex = 1; assemblyIndex < WrapperAssemblies.Num(); ++assemblyIndex)
+	{
+		assemblyList.AppendLinef(
+			TEXT("[assembly: Klawr.ClrHost.Managed.WrapperAssembly(\"%s\")]"),
+			*WrapperAssemblies[assemblyIndex].Name
+		);
+	}
+	if (!WrapperUsageFilename.IsEmpty())
+	{
+		assemblyList.AppendLinef(
+			TEXT("[assembly: Klawr.ClrHost.Managed.TrimmedWrappers(\"%s\")]"),
+			*FPaths::GetCleanFilename(WrapperUsageFilename)
+		);
+	}
+	const FString assemblyListFilename = GeneratedCodePath / TEXT("KlawrWrapperAssemblies.cs");
+	WriteToFile(assemblyListFilename, assemblyList);
+	WrapperAssemblies[0].ManagedGlueFilenames.Add(assemblyListFilename);
+
+	for (const FWrapperAssembly& assembly : WrapperAssemblies)
+	{
+		FString moduleList;
+		for (const FString& moduleName : assembly.ModuleNames)
+		{
+			moduleList += moduleList.IsEmpty() ? moduleName : (TEXT(", ") + moduleName);
+		}
+		UE_LOG(
+			LogKlawrCodeGenerator, Log, TEXT("Generating %s for modules: %s"), *assembly.Name, 
+			*moduleList
+		);
+		GenerateManagedWrapperProject(assembly, resourcesBasePath);
+	}
+}
+
+void FCodeGenerator::GenerateManagedWrapperProject(
+	const FWrapperAssembly& Assembly, const FString& ResourcesBasePath
+)
+{
+	const FString projectTemplateFilename = ResourcesBasePath / TEXT("Klawr.UnrealEngine.csproj");
+	const FString projectOutputFilename = GetWrapperProjectFilename(Assembly);
+	const bool bIsCoreAssembly = (Assembly.Name == WrapperAssemblyName);
+
+	// load the template .csproj
+	pugi::xml_document xmlDoc;
+	pugi::xml_parse_result result = xmlDoc.load_file(
+		*projectTemplateFilename, pugi::parse_default | pugi::parse_declaration | pugi::parse_comments
+	);
+
+	if (!result)
+	{
+		FError::Throwf(TEXT("Failed to load %s"), *projectTemplateFilename);
+	}
+	else
+	{
+		xmlDoc.first_element_by_path(TEXT("/Project/PropertyGroup/AssemblyName")).text() = 
+			*Assembly.Name;
+		xmlDoc.first_element_by_path(TEXT("/Project/PropertyGroup/ProjectGuid")).text() = 
+			*GetWrapperProjectGuid(Assembly);
+
+		// add a reference to the CLR host managed assembly
+		auto referencesNode = xmlDoc.first_element_by_path(TEXT("/Project/ItemGroup/Reference")).parent();
+		if (referencesNode)
+		{
+			FString assemblyPath =
+				FPaths::RootDir()
+				/ TEXT("Engine/Source/ThirdParty/Klawr/ClrHostManaged/bin/$(Configuration)")
+				/ ClrHostManagedAssemblyName + TEXT(".dll");
+			FPaths::MakePathRelativeTo(assemblyPath, *projectOutputFilename);
+			FPaths::MakePlatformFilename(assemblyPath);
+
+			auto refNode = referencesNode.append_child(TEXT("Reference"));
+			refNode.append_attribute(TEXT("Include")) = *ClrHostManagedAssemblyName;
+			refNode.append_child(TEXT("HintPath")).text() = *assemblyPath;
+
+			// add references to the other wrapper assemblies this one depends on
+			if (Assembly.References.Num() > 0)
+			{
+				auto projectReferencesNode = xmlDoc.child(TEXT("Project"))
+					.insert_child_after(TEXT("ItemGroup"), referencesNode);
+
+				for (int32 referenceIndex : Assembly.References)
+				{
+					const FWrapperAssembly& reference = WrapperAssemblies[referenceIndex];
+					FString referencePath = GetWrapperProjectFilename(reference);
+					FPaths::MakePathRelativeTo(referencePath, *projectOutputFilename);
+					FPaths::MakePlatformFilename(referencePath);
+
+					auto projectRefNode = projectReferencesNode.append_child(TEXT("ProjectReference"));
+					projectRefNode.append_attribute(TEXT("Include")) = *referencePath;
+					projectRefNode.append_child(TEXT("Project")).text() = 
+						*GetWrapperProjectGuid(reference);
+					projectRefNode.append_child(TEXT("Name")).text() = *reference.Name;
+					// the referenced assembly is copied to GetWrapperAssemblyPath() by its own 
+					// post-build event
+					projectRefNode.append_child(TEXT("Private")).text() = TEXT("False");
+				}
+			}
+		}
+
+		// include the generated C# wrapper classes in the project file
+		auto sourceNode = xmlDoc.first_element_by_path(TEXT("/Project/ItemGroup/Compile")).parent();
+		if (sourceNode)
+		{
+			// the sources that come with the template only belong in the core assembly
+			if (!bIsCoreAssembly)
+			{
+				while (auto templateCompileNode = sourceNode.child(TEXT("Compile")))
+				{
+					sourceNode.remove_child(templateCompileNode);
+				}
+			}
+
+			FString linkFilename;
+			for (FString managedGlueFilename : Assembly.ManagedGlueFilenames)
+			{
+				FPaths::MakePathRelativeTo(managedGlueFilename, *projectOutputFilename);
+				FPaths::MakePlatformFilename(managedGlueFilename);
+				// group all generated .cs files under a virtual folder in the project file
+				linkFilename = TEXT("Generated\\");
+				linkFilename += FPaths::GetCleanFilename(managedGlueFilename);
+
+				auto compileNode = sourceNode.append_child(TEXT("Compile"));
+				compileNode.append_attribute(TEXT("Include")) = *managedGlueFilename;
+				compileNode.append_child(TEXT("Link")).text() = *linkFilename;
+			}
+		}
+
+		// add a post-build event to copy the C# wrapper assembly to the engine binaries dir (or 
+		// the staging dir of trimmed assemblies), the trailing separator tells xcopy the 
+		// destination is a directory
+		FString assemblyDestPath = GetWrapperAssemblyPath();
+		FPaths::NormalizeFilename(assemblyDestPath);
+		FPaths::CollapseRelativeDirectories(assemblyDestPath);
+		FPaths::MakePlatformFilename(assemblyDestPath);
+		
+		FString postBuildCmd = FString::Printf(
+			TEXT("xcopy \"$(TargetPath)\" \"%s\" /Y"), *assemblyDestPath
+		);
+
+		xmlDoc
+			.child(TEXT("Project"))
+				.append_child(TEXT("PropertyGroup"))
+					.append_child(TEXT("PostBuildEvent")).text() = *postBuildCmd;
+
+		// preserve the BOM and line endings of the template .csproj when writing out the new file
+		unsigned int outputFlags =
+			pugi::format_default | pugi::format_write_bom | pugi::format_save_file_text;
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(projectOutputFilename), true);
+		if (!xmlDoc.save_file(*projectOutputFilename, TEXT("  "), outputFlags))
+		{
+			FError::Throwf(TEXT("Failed to save %s"), *projectOutputFilename);
+		}
+	}
+}
+
+void FCodeGenerator::BuildManagedWrapperProjects()
+{
+	FString buildFilename = GetWrapperProjectBasePath() / TEXT("Build.bat");
+	FPaths::CollapseRelativeDirectories(buildFilename);
+	FPaths::MakePlatformFilename(buildFilename);
+	int32 returnCode = 0;
+	FString stdOut;
+	FString stdError;
+
+	FPlatformProcess::ExecProcess(
+		*buildFilename, TEXT(""), &returnCode, &stdOut, &stdError
+	);
+
+	if (returnCode != 0)
+	{
+		FError::Throwf(TEXT("Failed to build Klawr.UnrealEngine assemblies!"));
+	}
+}
+
+void FCodeGenerator::FinishExport()
+{
+	if (!WrapperUsageFilename.IsEmpty())
+	{
+		TrimExportedApi();
+	}
+	else
+	{
+		QueueChangedClassExports();
+	}
+	GenerateAllClassWrappers();
+	GlueAllNativeWrapperFiles();
+	PartitionWrapperAssemblies();
+
+	ExportSignatures.Add(WrapperProjectTemplateEntryName, GetWrapperProjectTemplateSignature());
+	const FString* previousTemplateSignature = 
+		PreviousExportSignatures.Find(WrapperProjectTemplateEntryName);
+	const bool bTemplateChanged = !previousTemplateSignature || 
+		(*previousTemplateSignature != ExportSignatures[WrapperProjectTemplateEntryName]);
+	const bool bAssemblyMissing = WrapperAssemblies.ContainsByPredicate(
+		[this](const FWrapperAssembly& Assembly)
+		{
+			return !FPaths::FileExists(GetWrapperAssemblyFilename(Assembly));
+		}
+	);
+	
+	// If none of the classes changed, and no classes were added or removed (in which case the 
+	// number of signatures would differ), then the C# wrapper assemblies are up to date.
+	if (bWrappersChanged || bTemplateChanged ||
+		(ExportSignatures.Num() != PreviousExportSignatures.Num()) || bAssemblyMissing)
+	{
+		GenerateManagedWrapperProjects();
+		BuildManagedWrapperProjects();
+	}
+	else
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Log, 
+			TEXT("No managed wrappers changed, skipping the Klawr.UnrealEngine build.")
+		);
+	}
+	if (!ExportedApi.SaveToFile(GetExportedApiFilename()))
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Warning, TEXT("Failed to save '%s'"), *GetExportedApiFilename()
+		);
+	}
+	if (!WrapperUsageFilename.IsEmpty())
+	{
+		// the manifest was deleted at the start, so the next normal run regenerates the 
+		// wrappers of every class
+		UE_LOG(
+			LogKlawrCodeGenerator, Log, TEXT("Trimmed wrapper assemblies were copied to '%s'"),
+			*GetWrapperAssemblyPath()
+		);
+		return;
+	}
+	// only saved once everything has been successfully generated and built, so if something 
+	// fails along the way the next run will try again
+	SaveManifest();
+}
+
+void FCodeGenerator::AddReferencedClassInfo(
+	const FExportedType& Type, const TMap<FString, FString>& ClassInfo,
+	TArray<FString>& OutInfo
+)
+{
+	// pick the class names out of types like "AActor*", "TSubclassOf<AActor> ", "TArray<AActor*>"
+	const FString& cppType = Type.CPPType;
+	int32 identStart = INDEX_NONE;
+	for (int32 i = 0; i <= cppType.Len(); ++i)
+	{
+		const bool bIsIdentChar = (i < cppType.Len()) && 
+			(FChar::IsAlnum(cppType[i]) || (cppType[i] == TEXT('_')));
+
+		if (bIsIdentChar && (identStart == INDEX_NONE))
+		{
+			identStart = i;
+		}
+		else if (!bIsIdentChar && (identStart != INDEX_NONE))
+		{
+			const FString* info = ClassInfo.Find(cppType.Mid(identStart, i - identStart));
+			if (info)
+			{
+				OutInfo.AddUnique(*info);
+			}
+			identStart = INDEX_NONE;
+		}
+	}
+}
+
+void FCodeGenerator::GlueAllNativeWrapperFiles()
+{
+	TMap<FString, FString> classHeaders;
+	int64 totalWeight = 0;
+	for (const FExportedClass& exportedClass : ExportedApi.Classes)
+	{
+		// some internal classes like UObjectProperty don't have an associated source header file,
+		// no native wrapper functions are generated for those types, and perhaps we shouldn't 
+		// generate any C# wrappers for those either?
+		if (!exportedClass.SourceHeaderFilename.IsEmpty())
+		{
+			classHeaders.Add(exportedClass.NativeName, exportedClass.SourceHeaderFilename);
+		}
+		if (exportedClass.bCanExport)
+		{
+			totalWeight += GetNativeGlueWeight(exportedClass);
+		}
+	}
+
+	// Split the classes into shards of roughly equal weight, each shard is compiled separately
+	// so the shards can be compiled in parallel, and only the shards containing classes whose 
+	// wrappers changed have to be recompiled. Classes are kept in the order they were exported 
+	// so classes from the same module end up in the same shard (and most of the headers each 
+	// shard includes are shared by the classes in that shard), and so that adding or removing 
+	// a class only moves the classes near the shard boundaries to a different shard.
+	TArray<FCodeFormatter> shardGlue;
+	TArray<TArray<FString>> shardSourceHeaders;
+	TArray<TArray<FString>> shardScriptHeaders;
+	TArray<TArray<const FExportedClass*>> shardClasses;
+	shardGlue.Reserve(NativeGlueShardCount);
+	for (int32 shardIndex = 0; shardIndex < NativeGlueShardCount; ++shardIndex)
+	{
+		shardGlue.Emplace(TEXT('\t'), 1);
+	}
+	shardSourceHeaders.SetNum(NativeGlueShardCount);
+	shardScriptHeaders.SetNum(NativeGlueShardCount);
+	shardClasses.SetNum(NativeGlueShardCount);
+
+	int64 weightSoFar = 0;
+	for (const FExportedClass& exportedClass : ExportedApi.Classes)
+	{
+		if (!exportedClass.bCanExport)
+		{
+			continue;
+		}
+		const int32 shardIndex = FMath::Min<int32>(
+			NativeGlueShardCount - 1, (weightSoFar * NativeGlueShardCount) / totalWeight
+		);
+		weightSoFar += GetNativeGlueWeight(exportedClass);
+
+		// NOTE: Ideally only the header of the class itself would need to be included, however 
+		//       other classes may be referenced in the wrapper functions of the class and if the
+		//       headers of those classes aren't included the compilation will fail. The 
+		//       compilation error is usually a cryptic error C2664, and occurs while attempting 
+		//       to upcast a pointer to the class into a UObject*, this fails because the class is
+		//       only forward declared at that point and as such the compiler is unaware that the
+		//       class is derived from UObject.
+		TArray<FString>& sourceHeaders = shardSourceHeaders[shardIndex];
+		if (!exportedClass.SourceHeaderFilename.IsEmpty())
+		{
+			sourceHeaders.AddUnique(exportedClass.SourceHeaderFilename);
+		}
+		for (const FExportedFunction& function : exportedClass.Functions)
+		{
+			for (const FExportedProperty& param : function.Params)
+			{
+				AddReferencedClassInfo(param.Type, classHeaders, sourceHeaders);
+			}
+		}
+		for (const FExportedProperty& property : exportedClass.Properties)
+		{
+			AddReferencedClassInfo(property.Type, classHeaders, sourceHeaders);
+			AddReferencedClassInfo(property.ElementType, classHeaders, sourceHeaders);
+		}
+		shardScriptHeaders[shardIndex].Add(GetNativeGlueFilename(exportedClass.Name));
+		shardClasses[shardIndex].Add(&exportedClass);
+	}
+
+	for (int32 shardIndex = 0; shardIndex < NativeGlueShardCount; ++shardIndex)
+	{
+		// generate the file that will be included by NativeGlue/KlawrNativeGlueShard<N>.cpp
+		FCodeFormatter& generatedGlue = shardGlue[shardIndex];
+		
+		generatedGlue 
+			<< TEXT("// This file is autogenerated, DON'T EDIT it, if you do your changes will be lost!")
+			<< FCodeFormatter::LineTerminator();
+
+		// include the source headers of the classes in this shard
+		generatedGlue << TEXT("// The native classes which will be made scriptable:");
+		for (const auto& headerFilename : shardSourceHeaders[shardIndex])
+		{
+			// re-base to make sure we're including the right files on a remote machine
+			FString newFilename(RebaseToBuildPath(headerFilename));
+			generatedGlue.AppendLinef(TEXT("#include \"%s\""), *newFilename);
+		}
+
+		// include the script glue headers of the classes in this shard
+		generatedGlue << TEXT("// The autogenerated native wrappers:");
+		for (const auto& headerFilename : shardScriptHeaders[shardIndex])
+		{
+			FString newFilename(FPaths::GetCleanFilename(headerFilename));
+			generatedGlue.AppendLinef(TEXT("#include \"%s\""), *newFilename);
+		}
+
+		// generate a function that feeds the native wrapper functions to the CLR host
+		generatedGlue
+			<< FCodeFormatter::LineTerminator()
+			<< TEXT("namespace Klawr {")
+			<< TEXT("namespace NativeGlue {")
+			<< FCodeFormatter::LineTerminator();
+		generatedGlue.AppendLinef(TEXT("void RegisterWrapperClasses_%d()"), shardIndex);
+		generatedGlue << FCodeFormatter::OpenBrace();
+
+		for (const FExportedClass* exportedClass : shardClasses[shardIndex])
+		{
+			const FString& ClassName = exportedClass->Name;
+			generatedGlue.AppendLinef(
+				TEXT("IClrHost::Get()->AddClass(TEXT(\"%s\"), %s_WrapperFunctions, ")
+				TEXT("sizeof(%s_WrapperFunctions) / sizeof(%s_WrapperFunctions[0]));"),
+				*exportedClass->NativeName, *ClassName, *ClassName, *ClassName
+			);
+		}
+
+		generatedGlue 
+			<< FCodeFormatter::CloseBrace()
+			<< FCodeFormatter::LineTerminator()
+			<< TEXT("}} // namespace Klawr::NativeGlue");
+
+		// shards whose content didn't change aren't rewritten, so they won't be recompiled
+		WriteToFile(GetNativeGlueShardFilename(shardIndex), generatedGlue);
+	}
+
+	// generate the file that will be included by KlawrRuntimePlugin.cpp, it just calls the 
+	// registration functions of all the shards
+	FString glueFilename = GeneratedCodePath / TEXT("KlawrGeneratedNativeWrappers.inl");
+	FCodeFormatter generatedGlue(TEXT('\t'), 1);
+
+	generatedGlue 
+		<< TEXT("// This file is autogenerated, DON'T EDIT it, if you do your changes will be lost!")
+		<< FCodeFormatter::LineTerminator()
+		<< TEXT("namespace Klawr {")
+		<< TEXT("namespace NativeGlue {")
+		<< FCodeFormatter::LineTerminator();
+	generatedGlue.AppendLinef(
+		TEXT("static_assert(ShardCount == %d, \"NativeGlue::ShardCount doesn't match the code generator!\");"),
+		NativeGlueShardCount
+	);
+	generatedGlue << FCodeFormatter::LineTerminator();
+	for (int32 shardIndex = 0; shardIndex < NativeGlueShardCount; ++shardIndex)
+	{
+		generatedGlue.AppendLinef(TEXT("void RegisterWrapperClasses_%d();"), shardIndex);
+	}
+	generatedGlue
+		<< FCodeFormatter::LineTerminator()
+		<< TEXT("void RegisterWrapperClasses()")
+		<< FCodeFormatter::OpenBrace();
+	for (int32 shardIndex = 0; shardIndex < NativeGlueShardCount; ++shardIndex)
+	{
+		generatedGlue.AppendLinef(TEXT("RegisterWrapperClasses_%d();"), shardIndex);
+	}
+	generatedGlue 
+		<< FCodeFormatter::CloseBrace()
+		<< FCodeFormatter::LineTerminator()
+		<< TEXT("}} // namespace Klawr::NativeGlue");
+
+	WriteToFile(glueFilename, generatedGlue);
+	
+	for (int32 shardIndex = 0; shardIndex < NativeGlueShardCount; ++shardIndex)
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Log, TEXT("Native glue shard %d: %d classes, %d headers"),
+			shardIndex, shardClasses[shardIndex].Num(), shardSourceHeaders[shardIndex].Num()
+		);
+	}
+}
+
+void FCodeGenerator::WriteToFile(const FString& Path, const FString& Content)
+{
+	FString diskContent;
+	FFileHelper::LoadFileToString(diskContent, *Path);
+
+	const bool bContentChanged = (diskContent.Len() == 0) || FCString::Strcmp(*diskContent, *Content);
+	if (bContentChanged)
+	{
+		if (!FFileHelper::SaveStringToFile(Content, *Path))
+		{
+			UE_LOG(LogKlawrCodeGenerator, Warning, TEXT("Failed to save '%s'"), *Path);
+		}
+	}
+}
+
+bool FCodeGenerator::IsFileContentEqual(const FString& Path, const FCodeFormatter& Code)
+{
+	if (!Code.IsPureAscii())
+	{
+		FString diskContent;
+		FFileHelper::LoadFileToString(diskContent, *Path);
+		return (diskContent.Len() > 0) && !FCString::Strcmp(*diskContent, *Code.ToString());
+	}
+
+	// compare the code to what's on disk a chunk at a time, without concatenating it first
+	TArray<uint8> diskContent;
+	FFileHelper::LoadFileToArray(diskContent, *Path, FILEREAD_Silent);
+	bool bContentChanged = (diskContent.Num() == 0) || (diskContent.Num() != Code.Len());
+	if (!bContentChanged)
+	{
+		const uint8* diskChar = diskContent.GetData();
+		Code.ForEachChunk([&diskChar, &bContentChanged](const TCHAR* Text, int32 TextLength)
+		{
+			for (int32 i = 0; !bContentChanged && (i < TextLength); ++i)
+			{
+				bContentChanged = (*diskChar++ != (uint8)Text[i]);
+			}
+		});
+	}
+	return !bContentChanged;
+}
+
+void FCodeGenerator::WriteToFile(const FString& Path, const FCodeFormatter& Code)
+{
+	// SaveStringToFile() would write out anything that isn't plain ASCII as UTF-16, that's rare
+	// enough in generated code that it's not worth streaming
+	if (!Code.IsPureAscii())
+	{
+		WriteToFile(Path, Code.ToString());
+		return;
+	}
+
+	if (!IsFileContentEqual(Path, Code))
+	{
+		bool bSaved = false;
+		TAutoPtr<FArchive> writer(IFileManager::Get().CreateFileWriter(*Path));
+		if (writer.IsValid())
+		{
+			TArray<ANSICHAR> ansiChunk;
+			Code.ForEachChunk([&writer, &ansiChunk](const TCHAR* Text, int32 TextLength)
+			{
+				// chunks vary in size, so keep the buffer at the size of the largest one so far
+				ansiChunk.Reset();
+				ansiChunk.AddUninitialized(TextLength);
+				for (int32 i = 0; i < TextLength; ++i)
+				{
+					ansiChunk[i] = (ANSICHAR)Text[i];
+				}
+				writer->Serialize(ansiChunk.GetData(), ansiChunk.Num());
+			});
+			bSaved = writer->Close() && !writer->IsError();
+		}
+		if (!bSaved)
 		{
 			UE_LOG(LogKlawrCodeGenerator, Warning, TEXT("Failed to save '%s'"), *Path);
 		}
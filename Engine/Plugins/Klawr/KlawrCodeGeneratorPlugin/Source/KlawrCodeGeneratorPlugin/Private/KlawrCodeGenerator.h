@@ -23,9 +23,10 @@
 //-------------------------------------------------------------------------------
 #pragma once
 
-namespace Klawr {
+#include "KlawrExportedApi.h"
+#include "KlawrCodeFormatter.h"
 
-class FCodeFormatter;
+namespace Klawr {
 
 /**
  * Generates a C# wrapper class for each scriptable UE4 class.
@@ -53,6 +54,73 @@ public:
 	/** Check if the property type is a struct that can be used for interop. */
 	static bool IsStructPropertyTypeSupported(const UStructProperty* Property);
 
+	/** Measurements taken while generating the wrappers for an API. */
+	struct FWrapperGenerationStats
+	{
+		/** Time taken to generate the wrappers for every class. */
+		double Seconds;
+		/** Number of characters generated. */
+		int64 GeneratedLength;
+		/** Bytes allocated to hold the wrappers of every class once they've all been generated. */
+		int64 AllocatedSize;
+		/** Peak physical memory used by the process by the time the wrappers were generated. */
+		uint64 PeakUsedPhysical;
+		/** MD5 of the generated wrappers, in the same order and encoding they're written in. */
+		FString Digest;
+	};
+
+	/** 
+	 * Generate the wrappers for every class in an API, and check they match the wrappers in
+	 * ExpectedCodePath (named the same way as the generated wrappers are), or overwrite those if
+	 * bUpdateExpectedCode is set. The check is skipped if ExpectedCodePath is empty. Logs how long
+	 * the generation took and how much memory it used.
+	 * @return The number of wrapper files that are missing or differ from the generated ones.
+	 */
+	static int32 CheckWrapperGeneration(
+		const FExportedApi& Api, const FString& ExpectedCodePath, bool bUpdateExpectedCode,
+		FWrapperGenerationStats* OutStats = nullptr
+	);
+
+private:
+	/** A class whose wrappers still need to be generated. */
+	struct FPendingClassExport
+	{
+		/** Index of the class in ExportedApi.Classes. */
+		int32 ClassIndex;
+		FString NativeGlueFilename;
+		FString ManagedGlueFilename;
+	};
+
+	/** 
+	 * A C# assembly containing the managed wrappers of one or more modules, modules that depend 
+	 * on each other (directly or indirectly) share an assembly.
+	 */
+	struct FWrapperAssembly
+	{
+		/** e.g. "Klawr.UnrealEngine.UMG" */
+		FString Name;
+		TArray<FString> ModuleNames;
+		/** Indices of the assemblies this assembly references (in WrapperAssemblies). */
+		TArray<int32> References;
+		TArray<FString> ManagedGlueFilenames;
+	};
+
+	/** The wrappers generated for a class, or the reason they couldn't be generated. */
+	struct FGeneratedClassWrappers
+	{
+		FCodeFormatter NativeGlue;
+		FCodeFormatter ManagedGlue;
+		FString Error;
+		bool bSucceeded;
+
+		FGeneratedClassWrappers()
+			: NativeGlue(TEXT('\t'), 1)
+			, ManagedGlue(TEXT(' '), 4)
+			, bSucceeded(false)
+		{
+		}
+	};
+
 private:
 	static const FName Name_Vector2D;
 	static const FName Name_Vector;
@@ -63,6 +131,13 @@ private:
 	static const FName Name_Color;
 
 	static const FString ClrHostManagedAssemblyName;
+	/** Name of the core wrapper assembly, the other wrapper assembly names are derived from it. */
+	static const FString WrapperAssemblyName;
+	/** 
+	 * Number of separately compiled shards the native wrappers are split into, there must be a
+	 * NativeGlue/KlawrNativeGlueShard<N>.cpp in the runtime plugin for each one.
+	 */
+	static const int32 NativeGlueShardCount;
 		
 	/** Path where generated script glue goes **/
 	FString GeneratedCodePath;
@@ -72,33 +147,146 @@ private:
 	FString RootBuildPath;
 	/** Base include directory */
 	FString IncludeBase;
-	/** All generated C++ script header filenames. */
-	TArray<FString> AllScriptHeaders;
-	/** All the generated C# wrapper class filenames. */
-	TArray<FString> AllManagedWrapperFiles;
-	/** Engine source header filenames for all exported classes. */
-	TArray<FString> AllSourceClassHeaders;
-	/** Classes for which native wrappers were generated. */
-	TArray<const UClass*> ClassesWithNativeWrappers;
+	/** The C# wrapper assemblies, the core assembly is always the first one. */
+	TArray<FWrapperAssembly> WrapperAssemblies;
 	TArray<const UClass*> AllExportedClasses;
+	/** Everything the wrappers are generated from, gathered from the reflection data. */
+	FExportedApi ExportedApi;
+	/** Hash of the generator sources, included in every export signature. */
+	FString GeneratorSignature;
+	/** Class name -> export signature hash of every class exported during the previous run. */
+	TMap<FString, FString> PreviousExportSignatures;
+	/** Class name -> export signature hash of every class exported during this run. */
+	TMap<FString, FString> ExportSignatures;
+	/** Classes whose wrappers need to be generated, in the order they were exported. */
+	TArray<FPendingClassExport> PendingClassExports;
+	/** Set when the wrappers of at least one class had to be regenerated during this run. */
+	bool bWrappersChanged;
+	/** 
+	 * File listing the wrapper types and members used by the game scripts, only set when the 
+	 * wrappers should be trimmed down to those (see TrimExportedApi()).
+	 */
+	FString WrapperUsageFilename;
+	/** Names read from WrapperUsageFilename, e.g. "AActor" and "AActor.K2_DestroyActor". */
+	TSet<FString> WrapperUsage;
 
 	static bool CanExportClass(const UClass* Class);
 	static bool CanExportProperty(const UClass* Class, const UProperty* Property);
 	static bool CanExportFunction(const UClass* Class, const UFunction* Function);
 
-	/** Generate a .csproj for the C# wrapper classes. */
-	void GenerateManagedWrapperProject();
-	/** Build the generated .csproj of C# wrapper classes. */
-	void BuildManagedWrapperProject();
-	/** Create a 'glue' file that merges all generated script files */
+	/** Gather everything the wrapper generators need to know about a class. */
+	static FExportedClass GetExportedClass(
+		const UClass* Class, const UClass* WrapperSuperClass, bool bCanExport, 
+		const FString& SourceHeaderFilename
+	);
+	static FExportedProperty GetExportedProperty(const UProperty* Property);
+	static FExportedType GetExportedType(const UProperty* Property);
+
+	/** 
+	 * Generate the native and C# wrappers for a class, may be called on any thread.
+	 * @return false if the wrappers couldn't be generated, in which case OutError will be set.
+	 */
+	static bool GenerateClassWrappers(
+		const FExportedClass& Class, FCodeFormatter& OutNativeGlue, 
+		FCodeFormatter& OutManagedGlue, FString& OutError
+	);
+	/** 
+	 * Remove every class and member that isn't listed in WrapperUsage from the exported API, 
+	 * except for the classes the remaining wrappers still reference, and queue all the remaining
+	 * classes for generation. Enabled by setting KlawrWrapperUsageFile=<Filename> in the [Plugins]
+	 * section of the header tool's Engine.ini, the file is written by the KlawrWrapperUsage 
+	 * commandlet of the editor plugin.
+	 */
+	void TrimExportedApi();
+	/** 
+	 * Compute the export signature of every exported class, and queue the classes whose 
+	 * signatures changed since the previous run for generation.
+	 */
+	void QueueChangedClassExports();
+	/** Generate and write out the wrappers for all pending classes on multiple threads. */
+	void GenerateAllClassWrappers();
+	/** 
+	 * Regenerate the wrappers for every class in the API saved by the previous run, and check 
+	 * they match the wrappers already on disk, reporting how long that took. Enabled by setting
+	 * KlawrBenchmarkCodeGenerator=True in the [Plugins] section of the header tool's Engine.ini.
+	 */
+	void BenchmarkWrapperGeneration();
+	/** 
+	 * Split the C# wrapper classes between assemblies based on the modules the corresponding
+	 * classes are declared in, and the modules the wrappers of each module reference.
+	 */
+	void PartitionWrapperAssemblies();
+	/** Generate a .csproj for each C# wrapper assembly. */
+	void GenerateManagedWrapperProjects();
+	void GenerateManagedWrapperProject(
+		const FWrapperAssembly& Assembly, const FString& ResourcesBasePath
+	);
+	/** Build the generated .csproj files of C# wrapper classes. */
+	void BuildManagedWrapperProjects();
+	/** 
+	 * Split the generated native wrappers between a fixed number of 'glue' files (shards) that 
+	 * are compiled separately, and create a 'glue' file that registers the classes in all shards.
+	 */
 	void GlueAllNativeWrapperFiles();
+	/** Get a rough estimate of the cost of compiling the native wrappers of a class. */
+	static int64 GetNativeGlueWeight(const FExportedClass& Class);
+	/** 
+	 * Look up every class referenced by a type in ClassInfo (which is keyed by the prefixed class
+	 * name), and add the information found to OutInfo, e.g. to find the headers of the classes.
+	 */
+	static void AddReferencedClassInfo(
+		const FExportedType& Type, const TMap<FString, FString>& ClassInfo, 
+		TArray<FString>& OutInfo
+	);
 	
 	/** Check if a property type is supported */
 	static bool IsPropertyTypeSupported(const UProperty* Property);
 	/** Check if the property type is a pointer. */
 	static bool IsPropertyTypePointer(const UProperty* Property);
 
-	void WriteToFile(const FString& Path, const FString& Content);
+	/** 
+	 * Compute a hash of everything about a class itself that affects the wrappers generated for
+	 * it, the export signature of the class combines this with the hashes of the classes it 
+	 * references (see QueueChangedClassExports()).
+	 */
+	static FString GetExportSignature(FExportedClass& Class);
+	/** 
+	 * Compute a hash of the generator sources, so that the wrappers of every class are 
+	 * regenerated whenever the generators change.
+	 */
+	static FString GetGeneratorSignature();
+	/** Compute a hash of the contents of the C# wrapper project template. */
+	static FString GetWrapperProjectTemplateSignature();
+
+	FString GetManifestFilename() const;
+	/** Load the export signatures saved by the previous run. */
+	void LoadManifest();
+	/** Save the export signatures of this run so the next run can skip unchanged classes. */
+	void SaveManifest();
+	FString GetExportedApiFilename() const;
+	FString GetNativeGlueFilename(const FString& ClassName) const;
+	FString GetManagedGlueFilename(const FString& ClassName) const;
+	FString GetNativeGlueShardFilename(int32 ShardIndex) const;
+	/** 
+	 * Get the directory the C# wrapper projects are generated in, trimmed wrappers get their own
+	 * directory so they don't overwrite the projects of the full wrappers.
+	 */
+	FString GetWrapperProjectBasePath() const;
+	FString GetWrapperProjectFilename(const FWrapperAssembly& Assembly) const;
+	static FString GetWrapperProjectGuid(const FWrapperAssembly& Assembly);
+	/** 
+	 * Get the directory the wrapper assemblies are copied to once they're built, this is the 
+	 * engine binaries dir unless the wrappers are trimmed.
+	 */
+	FString GetWrapperAssemblyPath() const;
+	/** Get the filename of a wrapper assembly once it's been copied to GetWrapperAssemblyPath(). */
+	FString GetWrapperAssemblyFilename(const FWrapperAssembly& Assembly) const;
+
+	static void WriteToFile(const FString& Path, const FString& Content);
+	/** Write out formatted code a chunk at a time (unless the file already contains that code). */
+	static void WriteToFile(const FString& Path, const FCodeFormatter& Code);
+	/** Check if a file contains exactly the given code. */
+	static bool IsFileContentEqual(const FString& Path, const FCodeFormatter& Code);
 	FString RebaseToBuildPath(const FString& Filename) const;
 };
 
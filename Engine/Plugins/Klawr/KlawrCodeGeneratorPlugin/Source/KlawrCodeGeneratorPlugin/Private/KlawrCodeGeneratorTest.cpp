@@ -0,0 +1,436 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrCodeGeneratorPluginPrivatePCH.h"
+#include "KlawrCodeGeneratorTest.h"
+#include "KlawrCodeGenerator.h"
+
+namespace Klawr {
+
+static const uint64 ClassPropertyFlags = CPF_Edit | CPF_BlueprintVisible;
+static const uint64 ValueParamFlags = CPF_Parm;
+static const uint64 RefParamFlags = CPF_Parm | CPF_OutParm | CPF_ReferenceParm;
+static const uint64 ConstRefParamFlags = RefParamFlags | CPF_ConstParm;
+static const uint64 OutParamFlags = CPF_Parm | CPF_OutParm;
+static const uint64 ReturnParamFlags = CPF_Parm | CPF_OutParm | CPF_ReturnParm;
+
+static FExportedType MakeType(
+	EExportedTypeKind Kind, const TCHAR* CPPType, const TCHAR* PropertyClassName
+)
+{
+	FExportedType type;
+	type.Kind = Kind;
+	type.CPPType = CPPType;
+	type.PropertyClassName = PropertyClassName;
+	return type;
+}
+
+static FExportedType MakeBoolType(bool bIsNativeBool)
+{
+	FExportedType type = MakeType(
+		EExportedTypeKind::Bool, bIsNativeBool ? TEXT("bool") : TEXT("uint8"), 
+		TEXT("BoolProperty")
+	);
+	type.bIsNativeBool = bIsNativeBool;
+	return type;
+}
+
+/** Make one of the struct types that have a managed counterpart, e.g. "Vector". */
+static FExportedType MakeInteropStructType(const TCHAR* StructName)
+{
+	FExportedType type = MakeType(
+		EExportedTypeKind::Struct, *(FString(TEXT("F")) + StructName), TEXT("StructProperty")
+	);
+	type.StructName = StructName;
+	type.bIsInteropStruct = true;
+	return type;
+}
+
+static FExportedProperty MakeProperty(
+	const TCHAR* Name, const FExportedType& Type, uint64 PropertyFlags
+)
+{
+	FExportedProperty property;
+	property.Name = Name;
+	property.Type = Type;
+	property.PropertyFlags = PropertyFlags;
+	return property;
+}
+
+static FExportedProperty MakeArrayProperty(const TCHAR* Name, const FExportedType& ElementType)
+{
+	FExportedProperty property = MakeProperty(
+		Name, 
+		MakeType(
+			EExportedTypeKind::Array, *FString::Printf(TEXT("TArray<%s>"), *ElementType.CPPType),
+			TEXT("ArrayProperty")
+		),
+		ClassPropertyFlags
+	);
+	property.ElementType = ElementType;
+	return property;
+}
+
+static FExportedFunction MakeFunction(const TCHAR* Name)
+{
+	FExportedFunction function;
+	function.Name = Name;
+	function.FunctionFlags = FUNC_Public | FUNC_Native | FUNC_BlueprintCallable;
+	return function;
+}
+
+static FExportedFunction MakeGetter(const TCHAR* Name, const FExportedType& ReturnValueType)
+{
+	FExportedFunction function = MakeFunction(Name);
+	function.Params.Add(MakeProperty(TEXT("ReturnValue"), ReturnValueType, ReturnParamFlags));
+	return function;
+}
+
+static FExportedClass MakeClass(
+	const TCHAR* Name, const TCHAR* NativeName, const TCHAR* WrapperSuperClassNativeName
+)
+{
+	FExportedClass exportedClass;
+	exportedClass.Name = Name;
+	exportedClass.NativeName = NativeName;
+	exportedClass.WrapperSuperClassNativeName = WrapperSuperClassNativeName;
+	exportedClass.SourceHeaderFilename = 
+		FString::Printf(TEXT("KlawrTest/Public/%s.h"), Name);
+	exportedClass.ModuleName = TEXT("KlawrTest");
+	exportedClass.bCanExport = true;
+	exportedClass.bShouldGenerateManagedWrapper = true;
+	return exportedClass;
+}
+
+FExportedApi FCodeGeneratorTest::MakeTestApi()
+{
+	const FExportedType intType = 
+		MakeType(EExportedTypeKind::Int, TEXT("int32"), TEXT("IntProperty"));
+	const FExportedType floatType = 
+		MakeType(EExportedTypeKind::Float, TEXT("float"), TEXT("FloatProperty"));
+	const FExportedType nativeBoolType = MakeBoolType(true);
+	const FExportedType bitfieldBoolType = MakeBoolType(false);
+	const FExportedType strType = 
+		MakeType(EExportedTypeKind::Str, TEXT("FString"), TEXT("StrProperty"));
+	const FExportedType nameType = 
+		MakeType(EExportedTypeKind::Name, TEXT("FName"), TEXT("NameProperty"));
+	const FExportedType objectType = 
+		MakeType(EExportedTypeKind::Object, TEXT("AActor*"), TEXT("ObjectProperty"));
+	const FExportedType classType = 
+		MakeType(EExportedTypeKind::Class, TEXT("UClass*"), TEXT("ClassProperty"));
+	const FExportedType subclassOfType = 
+		MakeType(EExportedTypeKind::Class, TEXT("TSubclassOf<AActor>"), TEXT("ClassProperty"));
+	const FExportedType assetType = MakeType(
+		EExportedTypeKind::OtherObject, TEXT("TAssetPtr<AActor>"), TEXT("AssetObjectProperty")
+	);
+	const FExportedType vector2DType = MakeInteropStructType(TEXT("Vector2D"));
+	const FExportedType vectorType = MakeInteropStructType(TEXT("Vector"));
+	const FExportedType vector4Type = MakeInteropStructType(TEXT("Vector4"));
+	const FExportedType quatType = MakeInteropStructType(TEXT("Quat"));
+	const FExportedType transformType = MakeInteropStructType(TEXT("Transform"));
+	const FExportedType linearColorType = MakeInteropStructType(TEXT("LinearColor"));
+	const FExportedType colorType = MakeInteropStructType(TEXT("Color"));
+
+	FExportedApi api;
+
+	// a class with a property of every supported type
+	FExportedClass propertiesClass = 
+		MakeClass(TEXT("KlawrTestObject"), TEXT("UKlawrTestObject"), TEXT("UObject"));
+	TArray<FExportedProperty>& properties = propertiesClass.Properties;
+	properties.Add(MakeProperty(TEXT("IntValue"), intType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("FloatValue"), floatType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("bNativeBoolValue"), nativeBoolType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("bBitfieldBoolValue"), bitfieldBoolType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("StrValue"), strType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("NameValue"), nameType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("ObjectValue"), objectType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("ClassValue"), classType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("SubclassOfValue"), subclassOfType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("AssetValue"), assetType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("Vector2DValue"), vector2DType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("VectorValue"), vectorType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("Vector4Value"), vector4Type, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("QuatValue"), quatType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("TransformValue"), transformType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("LinearColorValue"), linearColorType, ClassPropertyFlags));
+	properties.Add(MakeProperty(TEXT("ColorValue"), colorType, ClassPropertyFlags));
+	properties.Add(MakeArrayProperty(TEXT("IntArray"), intType));
+	properties.Add(MakeArrayProperty(TEXT("FloatArray"), floatType));
+	properties.Add(MakeArrayProperty(TEXT("BoolArray"), nativeBoolType));
+	properties.Add(MakeArrayProperty(TEXT("StrArray"), strType));
+	properties.Add(MakeArrayProperty(TEXT("NameArray"), nameType));
+	properties.Add(MakeArrayProperty(TEXT("ObjectArray"), objectType));
+	properties.Add(MakeArrayProperty(TEXT("VectorArray"), vectorType));
+	api.Classes.Add(propertiesClass);
+
+	// a class with functions that take and return every supported type in every supported way,
+	// which can also be subclassed in C#
+	FExportedClass functionsClass = 
+		MakeClass(TEXT("KlawrTestActor"), TEXT("AKlawrTestActor"), TEXT("AActor"));
+	functionsClass.bShouldGenerateScriptObjectClass = true;
+	TArray<FExportedFunction>& functions = functionsClass.Functions;
+
+	functions.Add(MakeFunction(TEXT("ResetAll")));
+
+	FExportedFunction takeValues = MakeFunction(TEXT("TakeValues"));
+	takeValues.Params.Add(MakeProperty(TEXT("Count"), intType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Scale"), floatType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("bEnabled"), nativeBoolType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("bFlag"), bitfieldBoolType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Text"), strType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Tag"), nameType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Location"), vectorType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Actor"), objectType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("Class"), classType, ValueParamFlags));
+	takeValues.Params.Add(MakeProperty(TEXT("ActorClass"), subclassOfType, ValueParamFlags));
+	functions.Add(takeValues);
+
+	FExportedFunction takeRefs = MakeFunction(TEXT("TakeRefs"));
+	takeRefs.Params.Add(MakeProperty(TEXT("Count"), intType, RefParamFlags));
+	takeRefs.Params.Add(MakeProperty(TEXT("Scale"), floatType, RefParamFlags));
+	takeRefs.Params.Add(MakeProperty(TEXT("bEnabled"), nativeBoolType, RefParamFlags));
+	takeRefs.Params.Add(MakeProperty(TEXT("Tag"), nameType, RefParamFlags));
+	takeRefs.Params.Add(MakeProperty(TEXT("Transform"), transformType, RefParamFlags));
+	functions.Add(takeRefs);
+
+	FExportedFunction getOuts = MakeFunction(TEXT("GetOuts"));
+	getOuts.Params.Add(MakeProperty(TEXT("OutCount"), intType, OutParamFlags));
+	getOuts.Params.Add(MakeProperty(TEXT("OutScale"), floatType, OutParamFlags));
+	getOuts.Params.Add(MakeProperty(TEXT("bOutEnabled"), nativeBoolType, OutParamFlags));
+	getOuts.Params.Add(MakeProperty(TEXT("OutTag"), nameType, OutParamFlags));
+	getOuts.Params.Add(MakeProperty(TEXT("OutLinearColor"), linearColorType, OutParamFlags));
+	getOuts.Params.Add(MakeProperty(TEXT("OutColor"), colorType, OutParamFlags));
+	functions.Add(getOuts);
+
+	FExportedFunction takeConstRefs = MakeFunction(TEXT("TakeConstRefs"));
+	takeConstRefs.Params.Add(MakeProperty(TEXT("Text"), strType, ConstRefParamFlags));
+	takeConstRefs.Params.Add(MakeProperty(TEXT("Tag"), nameType, ConstRefParamFlags));
+	takeConstRefs.Params.Add(MakeProperty(TEXT("Rotation"), quatType, ConstRefParamFlags));
+	takeConstRefs.Params.Add(MakeProperty(TEXT("Plane"), vector4Type, ConstRefParamFlags));
+	takeConstRefs.Params.Add(MakeProperty(TEXT("Actor"), objectType, ConstRefParamFlags));
+	functions.Add(takeConstRefs);
+
+	functions.Add(MakeGetter(TEXT("GetCount"), intType));
+	functions.Add(MakeGetter(TEXT("GetScale"), floatType));
+	functions.Add(MakeGetter(TEXT("IsEnabled"), nativeBoolType));
+	functions.Add(MakeGetter(TEXT("GetText"), strType));
+	functions.Add(MakeGetter(TEXT("GetTag"), nameType));
+	functions.Add(MakeGetter(TEXT("GetSize"), vector2DType));
+	functions.Add(MakeGetter(TEXT("GetTransform"), transformType));
+	functions.Add(MakeGetter(TEXT("GetOwnerActor"), objectType));
+	functions.Add(MakeGetter(TEXT("GetActorClass"), classType));
+	functions.Add(MakeGetter(TEXT("GetSpawnClass"), subclassOfType));
+
+	// a function with both parameters and a return value
+	FExportedFunction findActor = MakeGetter(TEXT("FindActor"), objectType);
+	findActor.Params.Insert(MakeProperty(TEXT("Tag"), nameType, ValueParamFlags), 0);
+	findActor.Params.Insert(MakeProperty(TEXT("bFound"), nativeBoolType, OutParamFlags), 1);
+	functions.Add(findActor);
+	api.Classes.Add(functionsClass);
+
+	// a class whose wrapper is derived from the wrapper of another class in the API
+	FExportedClass derivedClass = MakeClass(
+		TEXT("KlawrTestDerivedActor"), TEXT("AKlawrTestDerivedActor"), TEXT("AKlawrTestActor")
+	);
+	derivedClass.Properties.Add(MakeProperty(TEXT("Speed"), floatType, ClassPropertyFlags));
+	derivedClass.Functions.Add(MakeGetter(TEXT("GetSpeed"), floatType));
+	api.Classes.Add(derivedClass);
+
+	// a class without any members to export, only the C# wrapper class is generated for it
+	FExportedClass emptyClass = 
+		MakeClass(TEXT("KlawrTestEmptyObject"), TEXT("UKlawrTestEmptyObject"), TEXT("UObject"));
+	emptyClass.bCanExport = false;
+	api.Classes.Add(emptyClass);
+
+	return api;
+}
+
+FExportedApi FCodeGeneratorTest::MakeSyntheticApi(int32 NumClasses)
+{
+	const FExportedApi testApi = MakeTestApi();
+	const FExportedClass& propertiesClass = testApi.Classes[0];
+	const FExportedClass& functionsClass = testApi.Classes[1];
+	// every class gets a quarter of the members of the test API, so four classes in a row cover
+	// all of them, and a class never has the same members as any of its (up to three) ancestors
+	const int32 memberStride = 4;
+
+	FExportedApi api;
+	api.Classes.Reserve(NumClasses);
+	for (int32 classIndex = 0; classIndex < NumClasses; ++classIndex)
+	{
+		// half the classes are actors that can be subclassed in C#, and most classes derive from
+		// the class two places before them so the inheritance chains are up to four classes deep
+		const bool bIsActor = (classIndex % 2) == 1;
+		FString superClassNativeName = bIsActor ? TEXT("AActor") : TEXT("UObject");
+		if ((classIndex % 8) >= 2)
+		{
+			superClassNativeName = api.Classes[classIndex - 2].NativeName;
+		}
+		const FString name = FString::Printf(
+			bIsActor ? TEXT("KlawrSyntheticActor%d") : TEXT("KlawrSyntheticObject%d"), classIndex
+		);
+		FExportedClass exportedClass = MakeClass(
+			*name, *((bIsActor ? TEXT("A") : TEXT("U")) + name), *superClassNativeName
+		);
+		exportedClass.bShouldGenerateScriptObjectClass = bIsActor;
+
+		// the odd class has nothing to export
+		if ((classIndex % 50) == 49)
+		{
+			exportedClass.bCanExport = false;
+		}
+		else
+		{
+			const int32 memberOffset = (classIndex / 2) % memberStride;
+			for (int32 i = memberOffset; i < propertiesClass.Properties.Num(); i += memberStride)
+			{
+				exportedClass.Properties.Add(propertiesClass.Properties[i]);
+			}
+			for (int32 i = memberOffset; i < functionsClass.Functions.Num(); i += memberStride)
+			{
+				exportedClass.Functions.Add(functionsClass.Functions[i]);
+			}
+		}
+		api.Classes.Add(exportedClass);
+	}
+	return api;
+}
+
+FString FCodeGeneratorTest::GetGoldenPath()
+{
+	return FPaths::EnginePluginsDir() / 
+		TEXT("Klawr/KlawrCodeGeneratorPlugin/Resources/CodeGeneratorTest");
+}
+
+FString FCodeGeneratorTest::GetSyntheticApiDigestFilename()
+{
+	return GetGoldenPath() / TEXT("SyntheticApi.md5");
+}
+
+FString FCodeGeneratorTest::GetTestApiFilename()
+{
+	return FPaths::EngineIntermediateDir() / TEXT("Klawr/CodeGeneratorTest/KlawrExportedApi.bin");
+}
+
+bool FCodeGeneratorTest::Run(bool bUpdateGolden)
+{
+	UE_LOG(
+		LogKlawrCodeGenerator, Display, TEXT("%s the code generator golden files in '%s'"),
+		bUpdateGolden ? TEXT("Updating") : TEXT("Checking against"), *GetGoldenPath()
+	);
+	// run both checks even if the first one fails, so all the differences are reported at once
+	const bool bTestApiPassed = CheckTestApi(bUpdateGolden);
+	const bool bSyntheticApiPassed = CheckSyntheticApi(bUpdateGolden);
+	return bTestApiPassed && bSyntheticApiPassed;
+}
+
+bool FCodeGeneratorTest::CheckTestApi(bool bUpdateGolden)
+{
+	// the wrappers are generated from the API as loaded from disk, the same way the benchmark 
+	// generates them, so that anything lost along the way shows up in the generated code
+	FExportedApi testApi = MakeTestApi();
+	FExportedApi loadedApi;
+	if (!testApi.SaveToFile(GetTestApiFilename()) || !loadedApi.LoadFromFile(GetTestApiFilename()))
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Error, TEXT("Failed to save and reload the test API in '%s'"),
+			*GetTestApiFilename()
+		);
+		return false;
+	}
+
+	const int32 numDifferences = 
+		FCodeGenerator::CheckWrapperGeneration(loadedApi, GetGoldenPath(), bUpdateGolden);
+	if (numDifferences > 0)
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Error, 
+			TEXT("%d generated wrapper files differ from the golden files, rerun with ")
+			TEXT("-UpdateGolden if the changes are intentional."),
+			numDifferences
+		);
+		return false;
+	}
+	return true;
+}
+
+bool FCodeGeneratorTest::CheckSyntheticApi(bool bUpdateGolden)
+{
+	FCodeGenerator::FWrapperGenerationStats stats;
+	FCodeGenerator::CheckWrapperGeneration(
+		MakeSyntheticApi(SyntheticClassCount), FString(), false, &stats
+	);
+
+	const FString digestFilename = GetSyntheticApiDigestFilename();
+	if (bUpdateGolden)
+	{
+		if (!FFileHelper::SaveStringToFile(stats.Digest, *digestFilename))
+		{
+			UE_LOG(
+				LogKlawrCodeGenerator, Error, TEXT("Failed to write '%s'"), *digestFilename
+			);
+			return false;
+		}
+		return true;
+	}
+
+	FString expectedDigest;
+	if (!FFileHelper::LoadFileToString(expectedDigest, *digestFilename))
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Error, TEXT("Failed to read '%s'"), *digestFilename
+		);
+		return false;
+	}
+	expectedDigest.Trim();
+	expectedDigest.TrimTrailing();
+	if (expectedDigest != stats.Digest)
+	{
+		UE_LOG(
+			LogKlawrCodeGenerator, Error, 
+			TEXT("The wrappers generated for the synthetic API differ from the golden files ")
+			TEXT("(digest %s, expected %s), rerun with -UpdateGolden if the changes are ")
+			TEXT("intentional."),
+			*stats.Digest, *expectedDigest
+		);
+		return false;
+	}
+	return true;
+}
+
+void FCodeGeneratorTest::Benchmark(int32 NumClasses)
+{
+	const FExportedApi api = MakeSyntheticApi(NumClasses);
+	FCodeGenerator::FWrapperGenerationStats stats;
+	FCodeGenerator::CheckWrapperGeneration(api, FString(), false, &stats);
+	UE_LOG(
+		LogKlawrCodeGenerator, Display, 
+		TEXT("Generated the wrappers for %d classes (%lld chars) in %.3f s, the wrappers took ")
+		TEXT("up %.1f MB, peak memory use was %.1f MB."),
+		NumClasses, stats.GeneratedLength, stats.Seconds, 
+		stats.AllocatedSize / (1024.0 * 1024.0), stats.PeakUsedPhysical / (1024.0 * 1024.0)
+	);
+}
+
+} // namespace Klawr
@@ -0,0 +1,153 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrCodeGeneratorPluginPrivatePCH.h"
+#include "KlawrExportedApi.h"
+
+namespace Klawr {
+
+// identifies exported API files, "KLEA" in little endian
+static const uint32 ExportedApiFileTag = 0x41454C4B;
+
+const int32 FExportedApi::FileVersion = 2;
+
+FArchive& operator<<(FArchive& Ar, FExportedType& Type)
+{
+	uint8 kind = static_cast<uint8>(Type.Kind);
+	Ar << kind;
+	Type.Kind = static_cast<EExportedTypeKind>(kind);
+	Ar << Type.CPPType;
+	Ar << Type.PropertyClassName;
+	Ar << Type.StructName;
+	Ar << Type.bIsInteropStruct;
+	Ar << Type.bIsNativeBool;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FExportedProperty& Property)
+{
+	Ar << Property.Name;
+	Ar << Property.Type;
+	// only arrays have an element type, there's no need to waste space on it for anything else
+	if (Property.Type.Kind == EExportedTypeKind::Array)
+	{
+		Ar << Property.ElementType;
+	}
+	Ar << Property.PropertyFlags;
+	Ar << Property.Offset;
+	Ar << Property.Size;
+	return Ar;
+}
+
+const FExportedProperty* FExportedFunction::GetReturnValue() const
+{
+	for (const FExportedProperty& param : Params)
+	{
+		if (param.HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			return &param;
+		}
+	}
+	return nullptr;
+}
+
+FArchive& operator<<(FArchive& Ar, FExportedFunction& Function)
+{
+	Ar << Function.Name;
+	Ar << Function.FunctionFlags;
+	Ar << Function.ParmsSize;
+	Ar << Function.Params;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FExportedClass& Class)
+{
+	Ar << Class.Name;
+	Ar << Class.NativeName;
+	Ar << Class.WrapperSuperClassNativeName;
+	Ar << Class.SourceHeaderFilename;
+	Ar << Class.ModuleName;
+	Ar << Class.bCanExport;
+	Ar << Class.bShouldGenerateManagedWrapper;
+	Ar << Class.bShouldGenerateScriptObjectClass;
+	Ar << Class.Functions;
+	Ar << Class.Properties;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FExportedApi& Api)
+{
+	Ar << Api.Classes;
+	return Ar;
+}
+
+const FExportedClass* FExportedApi::FindClass(const FString& Name) const
+{
+	return Classes.FindByPredicate([&Name](const FExportedClass& Class)
+	{
+		return Class.Name == Name;
+	});
+}
+
+bool FExportedApi::SaveToFile(const FString& Filename) const
+{
+	TArray<uint8> data;
+	FMemoryWriter writer(data);
+	uint32 tag = ExportedApiFileTag;
+	int32 version = FileVersion;
+	writer << tag;
+	writer << version;
+	// the writer only reads from the API
+	writer << const_cast<FExportedApi&>(*this);
+	return FFileHelper::SaveArrayToFile(data, *Filename);
+}
+
+bool FExportedApi::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> data;
+	if (!FFileHelper::LoadFileToArray(data, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader reader(data);
+	uint32 tag = 0;
+	int32 version = 0;
+	reader << tag;
+	reader << version;
+	if (reader.IsError() || (tag != ExportedApiFileTag) || (version != FileVersion))
+	{
+		return false;
+	}
+
+	reader << *this;
+	if (reader.IsError())
+	{
+		Classes.Empty();
+		return false;
+	}
+	return true;
+}
+
+} // namespace Klawr
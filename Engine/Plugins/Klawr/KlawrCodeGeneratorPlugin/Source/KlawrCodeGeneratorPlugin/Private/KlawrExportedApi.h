@@ -0,0 +1,205 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+namespace Klawr {
+
+/** 
+ * The kinds of types the wrapper generators distinguish between, these mirror the UProperty 
+ * subclasses that would otherwise have to be checked for.
+ */
+enum class EExportedTypeKind : uint8
+{
+	Int,
+	Float,
+	Double,
+	Bool,
+	Str,
+	Name,
+	/** UObjectProperty */
+	Object,
+	/** UClassProperty */
+	Class,
+	/** Any other UObjectPropertyBase (asset, lazy and weak object pointers). */
+	OtherObject,
+	Struct,
+	Array,
+	/** Anything else, no wrappers can be generated for these. */
+	Other
+};
+
+/** The type of a property, function parameter, return value, or array element. */
+struct FExportedType
+{
+	EExportedTypeKind Kind;
+	/** C++ type as it appears in the generated native wrappers, e.g. "AActor*". */
+	FString CPPType;
+	/** Name of the UProperty subclass the type was exported from, only used in error messages. */
+	FString PropertyClassName;
+	/** Name of the struct (without the prefix) if this is a struct type. */
+	FString StructName;
+	/** Set if this is a struct type that has a corresponding struct type in managed code. */
+	bool bIsInteropStruct;
+	/** Set if this is a bool type that's stored as a C++ bool rather than a bitfield. */
+	bool bIsNativeBool;
+
+	FExportedType()
+		: Kind(EExportedTypeKind::Other)
+		, bIsInteropStruct(false)
+		, bIsNativeBool(false)
+	{
+	}
+
+	/** Check if this is a UObjectProperty type (which includes UClassProperty). */
+	bool IsObject() const
+	{
+		return (Kind == EExportedTypeKind::Object) || (Kind == EExportedTypeKind::Class);
+	}
+
+	/** Check if this is any kind of UObject pointer type. */
+	bool IsAnyObject() const
+	{
+		return IsObject() || (Kind == EExportedTypeKind::OtherObject);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FExportedType& Type);
+};
+
+/** A class property or a function parameter (including the return value). */
+struct FExportedProperty
+{
+	FString Name;
+	FExportedType Type;
+	/** Type of the elements if this is an array property. */
+	FExportedType ElementType;
+	/** EPropertyFlags (CPF_*) of the property. */
+	uint64 PropertyFlags;
+	/** Offset of the property within its container (object or function parameters). */
+	int32 Offset;
+	int32 Size;
+
+	FExportedProperty()
+		: PropertyFlags(0)
+		, Offset(0)
+		, Size(0)
+	{
+	}
+
+	bool HasAnyPropertyFlags(uint64 Flags) const
+	{
+		return (PropertyFlags & Flags) != 0;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FExportedProperty& Property);
+};
+
+/** A function for which a wrapper can be generated. */
+struct FExportedFunction
+{
+	FString Name;
+	/** EFunctionFlags (FUNC_*) of the function. */
+	uint32 FunctionFlags;
+	/** Combined size of all the parameters (and the return value). */
+	int32 ParmsSize;
+	/** All the parameters in declaration order, the return value (if any) is one of these. */
+	TArray<FExportedProperty> Params;
+
+	FExportedFunction()
+		: FunctionFlags(0)
+		, ParmsSize(0)
+	{
+	}
+
+	/** Get the return value, or nullptr if the function doesn't return anything. */
+	const FExportedProperty* GetReturnValue() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FExportedFunction& Function);
+};
+
+/** 
+ * A class for which wrappers can be generated, only members that wrappers should be generated 
+ * for are included.
+ */
+struct FExportedClass
+{
+	/** Name of the class without the prefix, e.g. "Actor". */
+	FString Name;
+	/** Name of the class with the prefix, e.g. "AActor". */
+	FString NativeName;
+	/** 
+	 * Prefixed name of the class the C# wrapper class should be derived from, empty if the 
+	 * wrapper class shouldn't be derived from any other wrapper class.
+	 */
+	FString WrapperSuperClassNativeName;
+	/** Engine source header that declares the class, may be empty. */
+	FString SourceHeaderFilename;
+	/** Name of the module the class is declared in, e.g. "Engine". */
+	FString ModuleName;
+	/** Set if native wrappers should be generated for the class members. */
+	bool bCanExport;
+	bool bShouldGenerateManagedWrapper;
+	bool bShouldGenerateScriptObjectClass;
+	TArray<FExportedFunction> Functions;
+	TArray<FExportedProperty> Properties;
+
+	FExportedClass()
+		: bCanExport(false)
+		, bShouldGenerateManagedWrapper(false)
+		, bShouldGenerateScriptObjectClass(false)
+	{
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FExportedClass& Class);
+};
+
+/** 
+ * Everything the wrapper generators need to know about the exported engine API.
+ *
+ * This is gathered from the reflection data once while the header tool is running, and can be 
+ * saved to (and loaded from) a compact binary file, so the wrappers can be generated without
+ * access to the reflection data.
+ */
+struct FExportedApi
+{
+	/** All exported classes, in the order they were exported. */
+	TArray<FExportedClass> Classes;
+
+	/** Find an exported class by name (without the prefix). */
+	const FExportedClass* FindClass(const FString& Name) const;
+
+	bool SaveToFile(const FString& Filename) const;
+	/** 
+	 * Load an API previously saved with SaveToFile().
+	 * @return false if the file couldn't be loaded or was saved by an incompatible version.
+	 */
+	bool LoadFromFile(const FString& Filename);
+
+	friend FArchive& operator<<(FArchive& Ar, FExportedApi& Api);
+
+private:
+	/** Must be incremented whenever the layout of any of the exported types changes. */
+	static const int32 FileVersion;
+};
+
+} // namespace Klawr
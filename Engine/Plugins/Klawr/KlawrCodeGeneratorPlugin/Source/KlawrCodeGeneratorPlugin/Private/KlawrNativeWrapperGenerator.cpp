@@ -25,15 +25,17 @@
 #include "KlawrCodeGeneratorPluginPrivatePCH.h"
 #include "KlawrNativeWrapperGenerator.h"
 #include "KlawrCodeFormatter.h"
-#include "KlawrCodeGenerator.h"
+#include "KlawrExportedApi.h"
 
 namespace Klawr {
 
-FNativeWrapperGenerator::FNativeWrapperGenerator(const UClass* Class, FCodeFormatter& CodeFormatter)
-	: GeneratedGlue(CodeFormatter)
+FNativeWrapperGenerator::FNativeWrapperGenerator(
+	const FExportedClass& Class, FCodeFormatter& CodeFormatter
+)
+	: FriendlyClassName(Class.Name)
+	, NativeClassName(Class.NativeName)
+	, GeneratedGlue(CodeFormatter)
 {
-	Class->GetName(FriendlyClassName);
-	NativeClassName = FString::Printf(TEXT("%s%s"), Class->GetPrefixCPP(), *FriendlyClassName);
 }
 
 void FNativeWrapperGenerator::GenerateHeader()
@@ -86,24 +88,30 @@ void FNativeWrapperGenerator::GenerateFooter()
 	GeneratedGlue << TEXT("}} // namespace Klawr::NativeGlue");
 }
 
-void FNativeWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
+void FNativeWrapperGenerator::GenerateFunctionWrapper(const FExportedFunction& Function)
 {
 	FString formalArgs, actualArgs;
-	UProperty* returnValue = GetWrapperArgsAndReturnType(
+	const FExportedProperty* returnValue = GetWrapperArgsAndReturnType(
 		Function, formalArgs, actualArgs
 	);
 	FString returnValueTypeName(TEXT("void"));
 	if (returnValue)
 	{
-		returnValueTypeName = GetPropertyType(returnValue);
+		returnValueTypeName = GetReturnValueType(*returnValue);
 	}
 	// define a native wrapper function that will be bound to a managed delegate
-	GeneratedGlue << FString::Printf(
+	GeneratedGlue.AppendLinef(
 		TEXT("static %s %s(%s)"),
-		*returnValueTypeName, *Function->GetName(), *formalArgs
+		*returnValueTypeName, *Function.Name, *formalArgs
 	);
 	GeneratedGlue << FCodeFormatter::OpenBrace();
 
+	// UFunctions aren't thread-safe, so reject calls from concurrent script component ticks
+	GeneratedGlue.AppendLinef(
+		TEXT("KLAWR_CHECK_NOT_CONCURRENT(TEXT(\"%s::%s\"));"), 
+		*NativeClassName, *Function.Name
+	);
+
 	// call the wrapped UFunction
 	// FIXME: "Obj" isn't very unique, should pick a name that isn't likely to conflict with
 	//        regular function argument names.
@@ -112,22 +120,21 @@ void FNativeWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
 
 	// for non-const reference parameters to the UFunction copy their values from the 
 	// FDispatchParams struct
-	for (TFieldIterator<UProperty> paramIt(Function); paramIt; ++paramIt)
+	for (const FExportedProperty& param : Function.Params)
 	{
-		UProperty* param = *paramIt;
-		if (!param->HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm) &&
-			param->HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
+		if (!param.HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm) &&
+			param.HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
 		{
-			if (param->IsA<UNameProperty>())
+			if (param.Type.Kind == EExportedTypeKind::Name)
 			{
-				GeneratedGlue << FString::Printf(
-					TEXT("*%s = NameToScriptName(Params.%s);"), *param->GetName(), *param->GetName()
+				GeneratedGlue.AppendLinef(
+					TEXT("*%s = NameToScriptName(Params.%s);"), *param.Name, *param.Name
 				);
 			}
 			else
 			{
-				GeneratedGlue << FString::Printf(
-					TEXT("*%s = Params.%s;"), *param->GetName(), *param->GetName()
+				GeneratedGlue.AppendLinef(
+					TEXT("*%s = Params.%s;"), *param.Name, *param.Name
 				);
 			}
 		}
@@ -136,7 +143,7 @@ void FNativeWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
 	if (returnValue)
 	{
 		GenerateReturnValueHandler(
-			returnValue, FString::Printf(TEXT("Params.%s"), *returnValue->GetName())
+			returnValue->Type, FString::Printf(TEXT("Params.%s"), *returnValue->Name)
 		);
 	}
 
@@ -144,20 +151,19 @@ void FNativeWrapperGenerator::GenerateFunctionWrapper(const UFunction* Function)
 		<< FCodeFormatter::CloseBrace()
 		<< FCodeFormatter::LineTerminator();
 
-	FExportedFunction funcInfo;
+	FWrappedFunction funcInfo;
 	funcInfo.WrapperFunctionName = FString::Printf(
-		TEXT("%s::%s"), *FriendlyClassName, *Function->GetName()
+		TEXT("%s::%s"), *FriendlyClassName, *Function.Name
 	);
 	ExportedFunctions.Add(funcInfo);
 }
 
-void FNativeWrapperGenerator::GeneratePropertyWrapper(const UProperty* prop)
+void FNativeWrapperGenerator::GeneratePropertyWrapper(const FExportedProperty& prop)
 {
-	FExportedProperty exportedProperty;
-	auto arrayProp = Cast<UArrayProperty>(prop);
-	if (arrayProp)
+	FWrappedProperty exportedProperty;
+	if (prop.Type.Kind == EExportedTypeKind::Array)
 	{
-		exportedProperty.GetterWrapperFunctionName = GenerateArrayPropertyGetterWrapper(arrayProp);
+		exportedProperty.GetterWrapperFunctionName = GenerateArrayPropertyGetterWrapper(prop);
 		exportedProperty.SetterWrapperFunctionName.Empty();
 	}
 	else
@@ -168,38 +174,49 @@ void FNativeWrapperGenerator::GeneratePropertyWrapper(const UProperty* prop)
 	ExportedProperties.Add(exportedProperty);
 }
 
-FString FNativeWrapperGenerator::GetPropertyType(const UProperty* Property)
+FString FNativeWrapperGenerator::GetReturnValueType(const FExportedProperty& ReturnValue)
+{
+	// strings are passed into native wrapper functions as null-terminated TCHAR arrays,
+	// but returned as a pointer and length pair to avoid a heap allocation per string
+	if (ReturnValue.Type.Kind == EExportedTypeKind::Str)
+	{
+		return TEXT("StringRef");
+	}
+	return GetPropertyType(ReturnValue);
+}
+
+FString FNativeWrapperGenerator::GetPropertyType(const FExportedProperty& Property)
 {
 	FString typeName;
 
-	if (Property->IsA<UObjectPropertyBase>())
+	if (Property.Type.IsAnyObject())
 	{
 		return TEXT("void*");
 	}
-	else if (Property->IsA<UBoolProperty>())
+	else if (Property.Type.Kind == EExportedTypeKind::Bool)
 	{
 		// the managed wrapper functions marshal C# bool to uint8, so for the sake of consistency
 		// use uint8 instead of C++ bool in the native wrapper functions
 		typeName = TEXT("uint8");
 	}
-	else if (Property->IsA<UStrProperty>())
+	else if (Property.Type.Kind == EExportedTypeKind::Str)
 	{
 		return TEXT("const TCHAR*");
 	}
-	else if (Property->IsA<UNameProperty>())
+	else if (Property.Type.Kind == EExportedTypeKind::Name)
 	{
 		// FName arguments will get marshaled as FScriptName
 		typeName = TEXT("FScriptName");
 	}
 	else
 	{
-		typeName = FCodeGenerator::GetPropertyCPPType(Property);
+		typeName = Property.Type.CPPType;
 	}
 	// TODO: handle constness?
 	// return by reference must be converted to return by value because 
 	// FDispatchParams::ReturnValue is only valid within the scope of a native wrapper function
-	if (!(Property->GetPropertyFlags() & CPF_ReturnParm) &&
-		Property->HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
+	if (!Property.HasAnyPropertyFlags(CPF_ReturnParm) &&
+		Property.HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
 	{
 		typeName += TEXT("*");
 	}
@@ -207,51 +224,53 @@ FString FNativeWrapperGenerator::GetPropertyType(const UProperty* Property)
 	return typeName;
 }
 
-UProperty* FNativeWrapperGenerator::GetWrapperArgsAndReturnType(
-	const UFunction* Function, FString& OutFormalArgs, FString& OutActualArgs
+const FExportedProperty* FNativeWrapperGenerator::GetWrapperArgsAndReturnType(
+	const FExportedFunction& Function, FString& OutFormalArgs, FString& OutActualArgs
 )
 {
 	OutFormalArgs = TEXT("void* self");
 	OutActualArgs = TEXT("self");
-	UProperty* returnValue = nullptr;
+	const FExportedProperty* returnValue = nullptr;
 
-	for (TFieldIterator<UProperty> paramIt(Function); paramIt; ++paramIt)
+	for (const FExportedProperty& param : Function.Params)
 	{
-		UProperty* param = *paramIt;
-		if (param->GetPropertyFlags() & CPF_ReturnParm)
+		if (param.HasAnyPropertyFlags(CPF_ReturnParm))
 		{
-			returnValue = param;
+			returnValue = &param;
 		}
 		else
 		{
 			OutFormalArgs += FString::Printf(
-				TEXT(", %s %s"), *GetPropertyType(param), *param->GetName()
+				TEXT(", %s %s"), *GetPropertyType(param), *param.Name
 			);
-			OutActualArgs += FString::Printf(TEXT(", %s"), *param->GetName());
+			OutActualArgs += FString::Printf(TEXT(", %s"), *param.Name);
 		}
 	}
 
 	return returnValue;
 }
 
-FString FNativeWrapperGenerator::GetFunctionDispatchParamInitializer(const UProperty* Param)
+FString FNativeWrapperGenerator::GetFunctionDispatchParamInitializer(
+	const FExportedProperty& Param
+)
 {
-	if (!(Param->GetPropertyFlags() & CPF_ReturnParm))
+	const FExportedType& paramType = Param.Type;
+	if (!Param.HasAnyPropertyFlags(CPF_ReturnParm))
 	{
-		FString paramName = Param->GetName();
+		FString paramName = Param.Name;
 		FString initializer;
 
-		if (Param->IsA<UClassProperty>())
+		if (paramType.Kind == EExportedTypeKind::Class)
 		{
 			initializer = FString::Printf(TEXT("static_cast<UClass*>(%s)"), *paramName);
 		}
-		else if (Param->IsA<UObjectPropertyBase>())
+		else if (paramType.IsAnyObject())
 		{
 			initializer = FString::Printf(
-				TEXT("static_cast<%s>(%s)"), *FCodeGenerator::GetPropertyCPPType(Param), *paramName
+				TEXT("static_cast<%s>(%s)"), *paramType.CPPType, *paramName
 			);
 		}
-		else if (Param->IsA<UStrProperty>())
+		else if (paramType.Kind == EExportedTypeKind::Str)
 		{
 			initializer = paramName;
 		}
@@ -259,22 +278,23 @@ FString FNativeWrapperGenerator::GetFunctionDispatchParamInitializer(const UProp
 		{
 			// reference params are passed into a native wrapper function via a pointer,
 			// so dereference the pointer so that the value can be copied into FDispatchParams
-			if (Param->HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
+			if (Param.HasAnyPropertyFlags(CPF_OutParm | CPF_ReferenceParm))
 			{
 				paramName = FString::Printf(TEXT("(*%s)"), *paramName);
 			}
 
-			if (Param->IsA<UNameProperty>())
+			if (paramType.Kind == EExportedTypeKind::Name)
 			{
 				initializer = FString::Printf(TEXT("ScriptNameToName(%s)"), *paramName);
 			}
-			else if (Param->IsA<UIntProperty>() || Param->IsA<UFloatProperty>())
+			else if ((paramType.Kind == EExportedTypeKind::Int) || 
+				(paramType.Kind == EExportedTypeKind::Float))
 			{
 				initializer = paramName;
 			}
-			else if (Param->IsA<UBoolProperty>())
+			else if (paramType.Kind == EExportedTypeKind::Bool)
 			{
-				if (CastChecked<UBoolProperty>(Param)->IsNativeBool())
+				if (paramType.bIsNativeBool)
 				{
 					// explicitly convert uint8 to bool
 					initializer = FString::Printf(TEXT("!!%s"), *paramName);
@@ -284,18 +304,16 @@ FString FNativeWrapperGenerator::GetFunctionDispatchParamInitializer(const UProp
 					initializer = paramName;
 				}
 			}
-			else if (Param->IsA<UStructProperty>())
+			else if (paramType.Kind == EExportedTypeKind::Struct)
 			{
-				auto structProp = CastChecked<UStructProperty>(Param);
-				if (FCodeGenerator::IsStructPropertyTypeSupported(structProp))
+				if (paramType.bIsInteropStruct)
 				{
 					initializer = paramName;
 				}
 				else
 				{
 					FError::Throwf(
-						TEXT("Unsupported function param struct type: %s"),
-						*structProp->Struct->GetName()
+						TEXT("Unsupported function param struct type: %s"), *paramType.StructName
 					);
 				}
 			}
@@ -304,104 +322,97 @@ FString FNativeWrapperGenerator::GetFunctionDispatchParamInitializer(const UProp
 		if (initializer.IsEmpty())
 		{
 			FError::Throwf(
-				TEXT("Unsupported function param type: %s"), *Param->GetClass()->GetName()
+				TEXT("Unsupported function param type: %s"), *paramType.PropertyClassName
 			);
 		}
 		return initializer;
 	}
 	else // Param is actually the return value
 	{
-		if (Param->IsA<UObjectPropertyBase>())
+		if (paramType.IsAnyObject())
 		{
 			return TEXT("nullptr");
 		}
 		else
 		{
-			return FString::Printf(TEXT("%s()"), *FCodeGenerator::GetPropertyCPPType(Param));
+			return FString::Printf(TEXT("%s()"), *paramType.CPPType);
 		}
 	}
 }
 
 void FNativeWrapperGenerator::GenerateReturnValueHandler(
-	const UProperty* ReturnValue, const FString& ReturnValueName
+	const FExportedType& ReturnValueType, const FString& ReturnValueName
 )
 {
-	if (ReturnValue)
+	if (ReturnValueType.IsAnyObject())
 	{
-		if (ReturnValue->IsA<UObjectPropertyBase>())
+		// TODO: the assumption here is that UClass instances will be kept alive anyway, so
+		//       no need to add a reference... but that's just be wishful thinking, need to 
+		//       investigate!
+		if (ReturnValueType.Kind != EExportedTypeKind::Class)
 		{
-			// TODO: the assumption here is that UClass instances will be kept alive anyway, so
-			//       no need to add a reference... but that's just be wishful thinking, need to 
-			//       investigate!
-			if (!ReturnValue->IsA<UClassProperty>())
-			{
-				GeneratedGlue
-					<< FString::Printf(TEXT("if (%s)"), *ReturnValueName)
-					<< FCodeFormatter::OpenBrace()
-						<< FString::Printf(
-							TEXT("FObjectReferencer::AddObjectRef(%s);"), *ReturnValueName
-						)
-					<< FCodeFormatter::CloseBrace();
-			}
-			GeneratedGlue << FString::Printf(TEXT("return static_cast<UObject*>(%s);"), *ReturnValueName);
+			GeneratedGlue
+				<< FString::Printf(TEXT("if (%s)"), *ReturnValueName)
+				<< FCodeFormatter::OpenBrace()
+					<< FString::Printf(
+						TEXT("FObjectReferencer::AddObjectRef(%s);"), *ReturnValueName
+					)
+				<< FCodeFormatter::CloseBrace();
 		}
-		else if (ReturnValue->IsA<UIntProperty>() || 
-			ReturnValue->IsA<UFloatProperty>() ||
-			ReturnValue->IsA<UBoolProperty>())
-		{
-			GeneratedGlue << FString::Printf(TEXT("return %s;"), *ReturnValueName);
-		}
-		else if (ReturnValue->IsA<UStrProperty>())
-		{
-			GeneratedGlue << FString::Printf(
-				TEXT("return MakeStringCopyForCLR(*%s);"), *ReturnValueName
-			);
-		}
-		else if (ReturnValue->IsA<UNameProperty>())
-		{
-			GeneratedGlue << FString::Printf(
-				TEXT("return NameToScriptName(%s);"), *ReturnValueName
-			);
-		}
-		else if (ReturnValue->IsA<UStructProperty>())
+		GeneratedGlue.AppendLinef(TEXT("return static_cast<UObject*>(%s);"), *ReturnValueName);
+	}
+	else if ((ReturnValueType.Kind == EExportedTypeKind::Int) || 
+		(ReturnValueType.Kind == EExportedTypeKind::Float) ||
+		(ReturnValueType.Kind == EExportedTypeKind::Bool))
+	{
+		GeneratedGlue.AppendLinef(TEXT("return %s;"), *ReturnValueName);
+	}
+	else if (ReturnValueType.Kind == EExportedTypeKind::Str)
+	{
+		GeneratedGlue.AppendLinef(
+			TEXT("return FThreadStringScratch::MakeStringRef(%s);"), *ReturnValueName
+		);
+	}
+	else if (ReturnValueType.Kind == EExportedTypeKind::Name)
+	{
+		GeneratedGlue.AppendLinef(
+			TEXT("return NameToScriptName(%s);"), *ReturnValueName
+		);
+	}
+	else if (ReturnValueType.Kind == EExportedTypeKind::Struct)
+	{
+		if (ReturnValueType.bIsInteropStruct)
 		{
-			auto structProp = CastChecked<UStructProperty>(ReturnValue);
-			if (FCodeGenerator::IsStructPropertyTypeSupported(structProp))
-			{
-				GeneratedGlue << FString::Printf(TEXT("return %s;"), *ReturnValueName);
-			}
-			else
-			{
-				FError::Throwf(
-					TEXT("Unsupported function return value struct type: %s"), 
-					*structProp->Struct->GetName()
-				);
-			}
+			GeneratedGlue.AppendLinef(TEXT("return %s;"), *ReturnValueName);
 		}
 		else
 		{
 			FError::Throwf(
-				TEXT("Unsupported function return type: %s"), *ReturnValue->GetClass()->GetName()
+				TEXT("Unsupported function return value struct type: %s"), 
+				*ReturnValueType.StructName
 			);
 		}
 	}
+	else
+	{
+		FError::Throwf(
+			TEXT("Unsupported function return type: %s"), *ReturnValueType.PropertyClassName
+		);
+	}
 }
 
-void FNativeWrapperGenerator::GenerateFunctionDispatch(const UFunction* Function)
+void FNativeWrapperGenerator::GenerateFunctionDispatch(const FExportedFunction& Function)
 {
-	const bool bHasParamsOrReturnValue = (Function->Children != NULL);
+	const bool bHasParamsOrReturnValue = (Function.Params.Num() > 0);
 	if (bHasParamsOrReturnValue)
 	{
 		GeneratedGlue
 			<< TEXT("struct FDispatchParams")
 			<< FCodeFormatter::OpenBrace();
 
-		for (TFieldIterator<UProperty> paramIt(Function); paramIt; ++paramIt)
+		for (const FExportedProperty& param : Function.Params)
 		{
-			UProperty* param = *paramIt;
-			GeneratedGlue << FString::Printf(
-				TEXT("%s %s;"), *FCodeGenerator::GetPropertyCPPType(param), *param->GetName()
-			);
+			GeneratedGlue.AppendLinef(TEXT("%s %s;"), *param.Type.CPPType, *param.Name);
 		}
 
 		GeneratedGlue
@@ -409,11 +420,10 @@ void FNativeWrapperGenerator::GenerateFunctionDispatch(const UFunction* Function
 			<< TEXT("Params =")
 			<< FCodeFormatter::OpenBrace();
 
-		int32 paramIndex = 0;
-		for (TFieldIterator<UProperty> paramIt(Function); paramIt; ++paramIt, ++paramIndex)
+		for (const FExportedProperty& param : Function.Params)
 		{
-			GeneratedGlue << FString::Printf(
-				TEXT("%s,"), *GetFunctionDispatchParamInitializer(*paramIt)
+			GeneratedGlue.AppendLinef(
+				TEXT("%s,"), *GetFunctionDispatchParamInitializer(param)
 			);
 		}
 
@@ -422,9 +432,9 @@ void FNativeWrapperGenerator::GenerateFunctionDispatch(const UFunction* Function
 			<< TEXT(";");
 	}
 
-	GeneratedGlue << FString::Printf(
+	GeneratedGlue.AppendLinef(
 		TEXT("static UFunction* Function = Obj->FindFunctionChecked(TEXT(\"%s\"));"),
-		*Function->GetName()
+		*Function.Name
 	);
 
 	if (bHasParamsOrReturnValue)
@@ -439,11 +449,11 @@ void FNativeWrapperGenerator::GenerateFunctionDispatch(const UFunction* Function
 	}
 }
 
-FString FNativeWrapperGenerator::GeneratePropertyGetterWrapper(const UProperty* Property)
+FString FNativeWrapperGenerator::GeneratePropertyGetterWrapper(const FExportedProperty& Property)
 {
 	// define a native getter wrapper function that will be bound to a managed delegate
-	const FString propertyTypeName = GetPropertyType(Property);
-	const FString getterName = FString::Printf(TEXT("Get_%s"), *Property->GetName());
+	const FString propertyTypeName = GetReturnValueType(Property);
+	const FString getterName = FString::Printf(TEXT("Get_%s"), *Property.Name);
 	
 	GeneratedGlue 
 		<< FString::Printf(TEXT("static %s %s(void* self)"), *propertyTypeName, *getterName)
@@ -453,14 +463,25 @@ FString FNativeWrapperGenerator::GeneratePropertyGetterWrapper(const UProperty*
 		<< TEXT("UObject* Obj = static_cast<UObject*>(self);")
 		<< FString::Printf(
 			TEXT("static UProperty* Property = FindScriptPropertyHelper(%s::StaticClass(), TEXT(\"%s\"));"),
-			*NativeClassName, *Property->GetName()
-		)
-		<< FString::Printf(
-			TEXT("%s PropertyValue;\r\n"), *FCodeGenerator::GetPropertyCPPType(Property)
-		)
-		<< TEXT("Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));");
-			
-	GenerateReturnValueHandler(Property, TEXT("PropertyValue"));
+			*NativeClassName, *Property.Name
+		);
+
+	if (Property.Type.Kind == EExportedTypeKind::Str)
+	{
+		// the property outlives the call, so managed code can read the characters directly 
+		// from the property without copying them first
+		GeneratedGlue << TEXT("return MakeStringRef(*Property->ContainerPtrToValuePtr<FString>(Obj));");
+	}
+	else
+	{
+		GeneratedGlue
+			<< FString::Printf(
+				TEXT("%s PropertyValue;\r\n"), *Property.Type.CPPType
+			)
+			<< TEXT("Property->CopyCompleteValue(&PropertyValue, Property->ContainerPtrToValuePtr<void>(Obj));");
+
+		GenerateReturnValueHandler(Property.Type, TEXT("PropertyValue"));
+	}
 	
 	GeneratedGlue 
 		<< FCodeFormatter::CloseBrace()
@@ -469,29 +490,33 @@ FString FNativeWrapperGenerator::GeneratePropertyGetterWrapper(const UProperty*
 	return FString::Printf(TEXT("%s::%s"), *FriendlyClassName, *getterName);
 }
 
-FString FNativeWrapperGenerator::GeneratePropertySetterWrapper(const UProperty* Property)
+FString FNativeWrapperGenerator::GeneratePropertySetterWrapper(const FExportedProperty& Property)
 {
 	// define a native setter wrapper function that will be bound to a managed delegate
 	const FString propertyTypeName = GetPropertyType(Property);
-	const FString setterName = FString::Printf(TEXT("Set_%s"), *Property->GetName());
+	const FString setterName = FString::Printf(TEXT("Set_%s"), *Property.Name);
 
 	GeneratedGlue 
 		<< FString::Printf(
 			TEXT("static void %s(void* self, %s %s)"), 
-			*setterName, *propertyTypeName, *Property->GetName()
+			*setterName, *propertyTypeName, *Property.Name
 		)
 		<< FCodeFormatter::OpenBrace()
+		// concurrent script component ticks may read properties but not write them
+		<< FString::Printf(
+			TEXT("KLAWR_CHECK_NOT_CONCURRENT(TEXT(\"%s::%s\"));"), 
+			*NativeClassName, *setterName
+		)
 		// FIXME: "Obj" isn't very unique, should pick a name that isn't likely to conflict with
 		//        regular function argument names.
 		<< TEXT("UObject* Obj = static_cast<UObject*>(self);")
 		<< FString::Printf(
 			TEXT("static UProperty* Property = FindScriptPropertyHelper(%s::StaticClass(), TEXT(\"%s\"));"), 
-			*NativeClassName, *Property->GetName()
+			*NativeClassName, *Property.Name
 		)
 		<< FString::Printf(
 			TEXT("%s PropertyValue = %s;"),
-			*FCodeGenerator::GetPropertyCPPType(Property), 
-			*GetFunctionDispatchParamInitializer(Property)
+			*Property.Type.CPPType, *GetFunctionDispatchParamInitializer(Property)
 		)
 		<< TEXT("Property->CopyCompleteValue(Property->ContainerPtrToValuePtr<void>(Obj), &PropertyValue);")
 		<< FCodeFormatter::CloseBrace()
@@ -500,22 +525,23 @@ FString FNativeWrapperGenerator::GeneratePropertySetterWrapper(const UProperty*
 	return FString::Printf(TEXT("%s::%s"), *FriendlyClassName, *setterName);
 }
 
-FString FNativeWrapperGenerator::GenerateArrayPropertyGetterWrapper(const UArrayProperty* arrayProp)
+FString FNativeWrapperGenerator::GenerateArrayPropertyGetterWrapper(
+	const FExportedProperty& arrayProp
+)
 {
 	// define a native getter wrapper function that will be bound to a managed delegate
-	const FString propertyTypeName = GetPropertyType(arrayProp);
-	const FString getterName = FString::Printf(TEXT("Get_%s"), *arrayProp->GetName());
+	const FString getterName = FString::Printf(TEXT("Get_%s"), *arrayProp.Name);
 
 	GeneratedGlue
 		<< FString::Printf(TEXT("static FArrayHelper* %s(%s* self)"), *getterName, *NativeClassName)
 		<< FCodeFormatter::OpenBrace()
 			<< FString::Printf(
 				TEXT("static UArrayProperty* prop = Cast<UArrayProperty>(FindScriptPropertyHelper(%s::StaticClass(), TEXT(\"%s\")));"),
-				*NativeClassName, *arrayProp->GetName()
+				*NativeClassName, *arrayProp.Name
 			)
 			<< FString::Printf(
 				TEXT("return new TArrayHelper<%s>(&self->%s, prop);"), 
-				*FCodeGenerator::GetPropertyCPPType(arrayProp->Inner), *arrayProp->GetName()
+				*arrayProp.ElementType.CPPType, *arrayProp.Name
 			)
 		<< FCodeFormatter::CloseBrace()
 		<< FCodeFormatter::LineTerminator();
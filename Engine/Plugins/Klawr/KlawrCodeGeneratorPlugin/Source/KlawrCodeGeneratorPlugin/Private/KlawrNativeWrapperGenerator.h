@@ -25,15 +25,20 @@
 
 namespace Klawr {
 
+struct FExportedClass;
+struct FExportedFunction;
+struct FExportedProperty;
+struct FExportedType;
+
 /** Generates native wrapper functions for a UObject-derived class. */
 class FNativeWrapperGenerator
 {
 public:
-	FNativeWrapperGenerator(const UClass* Class, class FCodeFormatter& CodeFormatter);
+	FNativeWrapperGenerator(const FExportedClass& Class, class FCodeFormatter& CodeFormatter);
 
 	void GenerateHeader();
-	void GenerateFunctionWrapper(const UFunction* Function);
-	void GeneratePropertyWrapper(const UProperty* Property);
+	void GenerateFunctionWrapper(const FExportedFunction& Function);
+	void GeneratePropertyWrapper(const FExportedProperty& Property);
 	void GenerateFooter();
 
 	/** Get number of properties wrapped. */
@@ -42,39 +47,41 @@ public:
 	int32 GetFunctionCount() const { return ExportedFunctions.Num(); }
 	
 private:
-	struct FExportedProperty
+	struct FWrappedProperty
 	{
 		FString GetterWrapperFunctionName;
 		FString SetterWrapperFunctionName;
 	};
 
-	struct FExportedFunction
+	struct FWrappedFunction
 	{
 		FString WrapperFunctionName;
 	};
 
 private:
-	static FString GetPropertyType(const UProperty* Property);
-	static UProperty* GetWrapperArgsAndReturnType(
-		const UFunction* Function, FString& OutFormalArgs, FString& OutActualArgs
+	static FString GetPropertyType(const FExportedProperty& Property);
+	/** Get the type a native wrapper function should use to return a value to managed code. */
+	static FString GetReturnValueType(const FExportedProperty& ReturnValue);
+	static const FExportedProperty* GetWrapperArgsAndReturnType(
+		const FExportedFunction& Function, FString& OutFormalArgs, FString& OutActualArgs
 	);
-	static FString GetFunctionDispatchParamInitializer(const UProperty* Param);
+	static FString GetFunctionDispatchParamInitializer(const FExportedProperty& Param);
 
 	/** Generate a statement returning the given value. */
 	void GenerateReturnValueHandler(
-		const UProperty* ReturnValue, const FString& ReturnValueName
+		const FExportedType& ReturnValueType, const FString& ReturnValueName
 	);
-	void GenerateFunctionDispatch(const UFunction* Function);
-	FString GeneratePropertyGetterWrapper(const UProperty* Property);
-	FString GeneratePropertySetterWrapper(const UProperty* Property);
-	FString GenerateArrayPropertyGetterWrapper(const UArrayProperty* Property);
+	void GenerateFunctionDispatch(const FExportedFunction& Function);
+	FString GeneratePropertyGetterWrapper(const FExportedProperty& Property);
+	FString GeneratePropertySetterWrapper(const FExportedProperty& Property);
+	FString GenerateArrayPropertyGetterWrapper(const FExportedProperty& Property);
 
 private:
 	FString FriendlyClassName;
 	FString NativeClassName;
 	class FCodeFormatter& GeneratedGlue;
-	TArray<FExportedFunction> ExportedFunctions;
-	TArray<FExportedProperty> ExportedProperties;
+	TArray<FWrappedFunction> ExportedFunctions;
+	TArray<FWrappedProperty> ExportedProperties;
 };
 
 } // namespace Klawr
@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+namespace Klawr {
+
+struct FExportedApi;
+
+/**
+ * Checks the wrapper generators against the wrappers that were generated when the generators were
+ * last known to be correct (the golden files), and measures how long the generators take.
+ *
+ * The checks don't depend on the engine headers or the header tool, the wrappers are generated 
+ * from two APIs built in code instead. The test API covers every property, parameter and return
+ * value type the generators support, and the wrappers generated from it are compared file by file.
+ * The synthetic API mixes the members of the test API into thousands of classes to match the size
+ * of the engine API, only a digest of the wrappers generated from it is checked in. The checks are
+ * run by the KlawrCodeGeneratorTest program.
+ */
+class KLAWRCODEGENERATORPLUGIN_API FCodeGeneratorTest
+{
+public:
+	/** Number of classes in the synthetic API checked by Run(). */
+	static const int32 SyntheticClassCount = 2000;
+
+	/** 
+	 * @return true if the wrappers generated from the test and synthetic APIs match the golden 
+	 *         files, or if bUpdateGolden is set and the golden files were regenerated.
+	 */
+	static bool Run(bool bUpdateGolden);
+
+	/** 
+	 * Generate the wrappers for a synthetic API with the given number of classes, and log how 
+	 * long that took and how much memory was used.
+	 */
+	static void Benchmark(int32 NumClasses);
+
+private:
+	/** Build the test API. */
+	static FExportedApi MakeTestApi();
+	/** Build an API with the given number of classes out of the members of the test API. */
+	static FExportedApi MakeSyntheticApi(int32 NumClasses);
+
+	static bool CheckTestApi(bool bUpdateGolden);
+	static bool CheckSyntheticApi(bool bUpdateGolden);
+	static FString GetGoldenPath();
+	static FString GetSyntheticApiDigestFilename();
+	static FString GetTestApiFilename();
+};
+
+} // namespace Klawr
@@ -43,6 +43,7 @@ namespace UnrealBuildTool.Rules
                     "EditorStyle",
                     "DesktopPlatform",
                     "DirectoryWatcher",
+                    "WorkspaceMenuStructure",
 					// ... add private dependencies that you statically link with here ...
 				}
 			);
@@ -118,7 +118,7 @@ bool FCSharpProject::AddSourceFile(const FString& InSourceFilename, const FStrin
 	return false;
 }
 
-void FCSharpProject::AddAssemblyReference(const FString& InAssemblyFilename, bool bCopyLocal)
+bool FCSharpProject::AddAssemblyReference(const FString& InAssemblyFilename, bool bCopyLocal)
 {
 	// look for an existing ItemGroup containing the assembly references
 	if (!ReferencesNode)
@@ -134,17 +134,26 @@ void FCSharpProject::AddAssemblyReference(const FString& InAssemblyFilename, boo
 
 	if (ReferencesNode)
 	{
+		const FString AssemblyName = FPaths::GetCleanFilename(InAssemblyFilename);
+		// only add the reference if it's not already in the project
+		if (ReferencesNode.find_child_by_attribute(TEXT("Reference"), TEXT("Include"), *AssemblyName))
+		{
+			return false;
+		}
+
 		FString AssemblyFilename = FPaths::ConvertRelativePathToFull(InAssemblyFilename);
 		FPaths::MakePlatformFilename(AssemblyFilename);
 
 		auto RefNode = ReferencesNode.append_child(TEXT("Reference"));
-		RefNode.append_attribute(TEXT("Include")) = *FPaths::GetCleanFilename(InAssemblyFilename);
+		RefNode.append_attribute(TEXT("Include")) = *AssemblyName;
 		RefNode.append_child(TEXT("HintPath")).text() = *AssemblyFilename;
 		if (!bCopyLocal)
 		{
 			RefNode.append_child(TEXT("Private")).text() = TEXT("False");
 		}
+		return true;
 	}
+	return false;
 }
 
 void FCSharpProject::SetProjectGuid(const FGuid& Guid)
@@ -53,8 +53,10 @@ public:
 	 * Add an assembly reference to the project.
 	 * @param bCopyLocal If true the referenced assembly will be copied to the output directory,
 	 *                   true by default.
+	 * @return true if the reference was added to the project, false if it wasn't (either because
+	 *         some error occurred, or the assembly was already referenced)
 	 */
-	void AddAssemblyReference(const FString& AssemblyFilename, bool bCopyLocal = true);
+	bool AddAssemblyReference(const FString& AssemblyFilename, bool bCopyLocal = true);
 
 	void SetProjectGuid(const FGuid& Guid);
 	void SetRootNamespace(const FString& RootNamespace);
@@ -30,11 +30,17 @@
 #include "IKlawrRuntimePlugin.h"
 #include "KlawrGameProjectBuilder.h"
 #include "KlawrScriptsReloader.h"
+#include "Widgets/SScriptProfiler.h"
+#include "WorkspaceMenuStructureModule.h"
 
 DEFINE_LOG_CATEGORY(LogKlawrEditorPlugin);
 
+#define LOCTEXT_NAMESPACE "KlawrEditorPlugin"
+
 namespace Klawr {
 
+static const FName ScriptProfilerTabName(TEXT("KlawrScriptProfiler"));
+
 class FEditorPlugin : public IKlawrEditorPlugin, IBlueprintCompiler
 {
 private:
@@ -71,6 +77,15 @@ private:
 		}
 	}
 
+	TSharedRef<SDockTab> SpawnScriptProfilerTab(const FSpawnTabArgs& Args)
+	{
+		return SNew(SDockTab)
+			.TabRole(ETabRole::NomadTab)
+			[
+				SNew(SScriptProfiler)
+			];
+	}
+
 	void OnBeginPIE(const bool bIsSimulating)
 	{
 		UE_LOG(LogKlawrEditorPlugin, Display, TEXT("Creating a new app domain for PIE."));
@@ -168,7 +183,16 @@ public: // IModuleInterface interface
 
 		FEditorDelegates::BeginPIE.AddRaw(this, &FEditorPlugin::OnBeginPIE);
 		FEditorDelegates::EndPIE.AddRaw(this, &FEditorPlugin::OnEndPIE);
-		
+
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(
+			ScriptProfilerTabName, 
+			FOnSpawnTab::CreateRaw(this, &FEditorPlugin::SpawnScriptProfilerTab)
+		)
+		.SetDisplayName(LOCTEXT("ScriptProfilerTabTitle", "Klawr Script Profiler"))
+		.SetTooltipText(LOCTEXT(
+			"ScriptProfilerTabTooltip", "Shows how much time is spent in each type of script component."
+		))
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsMiscCategory());
 		
 		FScriptsReloader::Startup();
 		FScriptsReloader::Get().Enable();
@@ -178,6 +202,8 @@ public: // IModuleInterface interface
 	{
 		FScriptsReloader::Shutdown();
 
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(ScriptProfilerTabName);
+
 		FEditorDelegates::BeginPIE.RemoveAll(this);
 		FEditorDelegates::EndPIE.RemoveAll(this);
 		
@@ -228,4 +254,6 @@ public: // IBlueprintCompiler
 
 } // namespace Klawr
 
+#undef LOCTEXT_NAMESPACE
+
 IMPLEMENT_MODULE(Klawr::FEditorPlugin, KlawrEditorPlugin)
@@ -52,6 +52,43 @@ namespace FGameProjectBuilderInternal
 		return false;
 	}
 
+	/** 
+	 * Find all the UE4 wrapper assemblies built by the code generator, Klawr.UnrealEngine and one
+	 * Klawr.UnrealEngine.<Module> assembly for each non-core module.
+	 * @param OutAssemblyNames Will be filled in with the names of the assemblies (without the 
+	 *                         file extension).
+	 */
+	void FindWrapperAssemblies(TArray<FString>& OutAssemblyNames)
+	{
+		TArray<FString> AssemblyFilenames;
+		IFileManager::Get().FindFiles(
+			AssemblyFilenames, 
+			*FPaths::Combine(FPlatformProcess::BaseDir(), TEXT("Klawr.UnrealEngine*.dll")),
+			true /* Files */, false /* Dirs */
+		);
+		for (const FString& AssemblyFilename : AssemblyFilenames)
+		{
+			OutAssemblyNames.Add(FPaths::GetBaseFilename(AssemblyFilename));
+		}
+	}
+
+	/** @return true if the .csproj was modified, false otherwise */
+	bool AddWrapperAssemblyReferences(const TSharedRef<FCSharpProject>& Project)
+	{
+		TArray<FString> AssemblyNames;
+		FindWrapperAssemblies(AssemblyNames);
+
+		bool bProjectModified = false;
+		for (const FString& AssemblyName : AssemblyNames)
+		{
+			bProjectModified |= Project->AddAssemblyReference(
+				FPaths::Combine(FPlatformProcess::BaseDir(), *(AssemblyName + TEXT(".dll"))),
+				false
+			);
+		}
+		return bProjectModified;
+	}
+
 	void CopyPrivateReferencedAssembly(const FString& AssemblyName, const FString& DestDir)
 	{
 		auto& fileManager = IFileManager::Get();
@@ -133,10 +170,7 @@ bool FGameProjectBuilder::GenerateProject()
 		FPaths::Combine(FPlatformProcess::BaseDir(), TEXT("Klawr.ClrHost.Managed.dll")),
 		false
 	);
-	Project->AddAssemblyReference(
-		FPaths::Combine(FPlatformProcess::BaseDir(), TEXT("Klawr.UnrealEngine.dll")),
-		false
-	);
+	FGameProjectBuilderInternal::AddWrapperAssemblyReferences(Project.ToSharedRef());
 		
 	// TODO: scan for assemblies in the script source directories and add them to project references,
 	// the tricky part is figuring out if it's a native dll or an assembly
@@ -305,6 +339,17 @@ bool FGameProjectBuilder::BuildProject(FFeedbackContext* Warn)
 			return false;
 		}
 	}
+	else
+	{
+		// wrapper assemblies for additional modules may have been built since the .csproj was
+		// generated, the scripts can only use them if they're referenced
+		auto Project = FCSharpProject::Load(GetProjectFilename());
+		if (Project.IsValid() &&
+			FGameProjectBuilderInternal::AddWrapperAssemblyReferences(Project.ToSharedRef()))
+		{
+			Project->Save();
+		}
+	}
 
 	FString EnvironmentSetupFilename;
 	if (!FPlatformMisc::GetVSComnTools(12 /* VS 2013 */, EnvironmentSetupFilename))
@@ -356,7 +401,13 @@ void FGameProjectBuilder::CopyPrivateReferencedAssemblies()
 
 	// these assemblies don't need to be shadow copied, so they go into Klawr/Assemblies
 	FGameProjectBuilderInternal::CopyPrivateReferencedAssembly(TEXT("Klawr.ClrHost.Managed"), DestDir);
-	FGameProjectBuilderInternal::CopyPrivateReferencedAssembly(TEXT("Klawr.UnrealEngine"), DestDir);
+
+	TArray<FString> WrapperAssemblyNames;
+	FGameProjectBuilderInternal::FindWrapperAssemblies(WrapperAssemblyNames);
+	for (const FString& AssemblyName : WrapperAssemblyNames)
+	{
+		FGameProjectBuilderInternal::CopyPrivateReferencedAssembly(AssemblyName, DestDir);
+	}
 }
 
 } // namespace Klawr
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrEditorPluginPrivatePCH.h"
+#include "KlawrWrapperUsageCommandlet.h"
+#include "IKlawrRuntimePlugin.h"
+
+UKlawrWrapperUsageCommandlet::UKlawrWrapperUsageCommandlet(
+	const FObjectInitializer& objectInitializer
+)	: Super(objectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UKlawrWrapperUsageCommandlet::Main(const FString& Params)
+{
+	FString Filename;
+	if (!FParse::Value(*Params, TEXT("Output="), Filename))
+	{
+		Filename = FPaths::Combine(
+			*FPaths::GameIntermediateDir(), TEXT("Klawr"), TEXT("KlawrWrapperUsage.txt")
+		);
+	}
+	Filename = FPaths::ConvertRelativePathToFull(Filename);
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+
+	// the editor plugin loads the game scripts into the primary app domain on startup
+	if (!IKlawrRuntimePlugin::Get().WriteWrapperUsage(Filename))
+	{
+		UE_LOG(
+			LogKlawrEditorPlugin, Error, 
+			TEXT("Failed to write the wrapper usage of the game scripts to %s"), *Filename
+		);
+		return 1;
+	}
+	UE_LOG(
+		LogKlawrEditorPlugin, Display, 
+		TEXT("Wrote the wrapper usage of the game scripts to %s"), *Filename
+	);
+	return 0;
+}
@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrWrapperUsageCommandlet.generated.h"
+
+/**
+ * Writes out the names of all the wrapper types and members used by the game scripts, this is 
+ * meant to be run while packaging a game, the code generator can then trim the wrappers down to 
+ * what the game actually uses.
+ *
+ * Usage: UE4Editor-Cmd.exe <Project> -run=KlawrWrapperUsage [-Output=<Filename>]
+ * The output filename defaults to <Project>/Intermediate/Klawr/KlawrWrapperUsage.txt
+ */
+UCLASS()
+class UKlawrWrapperUsageCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UKlawrWrapperUsageCommandlet(const FObjectInitializer& objectInitializer);
+
+public: // UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,371 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrEditorPluginPrivatePCH.h"
+#include "SScriptProfiler.h"
+
+#define LOCTEXT_NAMESPACE "KlawrEditorPlugin.SScriptProfiler"
+
+namespace Klawr {
+	namespace ScriptProfilerColumns {
+
+		static const FName Name(TEXT("Name"));
+		static const FName Calls(TEXT("Calls"));
+		static const FName TotalTime(TEXT("TotalTime"));
+		static const FName TimePerSecond(TEXT("TimePerSecond"));
+		static const FName TimePerCall(TEXT("TimePerCall"));
+		static const FName TickTime(TEXT("TickTime"));
+
+	} // namespace ScriptProfilerColumns
+
+/** A row in the SScriptProfiler table. */
+class SScriptProfileRow : public SMultiColumnTableRow<FScriptProfileRecordPtr>
+{
+public:
+	SLATE_BEGIN_ARGS(SScriptProfileRow) {}
+		SLATE_ARGUMENT(FScriptProfileRecordPtr, Record)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+	{
+		Record = InArgs._Record;
+		SMultiColumnTableRow<FScriptProfileRecordPtr>::Construct(
+			FSuperRowType::FArguments(), InOwnerTableView
+		);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		const FScriptProfileCounters Total = Record->GetTotal();
+		const FScriptProfileCounters& Tick = 
+			Record->Events[(int32)EScriptProfileEvent::TickComponent];
+		const double Seconds = FMath::Max(FScriptProfiler::GetCapturedSeconds(), 0.001);
+
+		FText Text;
+		if (ColumnName == ScriptProfilerColumns::Name)
+		{
+			return SNew(STextBlock)
+				.Text(FText::FromString(Record->Name))
+				.ToolTipText(FText::FromString(Record->TypeName));
+		}
+		else if (ColumnName == ScriptProfilerColumns::Calls)
+		{
+			Text = FText::AsNumber(Total.Calls);
+		}
+		else if (ColumnName == ScriptProfilerColumns::TotalTime)
+		{
+			Text = FormatNumber(Total.GetMilliseconds(), 2);
+		}
+		else if (ColumnName == ScriptProfilerColumns::TimePerSecond)
+		{
+			Text = FormatNumber(Total.GetMilliseconds() / Seconds, 3);
+		}
+		else if (ColumnName == ScriptProfilerColumns::TimePerCall)
+		{
+			Text = FormatNumber(
+				(Total.Calls > 0) ? (Total.GetMilliseconds() * 1000.0 / Total.Calls) : 0.0, 2
+			);
+		}
+		else if (ColumnName == ScriptProfilerColumns::TickTime)
+		{
+			Text = FormatNumber(Tick.GetMilliseconds(), 2);
+		}
+
+		return SNew(SBox)
+			.HAlign(HAlign_Right)
+			[
+				SNew(STextBlock)
+				.Text(Text)
+			];
+	}
+
+private:
+	static FText FormatNumber(double Value, int32 FractionalDigits)
+	{
+		FNumberFormattingOptions Options;
+		Options.MinimumFractionalDigits = FractionalDigits;
+		Options.MaximumFractionalDigits = FractionalDigits;
+		return FText::AsNumber(Value, &Options);
+	}
+
+private:
+	FScriptProfileRecordPtr Record;
+};
+
+void SScriptProfiler::Construct(const FArguments& InArgs)
+{
+	bPerInstance = FScriptProfiler::IsPerInstance();
+	SortColumn = ScriptProfilerColumns::TotalTime;
+	SortMode = EColumnSortMode::Descending;
+
+	auto AddColumn = [this](const FName& ColumnId, const FText& Label, float FillWidth)
+	{
+		return SHeaderRow::Column(ColumnId)
+			.DefaultLabel(Label)
+			.FillWidth(FillWidth)
+			.SortMode(this, &SScriptProfiler::GetColumnSortMode, ColumnId)
+			.OnSort(this, &SScriptProfiler::OnColumnSortModeChanged);
+	};
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		// toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SButton)
+				.OnClicked(this, &SScriptProfiler::StartStop_OnClicked)
+				.Text(this, &SScriptProfiler::StartStop_GetText)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SButton)
+				.OnClicked(this, &SScriptProfiler::Reset_OnClicked)
+				.Text(LOCTEXT("Reset", "Reset"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(8.0f, 0.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.IsChecked(this, &SScriptProfiler::PerInstance_IsChecked)
+				.OnCheckStateChanged(this, &SScriptProfiler::PerInstance_OnCheckStateChanged)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("PerInstance", "Per Instance"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(8.0f, 0.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SScriptProfiler::Summary_GetText)
+			]
+		]
+		// results
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SAssignNew(ListView, SListView<FScriptProfileRecordPtr>)
+			.SelectionMode(ESelectionMode::Single)
+			.ListItemsSource(&Records)
+			.OnGenerateRow(this, &SScriptProfiler::ListView_OnGenerateRow)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ AddColumn(ScriptProfilerColumns::Name, LOCTEXT("Name", "Name"), 3.0f)
+				+ AddColumn(ScriptProfilerColumns::Calls, LOCTEXT("Calls", "Calls"), 1.0f)
+				+ AddColumn(
+					ScriptProfilerColumns::TotalTime, LOCTEXT("TotalTime", "Total (ms)"), 1.0f
+				)
+				+ AddColumn(
+					ScriptProfilerColumns::TimePerSecond, 
+					LOCTEXT("TimePerSecond", "ms per Second"), 1.0f
+				)
+				+ AddColumn(
+					ScriptProfilerColumns::TimePerCall, LOCTEXT("TimePerCall", "us per Call"), 1.0f
+				)
+				+ AddColumn(
+					ScriptProfilerColumns::TickTime, LOCTEXT("TickTime", "Tick (ms)"), 1.0f
+				)
+			)
+		]
+	];
+
+	RegisterActiveTimer(0.5f, FWidgetActiveTimerDelegate::CreateSP(this, &SScriptProfiler::RefreshTimer));
+	Refresh();
+}
+
+void SScriptProfiler::Refresh()
+{
+	TArray<FScriptProfileRecord> LatestRecords;
+	if (bPerInstance)
+	{
+		FScriptProfiler::GetInstanceRecords(LatestRecords);
+	}
+	else
+	{
+		FScriptProfiler::GetTypeRecords(LatestRecords);
+	}
+
+	Records.Reset(LatestRecords.Num());
+	for (const FScriptProfileRecord& Record : LatestRecords)
+	{
+		Records.Add(MakeShareable(new FScriptProfileRecord(Record)));
+	}
+	SortRecords();
+	ListView->RequestListRefresh();
+}
+
+void SScriptProfiler::SortRecords()
+{
+	const bool bAscending = (SortMode == EColumnSortMode::Ascending);
+	auto Compare = [bAscending](double A, double B)
+	{
+		return bAscending ? (A < B) : (A > B);
+	};
+	auto GetValue = [this](const FScriptProfileRecord& Record) -> double
+	{
+		const FScriptProfileCounters Total = Record.GetTotal();
+		if (SortColumn == ScriptProfilerColumns::Calls)
+		{
+			return static_cast<double>(Total.Calls);
+		}
+		else if (SortColumn == ScriptProfilerColumns::TimePerCall)
+		{
+			return (Total.Calls > 0) ? (static_cast<double>(Total.Cycles) / Total.Calls) : 0.0;
+		}
+		else if (SortColumn == ScriptProfilerColumns::TickTime)
+		{
+			return static_cast<double>(
+				Record.Events[(int32)EScriptProfileEvent::TickComponent].Cycles
+			);
+		}
+		// total time and time per second are sorted the same way
+		return static_cast<double>(Total.Cycles);
+	};
+
+	if (SortColumn == ScriptProfilerColumns::Name)
+	{
+		Records.Sort([bAscending](const FScriptProfileRecordPtr& A, const FScriptProfileRecordPtr& B)
+		{
+			return bAscending ? (A->Name < B->Name) : (B->Name < A->Name);
+		});
+	}
+	else
+	{
+		Records.Sort([&](const FScriptProfileRecordPtr& A, const FScriptProfileRecordPtr& B)
+		{
+			return Compare(GetValue(*A), GetValue(*B));
+		});
+	}
+}
+
+EActiveTimerReturnType SScriptProfiler::RefreshTimer(double InCurrentTime, float InDeltaTime)
+{
+	if (FScriptProfiler::IsRunning())
+	{
+		Refresh();
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+FReply SScriptProfiler::StartStop_OnClicked()
+{
+	if (FScriptProfiler::IsRunning())
+	{
+		FScriptProfiler::Stop();
+		Refresh();
+	}
+	else
+	{
+		FScriptProfiler::Start(bPerInstance);
+	}
+	return FReply::Handled();
+}
+
+FText SScriptProfiler::StartStop_GetText() const
+{
+	return FScriptProfiler::IsRunning() ? LOCTEXT("Stop", "Stop") : LOCTEXT("Start", "Start");
+}
+
+FReply SScriptProfiler::Reset_OnClicked()
+{
+	FScriptProfiler::Reset();
+	Refresh();
+	return FReply::Handled();
+}
+
+ECheckBoxState SScriptProfiler::PerInstance_IsChecked() const
+{
+	return bPerInstance ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SScriptProfiler::PerInstance_OnCheckStateChanged(ECheckBoxState NewState)
+{
+	bPerInstance = (NewState == ECheckBoxState::Checked);
+	if (FScriptProfiler::IsRunning())
+	{
+		// restarting doesn't clear the results, it just changes what's gathered from now on
+		FScriptProfiler::Start(bPerInstance);
+	}
+	Refresh();
+}
+
+FText SScriptProfiler::Summary_GetText() const
+{
+	FNumberFormattingOptions Options;
+	Options.MinimumFractionalDigits = 1;
+	Options.MaximumFractionalDigits = 1;
+	// the CLR only counts allocations in ~8 KB steps, so they're only meaningful per frame
+	const FScriptProfileAllocations Allocations = FScriptProfiler::GetAllocations();
+	return FText::Format(
+		LOCTEXT(
+			"Summary",
+			"{0} seconds captured, managed allocations: {1} KB per frame, {2} KB peak"
+		),
+		FText::AsNumber(FScriptProfiler::GetCapturedSeconds(), &Options),
+		FText::AsNumber(Allocations.GetAverageFrameBytes() / 1024.0, &Options),
+		FText::AsNumber(Allocations.PeakFrameBytes / 1024.0, &Options)
+	);
+}
+
+EColumnSortMode::Type SScriptProfiler::GetColumnSortMode(const FName ColumnId) const
+{
+	return (ColumnId == SortColumn) ? SortMode : EColumnSortMode::None;
+}
+
+void SScriptProfiler::OnColumnSortModeChanged(
+	const EColumnSortPriority::Type SortPriority, const FName& ColumnId, 
+	const EColumnSortMode::Type InSortMode
+)
+{
+	SortColumn = ColumnId;
+	SortMode = InSortMode;
+	SortRecords();
+	ListView->RequestListRefresh();
+}
+
+TSharedRef<ITableRow> SScriptProfiler::ListView_OnGenerateRow(
+	FScriptProfileRecordPtr Item, const TSharedRef<STableViewBase>& OwnerTable
+)
+{
+	return SNew(SScriptProfileRow, OwnerTable).Record(Item);
+}
+
+} // namespace Klawr
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrScriptProfiler.h"
+
+namespace Klawr {
+
+typedef TSharedPtr<FScriptProfileRecord> FScriptProfileRecordPtr;
+
+/**
+ * @brief A panel that displays the results gathered by the script profiler in a sortable table, 
+ *        and lets the user start, stop, and reset the profiler.
+ *
+ * The table is refreshed twice a second while the profiler is running.
+ */
+class SScriptProfiler : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SScriptProfiler) {}
+	SLATE_END_ARGS()
+
+public:
+	void Construct(const FArguments& InArgs);
+
+private:
+	/** Rebuild the table from the latest profiler results. */
+	void Refresh();
+	void SortRecords();
+	EActiveTimerReturnType RefreshTimer(double InCurrentTime, float InDeltaTime);
+
+	FReply StartStop_OnClicked();
+	FText StartStop_GetText() const;
+	FReply Reset_OnClicked();
+	ECheckBoxState PerInstance_IsChecked() const;
+	void PerInstance_OnCheckStateChanged(ECheckBoxState NewState);
+	FText Summary_GetText() const;
+
+	EColumnSortMode::Type GetColumnSortMode(const FName ColumnId) const;
+	void OnColumnSortModeChanged(
+		const EColumnSortPriority::Type SortPriority, const FName& ColumnId, 
+		const EColumnSortMode::Type InSortMode
+	);
+
+	TSharedRef<ITableRow> ListView_OnGenerateRow(
+		FScriptProfileRecordPtr Item, const TSharedRef<STableViewBase>& OwnerTable
+	);
+
+private:
+	TSharedPtr<SListView<FScriptProfileRecordPtr>> ListView;
+	TArray<FScriptProfileRecordPtr> Records;
+	bool bPerInstance;
+	FName SortColumn;
+	EColumnSortMode::Type SortMode;
+};
+
+} // namespace Klawr
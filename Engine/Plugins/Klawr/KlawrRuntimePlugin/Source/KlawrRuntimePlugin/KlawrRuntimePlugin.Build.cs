@@ -7,6 +7,11 @@ namespace UnrealBuildTool.Rules
 	{
 		public KlawrRuntimePlugin(TargetInfo Target)
 		{
+			// The generated native wrappers are split into shards (NativeGlue/*.cpp) so they can
+			// be compiled in parallel, and so only the shards that changed get recompiled, a unity
+			// build would just merge them back into one huge translation unit.
+			bFasterWithoutUnity = true;
+
 			PublicIncludePaths.AddRange(
 				new string[] {
 					// ... add other public include paths required here ...
@@ -0,0 +1,527 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrNativeUtils.h"
+
+namespace Klawr {
+
+/**
+ * Hashed index of the elements in a TArray, used to speed up lookups in arrays that are
+ * searched far more often than they're modified (e.g. arrays of tags).
+ * 
+ * Only FString and FName arrays can be indexed, the index maps each distinct element to the
+ * index of its first occurrence in the array so lookups return the same result as 
+ * TArray::Find(). The index doesn't track modifications itself, it's rebuilt on the next 
+ * lookup after Invalidate() is called, or after the array is resized or reallocated.
+ *
+ * All the helpers that wrap the same array share one index (see TArrayLookupIndexRegistry),
+ * and every modification made through any of them invalidates it, so the index can be trusted 
+ * and a lookup that misses doesn't need to search the array. Native code that overwrites the 
+ * elements of an indexed array in place must call InvalidateArrayLookupIndex() afterwards.
+ */
+template <typename T>
+class TArrayLookupIndex
+{
+public:
+	static const bool bSupported = false;
+
+	void Invalidate()
+	{
+	}
+
+	int32 Find(const TArray<T>& array, const void* key)
+	{
+		// only arrays of supported types can be indexed
+		check(false);
+		return INDEX_NONE;
+	}
+};
+
+/** Common bookkeeping for the TArrayLookupIndex specializations. */
+class FArrayLookupIndexBase
+{
+public:
+	static const bool bSupported = true;
+
+	FArrayLookupIndexBase()
+		: bIsStale(true)
+		, IndexedNum(0)
+		, IndexedData(nullptr)
+	{
+	}
+
+	void Invalidate()
+	{
+		bIsStale = true;
+	}
+
+protected:
+	/** Check if the index needs to be rebuilt, and if so mark it as up to date. */
+	bool BeginUpdate(int32 num, const void* data)
+	{
+		if (bIsStale || (IndexedNum != num) || (IndexedData != data))
+		{
+			bIsStale = false;
+			IndexedNum = num;
+			IndexedData = data;
+			return true;
+		}
+		return false;
+	}
+
+private:
+	bool bIsStale;
+	// native code that resizes the array directly doesn't invalidate the index, so the index
+	// is also rebuilt whenever the size or the storage of the array changes
+	int32 IndexedNum;
+	const void* IndexedData;
+};
+
+/** Maps each distinct FName in a TArray<FName> to the index of its first occurrence. */
+template <>
+class TArrayLookupIndex<FName> : public FArrayLookupIndexBase
+{
+public:
+	/** @param key Pointer to the FName to look for. */
+	int32 Find(const TArray<FName>& array, const void* key)
+	{
+		if (BeginUpdate(array.Num(), array.GetData()))
+		{
+			FirstIndices.Empty(array.Num());
+			for (int32 i = array.Num() - 1; i >= 0; --i)
+			{
+				// iterating backwards so the first occurrence overwrites any later ones
+				FirstIndices.Add(array[i], i);
+			}
+		}
+		const int32* index = FirstIndices.Find(*static_cast<const FName*>(key));
+		return index ? *index : INDEX_NONE;
+	}
+
+private:
+	TMap<FName, int32> FirstIndices;
+};
+
+/** 
+ * Maps the hash of each FString in a TArray<FString> to the indices of the elements with 
+ * that hash, the hash is case-insensitive (just like FString comparisons).
+ */
+template <>
+class TArrayLookupIndex<FString> : public FArrayLookupIndexBase
+{
+public:
+	/** @param key Null-terminated string to look for, it's not copied. */
+	int32 Find(const TArray<FString>& array, const void* key)
+	{
+		if (BeginUpdate(array.Num(), array.GetData()))
+		{
+			Indices.Empty(array.Num());
+			for (int32 i = 0; i < array.Num(); ++i)
+			{
+				Indices.Add(HashString(*array[i]), i);
+			}
+		}
+		// only the elements whose hash matches need to be compared
+		const TCHAR* item = static_cast<const TCHAR*>(key);
+		int32 firstIndex = INDEX_NONE;
+		for (auto it = Indices.CreateConstKeyIterator(HashString(item)); it; ++it)
+		{
+			const int32 index = it.Value();
+			if (((firstIndex == INDEX_NONE) || (index < firstIndex)) &&
+				(FCString::Stricmp(*array[index], item) == 0))
+			{
+				firstIndex = index;
+			}
+		}
+		return firstIndex;
+	}
+
+private:
+	/** Case-insensitive FNV-1a hash of a null-terminated string. */
+	static uint32 HashString(const TCHAR* str)
+	{
+		uint32 hash = 2166136261u;
+		for (; *str; ++str)
+		{
+			hash = (hash ^ static_cast<uint32>(FChar::ToLower(*str))) * 16777619u;
+		}
+		return hash;
+	}
+
+	TMultiMap<uint32, int32> Indices;
+};
+
+/** 
+ * Keeps track of the lookup index of every indexed TArray<T>, so that the helpers wrapping an 
+ * array share its index, and modifications made through any of them invalidate it. 
+ * An index is released once none of the helpers that enabled it need it any longer.
+ */
+template <typename T>
+class TArrayLookupIndexRegistry
+{
+public:
+	typedef TSharedPtr<TArrayLookupIndex<T>, ESPMode::ThreadSafe> FIndexPtr;
+	typedef TWeakPtr<TArrayLookupIndex<T>, ESPMode::ThreadSafe> FWeakIndexPtr;
+
+	/** Get the index of an array, creating it if the array isn't indexed yet. */
+	static FIndexPtr Acquire(const TArray<T>* array)
+	{
+		FScopeLock lock(&GetLock());
+		auto& entry = GetIndices().FindOrAdd(array);
+		FIndexPtr index = entry.Pin();
+		if (!index.IsValid())
+		{
+			index = MakeShareable(new TArrayLookupIndex<T>());
+			entry = index;
+		}
+		return index;
+	}
+
+	/** Release an index obtained from Acquire(). */
+	static void Release(const TArray<T>* array, FIndexPtr& index)
+	{
+		FScopeLock lock(&GetLock());
+		index.Reset();
+		auto* entry = GetIndices().Find(array);
+		if (entry && !entry->IsValid())
+		{
+			GetIndices().Remove(array);
+		}
+	}
+
+	/** Invalidate the index of an array, if it has one. */
+	static void Invalidate(const TArray<T>* array)
+	{
+		FScopeLock lock(&GetLock());
+		auto* entry = GetIndices().Find(array);
+		if (entry)
+		{
+			FIndexPtr index = entry->Pin();
+			if (index.IsValid())
+			{
+				index->Invalidate();
+			}
+		}
+	}
+
+private:
+	static TMap<const TArray<T>*, FWeakIndexPtr>& GetIndices()
+	{
+		static TMap<const TArray<T>*, FWeakIndexPtr> indices;
+		return indices;
+	}
+
+	static FCriticalSection& GetLock()
+	{
+		static FCriticalSection lock;
+		return lock;
+	}
+};
+
+/** 
+ * Must be called by native code after it overwrites elements of an FString or FName array in
+ * place, unless the array was resized or reallocated as well.
+ */
+template <typename T>
+void InvalidateArrayLookupIndex(const TArray<T>& array)
+{
+	if (TArrayLookupIndex<T>::bSupported)
+	{
+		TArrayLookupIndexRegistry<T>::Invalidate(&array);
+	}
+}
+
+/**
+ * Abstract base class for TArrayHelper.
+ * 
+ * It's impractical to wrap every instantiation of the TArrayHelper template (not by hand
+ * anyway) so it can be passed across the native/managed code boundary, but wrapping a simple
+ * interface like FArrayHelper is easy.
+ */
+class FArrayHelper
+{
+protected:
+	// property type that corresponds to the element type of the TArray this helper acts on
+	// e.g. for TArray<FString> this will be UStrProperty
+	const UProperty* ElementProperty;
+	int32 ElementSize;
+	bool bLookupIndexEnabled;
+
+protected:
+	/** Construct count elements in place, starting at the given index. */
+	void Construct(int32 index, int32 count = 1)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+
+		if (ElementProperty->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			FMemory::Memzero(GetRawPtr(index), ElementSize * count);
+		}
+		else
+		{
+			for (int32 i = 0; i < count; ++i)
+			{
+				ElementProperty->InitializeValue(GetRawPtr(index + i));
+			}
+		}
+	}
+
+	/** Copy count plain-old-data elements from the given buffer, starting at the given index. */
+	void CopyFrom(int32 index, const void* items, int32 count)
+	{
+		// elements are bit-blasted into the array, which is only safe for POD types
+		check(ElementProperty->HasAnyPropertyFlags(CPF_IsPlainOldData));
+		if (count > 0)
+		{
+			FMemory::Memcpy(GetRawPtr(index), items, ElementSize * count);
+		}
+	}
+
+public:
+	FArrayHelper(const UProperty* elementProperty, int32 elementSize)
+		: ElementProperty(elementProperty)
+		, ElementSize(elementSize)
+		, bLookupIndexEnabled(false)
+	{
+	}
+
+	virtual ~FArrayHelper()
+	{
+	}
+
+	const UProperty* GetElementProperty() const
+	{
+		return ElementProperty;
+	}
+
+	virtual int32 Num() const = 0;
+	virtual uint8* GetRawPtr(int32 index) = 0;
+	virtual int32 Add() = 0;
+	virtual void Insert(int32 index) = 0;
+	virtual void Remove(int32 index) = 0;
+	virtual int32 Find(const void* item) const = 0;
+	virtual void Reset(int32 newCapacity) = 0;
+	
+	/** Append count default constructed elements, return the index of the first one. */
+	virtual int32 AddDefaulted(int32 count) = 0;
+	/** Insert count default constructed elements at the given index. */
+	virtual void InsertDefaulted(int32 index, int32 count) = 0;
+	/** Remove count elements starting at the given index. */
+	virtual void RemoveRange(int32 index, int32 count) = 0;
+	/** Ensure there's room for at least the given number of elements without clearing them. */
+	virtual void Reserve(int32 capacity) = 0;
+
+	/** 
+	 * Enable or disable the hashed lookup index for this array.
+	 * @return true if the index is enabled, false if it was disabled or is not supported for
+	 *         the array element type.
+	 */
+	virtual bool SetLookupIndexEnabled(bool bEnabled) = 0;
+	/** Let the lookup index (if any) know that the array elements have been modified. */
+	virtual void InvalidateLookupIndex() = 0;
+	
+	bool IsLookupIndexEnabled() const
+	{
+		return bLookupIndexEnabled;
+	}
+
+	/** 
+	 * Find an element using the lookup index, which must be enabled.
+	 * @param key FName* for FName arrays, or a null-terminated TCHAR* for FString arrays.
+	 */
+	virtual int32 FindIndexed(const void* key) = 0;
+
+	/** 
+	 * Append count plain-old-data elements copied from the given buffer.
+	 * @return Index of the first appended element.
+	 */
+	int32 AppendRaw(const void* items, int32 count)
+	{
+		const int32 index = Num();
+		if (count > 0)
+		{
+			AddUninitialized(count);
+			CopyFrom(index, items, count);
+		}
+		return index;
+	}
+
+	/** Insert count plain-old-data elements copied from the given buffer at the given index. */
+	void InsertRaw(int32 index, const void* items, int32 count)
+	{
+		if (count > 0)
+		{
+			InsertUninitialized(index, count);
+			CopyFrom(index, items, count);
+		}
+	}
+
+protected:
+	virtual void AddUninitialized(int32 count) = 0;
+	virtual void InsertUninitialized(int32 index, int32 count) = 0;
+};
+
+/**
+ * This class manipulates TArray directly.
+ * 
+ * This template class is used by the native code generator to expose native TArray(s) to
+ * managed code.
+ */
+template <typename T>
+class TArrayHelper : public FArrayHelper
+{
+private:
+	typedef FArrayHelper Super;
+	TArray<T>* Array;
+	/** Only set while the lookup index is enabled, shared with other helpers of the array. */
+	typename TArrayLookupIndexRegistry<T>::FIndexPtr LookupIndex;
+
+public:
+	TArrayHelper(TArray<T>* array, const UArrayProperty* arrayProperty)
+		: FArrayHelper(arrayProperty->Inner, sizeof(T))
+		, Array(array)
+	{
+	}
+
+	virtual ~TArrayHelper()
+	{
+		if (LookupIndex.IsValid())
+		{
+			TArrayLookupIndexRegistry<T>::Release(Array, LookupIndex);
+		}
+	}
+
+	int32 Num() const override
+	{
+		return Array->Num();
+	}
+
+	uint8* GetRawPtr(int32 index) override
+	{
+		return reinterpret_cast<uint8*>(&((*Array)[index]));
+	}
+
+	int32 Add() override
+	{
+		const int32 index = Array->AddUninitialized();
+		InvalidateLookupIndex();
+		Super::Construct(index);
+		return index;
+	}
+
+	void Insert(int32 index) override
+	{
+		Array->InsertUninitialized(index);
+		InvalidateLookupIndex();
+		Super::Construct(index);
+	}
+
+	void Remove(int32 index) override
+	{
+		Array->RemoveAt(index);
+		InvalidateLookupIndex();
+	}
+
+	int32 Find(const void* itemPtr) const override
+	{
+		return Array->Find(*static_cast<const T*>(itemPtr));
+	}
+
+	void Reset(int32 newCapacity) override
+	{
+		Array->Reset(newCapacity);
+		InvalidateLookupIndex();
+	}
+
+	int32 AddDefaulted(int32 count) override
+	{
+		const int32 index = Array->AddUninitialized(count);
+		InvalidateLookupIndex();
+		Super::Construct(index, count);
+		return index;
+	}
+
+	void InsertDefaulted(int32 index, int32 count) override
+	{
+		Array->InsertUninitialized(index, count);
+		InvalidateLookupIndex();
+		Super::Construct(index, count);
+	}
+
+	void RemoveRange(int32 index, int32 count) override
+	{
+		Array->RemoveAt(index, count);
+		InvalidateLookupIndex();
+	}
+
+	void Reserve(int32 capacity) override
+	{
+		Array->Reserve(capacity);
+	}
+
+	bool SetLookupIndexEnabled(bool bEnabled) override
+	{
+		bLookupIndexEnabled = bEnabled && TArrayLookupIndex<T>::bSupported;
+		if (bLookupIndexEnabled && !LookupIndex.IsValid())
+		{
+			LookupIndex = TArrayLookupIndexRegistry<T>::Acquire(Array);
+		}
+		else if (!bLookupIndexEnabled && LookupIndex.IsValid())
+		{
+			TArrayLookupIndexRegistry<T>::Release(Array, LookupIndex);
+		}
+		return bLookupIndexEnabled;
+	}
+
+	void InvalidateLookupIndex() override
+	{
+		// other helpers of the same array may have enabled the index even if this one didn't
+		InvalidateArrayLookupIndex(*Array);
+	}
+
+	int32 FindIndexed(const void* key) override
+	{
+		check(bLookupIndexEnabled);
+		return LookupIndex->Find(*Array, key);
+	}
+
+protected:
+	void AddUninitialized(int32 count) override
+	{
+		Array->AddUninitialized(count);
+		InvalidateLookupIndex();
+	}
+
+	void InsertUninitialized(int32 index, int32 count) override
+	{
+		Array->InsertUninitialized(index, count);
+		InvalidateLookupIndex();
+	}
+};
+
+} // namespace Klawr
@@ -0,0 +1,585 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrArrayKernels.h"
+
+#if PLATFORM_WINDOWS && PLATFORM_ENABLE_VECTORINTRINSICS
+#define KLAWR_ARRAY_KERNELS_SSE 1
+#include <emmintrin.h>
+#else
+#define KLAWR_ARRAY_KERNELS_SSE 0
+#endif
+
+namespace Klawr {
+namespace ArrayKernels {
+
+namespace {
+
+#if KLAWR_ARRAY_KERNELS_SSE
+
+	FORCEINLINE __m128i LoadInt32x4(const int32* data)
+	{
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+	}
+
+	/** Pick lanes from a where the mask is set, and from b where it isn't. */
+	FORCEINLINE __m128i Select(__m128i mask, __m128i a, __m128i b)
+	{
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	FORCEINLINE __m128i Not(__m128i a)
+	{
+		return _mm_xor_si128(a, _mm_set1_epi32(-1));
+	}
+
+	FORCEINLINE int32 HorizontalAdd(__m128i v)
+	{
+		int32 lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+
+	/** Return the index of the lowest lane set in a non-zero 4-bit mask. */
+	FORCEINLINE int32 FirstLane(int32 mask)
+	{
+		return (mask & 1) ? 0 : (mask & 2) ? 1 : (mask & 4) ? 2 : 3;
+	}
+
+	/**
+	 * Four consecutive FVector(s) occupy three SSE registers:
+	 * a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+	 * which can be shuffled into x = (x0 x1 x2 x3), y = (y0 y1 y2 y3), z = (z0 z1 z2 z3).
+	 */
+	FORCEINLINE void Transpose(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+	{
+		const __m128 b2c1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+		x = _mm_shuffle_ps(a, b2c1, _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 a1b0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 b3c2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+		y = _mm_shuffle_ps(a1b0, b3c2, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 a2b1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 c0c3 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+		z = _mm_shuffle_ps(a2b1, c0c3, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	/** 
+	 * Replicate a vector so that it lines up with the layout of four consecutive FVector(s)
+	 * loaded into three SSE registers (see Transpose()).
+	 */
+	FORCEINLINE void Replicate(const FVector& v, __m128& a, __m128& b, __m128& c)
+	{
+		a = _mm_setr_ps(v.X, v.Y, v.Z, v.X);
+		b = _mm_setr_ps(v.Y, v.Z, v.X, v.Y);
+		c = _mm_setr_ps(v.Z, v.X, v.Y, v.Z);
+	}
+
+#endif // KLAWR_ARRAY_KERNELS_SSE
+
+	// Comparison predicates, each provides a scalar and (where available) an SSE implementation.
+
+	struct FEqual
+	{
+		template <typename T> static bool Compare(T a, T b) { return a == b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmpeq_ps(a, b); }
+#endif
+	};
+
+	struct FNotEqual
+	{
+		template <typename T> static bool Compare(T a, T b) { return a != b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return Not(_mm_cmpeq_epi32(a, b)); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmpneq_ps(a, b); }
+#endif
+	};
+
+	struct FLess
+	{
+		template <typename T> static bool Compare(T a, T b) { return a < b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return _mm_cmplt_epi32(a, b); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmplt_ps(a, b); }
+#endif
+	};
+
+	struct FLessOrEqual
+	{
+		template <typename T> static bool Compare(T a, T b) { return a <= b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return Not(_mm_cmpgt_epi32(a, b)); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmple_ps(a, b); }
+#endif
+	};
+
+	struct FGreater
+	{
+		template <typename T> static bool Compare(T a, T b) { return a > b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return _mm_cmpgt_epi32(a, b); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmpgt_ps(a, b); }
+#endif
+	};
+
+	struct FGreaterOrEqual
+	{
+		template <typename T> static bool Compare(T a, T b) { return a >= b; }
+#if KLAWR_ARRAY_KERNELS_SSE
+		static __m128i Compare(__m128i a, __m128i b) { return Not(_mm_cmplt_epi32(a, b)); }
+		static __m128 Compare(__m128 a, __m128 b) { return _mm_cmpge_ps(a, b); }
+#endif
+	};
+
+	template <typename TPredicate>
+	int32 CountMatches(const int32* data, int32 count, int32 value)
+	{
+		int32 matches = 0;
+		int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+		const __m128i valueVec = _mm_set1_epi32(value);
+		__m128i matchesVec = _mm_setzero_si128();
+		for (; i + 4 <= count; i += 4)
+		{
+			// matching lanes are set to -1, so subtracting the mask increments the lane counts
+			matchesVec = _mm_sub_epi32(
+				matchesVec, TPredicate::Compare(LoadInt32x4(data + i), valueVec)
+			);
+		}
+		matches = HorizontalAdd(matchesVec);
+#endif
+		for (; i < count; ++i)
+		{
+			if (TPredicate::Compare(data[i], value))
+			{
+				++matches;
+			}
+		}
+		return matches;
+	}
+
+	template <typename TPredicate>
+	int32 CountMatches(const float* data, int32 count, float value)
+	{
+		int32 matches = 0;
+		int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+		const __m128 valueVec = _mm_set1_ps(value);
+		__m128i matchesVec = _mm_setzero_si128();
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 mask = TPredicate::Compare(_mm_loadu_ps(data + i), valueVec);
+			matchesVec = _mm_sub_epi32(matchesVec, _mm_castps_si128(mask));
+		}
+		matches = HorizontalAdd(matchesVec);
+#endif
+		for (; i < count; ++i)
+		{
+			if (TPredicate::Compare(data[i], value))
+			{
+				++matches;
+			}
+		}
+		return matches;
+	}
+
+	template <typename T>
+	int32 CountMatches(const T* data, int32 count, EArrayComparison comparison, T value)
+	{
+		switch (comparison)
+		{
+			case EArrayComparison::Equal:
+				return CountMatches<FEqual>(data, count, value);
+			case EArrayComparison::NotEqual:
+				return CountMatches<FNotEqual>(data, count, value);
+			case EArrayComparison::Less:
+				return CountMatches<FLess>(data, count, value);
+			case EArrayComparison::LessOrEqual:
+				return CountMatches<FLessOrEqual>(data, count, value);
+			case EArrayComparison::Greater:
+				return CountMatches<FGreater>(data, count, value);
+			case EArrayComparison::GreaterOrEqual:
+				return CountMatches<FGreaterOrEqual>(data, count, value);
+		}
+		// managed code passed in a comparison that doesn't exist
+		check(false);
+		return 0;
+	}
+
+} // unnamed namespace
+
+int32 Find(const int32* data, int32 count, int32 value)
+{
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	const __m128i valueVec = _mm_set1_epi32(value);
+	for (; i + 4 <= count; i += 4)
+	{
+		const int32 mask = _mm_movemask_ps(
+			_mm_castsi128_ps(_mm_cmpeq_epi32(LoadInt32x4(data + i), valueVec))
+		);
+		if (mask)
+		{
+			return i + FirstLane(mask);
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		if (data[i] == value)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 Find(const float* data, int32 count, float value)
+{
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	const __m128 valueVec = _mm_set1_ps(value);
+	for (; i + 4 <= count; i += 4)
+	{
+		const int32 mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), valueVec));
+		if (mask)
+		{
+			return i + FirstLane(mask);
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		if (data[i] == value)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 Find(const FVector* data, int32 count, const FVector& value)
+{
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128 valueA, valueB, valueC;
+	Replicate(value, valueA, valueB, valueC);
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* components = &data[i].X;
+		// 12 bits, one per component, three consecutive bits per vector
+		const int32 mask = 
+			_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(components), valueA))
+			| (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(components + 4), valueB)) << 4)
+			| (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(components + 8), valueC)) << 8);
+		if (mask)
+		{
+			for (int32 lane = 0; lane < 4; ++lane)
+			{
+				if (((mask >> (lane * 3)) & 7) == 7)
+				{
+					return i + lane;
+				}
+			}
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		if (data[i] == value)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int64 Sum(const int32* data, int32 count)
+{
+	int64 sum = 0;
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128i sumVec = _mm_setzero_si128();
+	for (; i + 4 <= count; i += 4)
+	{
+		// sign extend to 64 bits before accumulating
+		const __m128i items = LoadInt32x4(data + i);
+		const __m128i signs = _mm_srai_epi32(items, 31);
+		sumVec = _mm_add_epi64(sumVec, _mm_unpacklo_epi32(items, signs));
+		sumVec = _mm_add_epi64(sumVec, _mm_unpackhi_epi32(items, signs));
+	}
+	int64 lanes[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sumVec);
+	sum = lanes[0] + lanes[1];
+#endif
+	for (; i < count; ++i)
+	{
+		sum += data[i];
+	}
+	return sum;
+}
+
+float Sum(const float* data, int32 count)
+{
+	float sum = 0.0f;
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128 sumVec = _mm_setzero_ps();
+	for (; i + 4 <= count; i += 4)
+	{
+		sumVec = _mm_add_ps(sumVec, _mm_loadu_ps(data + i));
+	}
+	float lanes[4];
+	_mm_storeu_ps(lanes, sumVec);
+	sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+	for (; i < count; ++i)
+	{
+		sum += data[i];
+	}
+	return sum;
+}
+
+FVector Sum(const FVector* data, int32 count)
+{
+	FVector sum(0.0f, 0.0f, 0.0f);
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128 sumA = _mm_setzero_ps();
+	__m128 sumB = _mm_setzero_ps();
+	__m128 sumC = _mm_setzero_ps();
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* components = &data[i].X;
+		sumA = _mm_add_ps(sumA, _mm_loadu_ps(components));
+		sumB = _mm_add_ps(sumB, _mm_loadu_ps(components + 4));
+		sumC = _mm_add_ps(sumC, _mm_loadu_ps(components + 8));
+	}
+	float lanes[12];
+	_mm_storeu_ps(lanes, sumA);
+	_mm_storeu_ps(lanes + 4, sumB);
+	_mm_storeu_ps(lanes + 8, sumC);
+	for (int32 lane = 0; lane < 12; ++lane)
+	{
+		sum[lane % 3] += lanes[lane];
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		sum += data[i];
+	}
+	return sum;
+}
+
+void MinMax(const int32* data, int32 count, int32& outMin, int32& outMax)
+{
+	check(count > 0);
+	int32 minItem = data[0];
+	int32 maxItem = data[0];
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128i minVec = _mm_set1_epi32(data[0]);
+	__m128i maxVec = minVec;
+	for (; i + 4 <= count; i += 4)
+	{
+		// SSE2 has no packed 32-bit integer min/max, so compare and select instead
+		const __m128i items = LoadInt32x4(data + i);
+		minVec = Select(_mm_cmplt_epi32(items, minVec), items, minVec);
+		maxVec = Select(_mm_cmpgt_epi32(items, maxVec), items, maxVec);
+	}
+	int32 minLanes[4], maxLanes[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), minVec);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), maxVec);
+	for (int32 lane = 0; lane < 4; ++lane)
+	{
+		minItem = FMath::Min(minItem, minLanes[lane]);
+		maxItem = FMath::Max(maxItem, maxLanes[lane]);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		minItem = FMath::Min(minItem, data[i]);
+		maxItem = FMath::Max(maxItem, data[i]);
+	}
+	outMin = minItem;
+	outMax = maxItem;
+}
+
+void MinMax(const float* data, int32 count, float& outMin, float& outMax)
+{
+	check(count > 0);
+	float minItem = data[0];
+	float maxItem = data[0];
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128 minVec = _mm_set1_ps(data[0]);
+	__m128 maxVec = minVec;
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128 items = _mm_loadu_ps(data + i);
+		minVec = _mm_min_ps(minVec, items);
+		maxVec = _mm_max_ps(maxVec, items);
+	}
+	float minLanes[4], maxLanes[4];
+	_mm_storeu_ps(minLanes, minVec);
+	_mm_storeu_ps(maxLanes, maxVec);
+	for (int32 lane = 0; lane < 4; ++lane)
+	{
+		minItem = FMath::Min(minItem, minLanes[lane]);
+		maxItem = FMath::Max(maxItem, maxLanes[lane]);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		minItem = FMath::Min(minItem, data[i]);
+		maxItem = FMath::Max(maxItem, data[i]);
+	}
+	outMin = minItem;
+	outMax = maxItem;
+}
+
+void MinMax(const FVector* data, int32 count, FVector& outMin, FVector& outMax)
+{
+	check(count > 0);
+	FVector minItem = data[0];
+	FVector maxItem = data[0];
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	__m128 minA, minB, minC;
+	Replicate(data[0], minA, minB, minC);
+	__m128 maxA = minA, maxB = minB, maxC = minC;
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* components = &data[i].X;
+		const __m128 a = _mm_loadu_ps(components);
+		const __m128 b = _mm_loadu_ps(components + 4);
+		const __m128 c = _mm_loadu_ps(components + 8);
+		minA = _mm_min_ps(minA, a);
+		minB = _mm_min_ps(minB, b);
+		minC = _mm_min_ps(minC, c);
+		maxA = _mm_max_ps(maxA, a);
+		maxB = _mm_max_ps(maxB, b);
+		maxC = _mm_max_ps(maxC, c);
+	}
+	float minLanes[12], maxLanes[12];
+	_mm_storeu_ps(minLanes, minA);
+	_mm_storeu_ps(minLanes + 4, minB);
+	_mm_storeu_ps(minLanes + 8, minC);
+	_mm_storeu_ps(maxLanes, maxA);
+	_mm_storeu_ps(maxLanes + 4, maxB);
+	_mm_storeu_ps(maxLanes + 8, maxC);
+	for (int32 lane = 0; lane < 12; ++lane)
+	{
+		minItem[lane % 3] = FMath::Min(minItem[lane % 3], minLanes[lane]);
+		maxItem[lane % 3] = FMath::Max(maxItem[lane % 3], maxLanes[lane]);
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		minItem = minItem.ComponentMin(data[i]);
+		maxItem = maxItem.ComponentMax(data[i]);
+	}
+	outMin = minItem;
+	outMax = maxItem;
+}
+
+int32 Count(const int32* data, int32 count, EArrayComparison comparison, int32 value)
+{
+	return CountMatches(data, count, comparison, value);
+}
+
+int32 Count(const float* data, int32 count, EArrayComparison comparison, float value)
+{
+	return CountMatches(data, count, comparison, value);
+}
+
+int32 FindNearest(const FVector* data, int32 count, const FVector& point)
+{
+	int32 nearestIndex = INDEX_NONE;
+	float nearestDistSquared = MAX_flt;
+	int32 i = 0;
+#if KLAWR_ARRAY_KERNELS_SSE
+	const __m128 pointX = _mm_set1_ps(point.X);
+	const __m128 pointY = _mm_set1_ps(point.Y);
+	const __m128 pointZ = _mm_set1_ps(point.Z);
+	const __m128i indexStep = _mm_set1_epi32(4);
+	__m128i indexVec = _mm_setr_epi32(0, 1, 2, 3);
+	__m128 nearestDistVec = _mm_set1_ps(MAX_flt);
+	__m128i nearestIndexVec = _mm_set1_epi32(INDEX_NONE);
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* components = &data[i].X;
+		__m128 x, y, z;
+		Transpose(
+			_mm_loadu_ps(components), _mm_loadu_ps(components + 4), _mm_loadu_ps(components + 8),
+			x, y, z
+		);
+		x = _mm_sub_ps(x, pointX);
+		y = _mm_sub_ps(y, pointY);
+		z = _mm_sub_ps(z, pointZ);
+		const __m128 distSquared = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)
+		);
+		// strictly less than, so each lane keeps the lowest index on ties
+		const __m128 closer = _mm_cmplt_ps(distSquared, nearestDistVec);
+		nearestDistVec = _mm_min_ps(distSquared, nearestDistVec);
+		nearestIndexVec = Select(_mm_castps_si128(closer), indexVec, nearestIndexVec);
+		indexVec = _mm_add_epi32(indexVec, indexStep);
+	}
+	float distLanes[4];
+	int32 indexLanes[4];
+	_mm_storeu_ps(distLanes, nearestDistVec);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(indexLanes), nearestIndexVec);
+	for (int32 lane = 0; lane < 4; ++lane)
+	{
+		if ((indexLanes[lane] != INDEX_NONE) && 
+			((distLanes[lane] < nearestDistSquared) ||
+			((distLanes[lane] == nearestDistSquared) && (indexLanes[lane] < nearestIndex))))
+		{
+			nearestDistSquared = distLanes[lane];
+			nearestIndex = indexLanes[lane];
+		}
+	}
+#endif
+	for (; i < count; ++i)
+	{
+		const float distSquared = FVector::DistSquared(data[i], point);
+		if (distSquared < nearestDistSquared)
+		{
+			nearestDistSquared = distSquared;
+			nearestIndex = i;
+		}
+	}
+	// every distance was out of range (or NaN), there's still a nearest element though
+	if ((nearestIndex == INDEX_NONE) && (count > 0))
+	{
+		nearestIndex = 0;
+	}
+	return nearestIndex;
+}
+
+} // namespace ArrayKernels
+} // namespace Klawr
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrNativeUtils.h"
+
+namespace Klawr {
+
+/**
+ * @brief Bulk operations over contiguous runs of plain-old-data array elements.
+ *
+ * These are used by the ArrayUtilsProxy functions to let managed code search and aggregate an
+ * entire native TArray in a single call. SSE2 is used where available (which is always the case
+ * on Win64), any trailing elements that don't fill an entire vector register are processed by 
+ * scalar code.
+ */
+namespace ArrayKernels {
+
+/** Return the index of the first element equal to the given value, or INDEX_NONE. */
+int32 Find(const int32* data, int32 count, int32 value);
+int32 Find(const float* data, int32 count, float value);
+int32 Find(const FVector* data, int32 count, const FVector& value);
+
+/** Sum of all the elements, int32 elements are accumulated in 64 bits so they can't overflow. */
+int64 Sum(const int32* data, int32 count);
+float Sum(const float* data, int32 count);
+FVector Sum(const FVector* data, int32 count);
+
+/** 
+ * Find the smallest and largest elements, vectors are compared component-wise.
+ * @note count must be greater than zero.
+ */
+void MinMax(const int32* data, int32 count, int32& outMin, int32& outMax);
+void MinMax(const float* data, int32 count, float& outMin, float& outMax);
+void MinMax(const FVector* data, int32 count, FVector& outMin, FVector& outMax);
+
+/** Count the number of elements that satisfy (element <comparison> value). */
+int32 Count(const int32* data, int32 count, EArrayComparison comparison, int32 value);
+int32 Count(const float* data, int32 count, EArrayComparison comparison, float value);
+
+/** Return the index of the element closest to the given point, or INDEX_NONE if count is zero. */
+int32 FindNearest(const FVector* data, int32 count, const FVector& point);
+
+} // namespace ArrayKernels
+} // namespace Klawr
@@ -26,125 +26,12 @@
 #include "KlawrNativeUtils.h"
 #include "KlawrClrHost.h"
 #include "KlawrObjectReferencer.h"
+#include "KlawrArrayKernels.h"
+#include "KlawrArrayHelper.h"
+#include "KlawrThreadStringScratch.h"
 
 namespace Klawr 
 {
-	/**
-	 * Abstract base class for TArrayHelper.
-	 * 
-	 * It's impractical to wrap every instantiation of the TArrayHelper template (not by hand
-	 * anyway) so it can be passed across the native/managed code boundary, but wrapping a simple
-	 * interface like FArrayHelper is easy.
-	 */
-	class FArrayHelper
-	{
-	protected:
-		// property type that corresponds to the element type of the TArray this helper acts on
-		// e.g. for TArray<FString> this will be UStrProperty
-		const UProperty* ElementProperty;
-		int32 ElementSize;
-
-	protected:
-		void Construct(int32 index)
-		{
-			if (ElementProperty->HasAnyPropertyFlags(CPF_ZeroConstructor))
-			{
-				FMemory::Memzero(GetRawPtr(index), ElementSize);
-			}
-			else
-			{
-				ElementProperty->InitializeValue(GetRawPtr(index));
-			}
-		}
-
-	public:
-		FArrayHelper(const UProperty* elementProperty, int32 elementSize)
-			: ElementProperty(elementProperty)
-			, ElementSize()
-		{
-		}
-
-		virtual ~FArrayHelper()
-		{
-		}
-
-		const UProperty* GetElementProperty() const
-		{
-			return ElementProperty;
-		}
-
-		virtual int32 Num() const = 0;
-		virtual uint8* GetRawPtr(int32 index) = 0;
-		virtual int32 Add() = 0;
-		virtual void Insert(int32 index) = 0;
-		virtual void Remove(int32 index) = 0;
-		virtual int32 Find(const void* item) const = 0;
-		virtual void Reset(int32 newCapacity) = 0;
-	};
-
-	/**
-	 * This class manipulates TArray directly.
-	 * 
-	 * This template class is used by the native code generator to expose native TArray(s) to
-	 * managed code.
-	 */
-	template <typename T>
-	class TArrayHelper : public FArrayHelper
-	{
-	private:
-		typedef FArrayHelper Super;
-		TArray<T>* Array;
-
-	public:
-		TArrayHelper(TArray<T>* array, const UArrayProperty* arrayProperty)
-			: FArrayHelper(arrayProperty->Inner, arrayProperty->ElementSize)
-			, Array(array)
-		{
-		}
-
-		virtual ~TArrayHelper()
-		{
-		}
-
-		int32 Num() const override
-		{
-			return Array->Num();
-		}
-
-		uint8* GetRawPtr(int32 index) override
-		{
-			return reinterpret_cast<uint8*>(&((*Array)[index]));
-		}
-
-		int32 Add() override
-		{
-			const int32 index = Array->AddUninitialized();
-			Super::Construct(index);
-			return index;
-		}
-
-		void Insert(int32 index) override
-		{
-			Array->InsertUninitialized(index);
-			Super::Construct(index);
-		}
-
-		void Remove(int32 index) override
-		{
-			Array->RemoveAt(index);
-		}
-
-		int32 Find(const void* itemPtr) const override
-		{
-			return Array->Find(*static_cast<const T*>(itemPtr));
-		}
-
-		void Reset(int32 newCapacity) override
-		{
-			Array->Reset(newCapacity);
-		}
-	};
-
 	namespace ArrayUtils 
 	{
 		int32 Num(FArrayHelper* arrayHelper)
@@ -157,17 +44,19 @@ namespace Klawr
 			return arrayHelper->GetRawPtr(index);
 		}
 
-		const TCHAR* GetString(FArrayHelper* arrayHelper, int32 index)
+		StringRef GetString(FArrayHelper* arrayHelper, int32 index)
 		{
 			auto prop = Cast<UStrProperty>(arrayHelper->GetElementProperty());
 			if (prop)
 			{
+				// the array element outlives the call, so managed code can read the characters
+				// directly without them being copied
 				auto& value = *reinterpret_cast<const FString*>(arrayHelper->GetRawPtr(index));
-				return MakeStringCopyForCLR(*value);
+				return MakeStringRef(value);
 			}
 			// couldn't convert the string to the array element type
 			check(false);
-			return nullptr;
+			return MakeStringRef(FString());
 		}
 
 		FScriptName GetName(FArrayHelper* arrayHelper, int32 index)
@@ -201,6 +90,7 @@ namespace Klawr
 		void SetValueAt(FArrayHelper* arrayHelper, int32 index, T item)
 		{
 			*(T*)arrayHelper->GetRawPtr(index) = item;
+			arrayHelper->InvalidateLookupIndex();
 		}
 		
 		void SetStringAt(FArrayHelper* arrayHelper, int32 index, const TCHAR* item)
@@ -208,7 +98,18 @@ namespace Klawr
 			auto prop = Cast<UStrProperty>(arrayHelper->GetElementProperty());
 			if (prop)
 			{
-				prop->SetPropertyValue(arrayHelper->GetRawPtr(index), FString(item));
+				// copy the characters straight into the existing string (reusing its allocation
+				// when possible) rather than going through a temporary FString
+				auto& value = *reinterpret_cast<FString*>(arrayHelper->GetRawPtr(index));
+				auto& chars = value.GetCharArray();
+				const int32 length = item ? FCString::Strlen(item) : 0;
+				chars.Reset(length ? (length + 1) : 0);
+				if (length)
+				{
+					chars.AddUninitialized(length + 1);
+					FMemory::Memcpy(chars.GetData(), item, (length + 1) * sizeof(TCHAR));
+				}
+				arrayHelper->InvalidateLookupIndex();
 				return;
 			}
 			// couldn't convert the string to the array element type
@@ -221,6 +122,7 @@ namespace Klawr
 			if (prop)
 			{
 				prop->SetPropertyValue(arrayHelper->GetRawPtr(index), ScriptNameToName(item));
+				arrayHelper->InvalidateLookupIndex();
 				return;
 			}
 			// couldn't convert the name to the array element type
@@ -278,8 +180,26 @@ namespace Klawr
 			// FString
 			if (arrayHelper->GetElementProperty()->IsA<UStrProperty>())
 			{
-				FString strItem(item);
-				return arrayHelper->Find(&strItem);
+				if (!item)
+				{
+					item = TEXT("");
+				}
+				if (arrayHelper->IsLookupIndexEnabled())
+				{
+					// no need to construct a temporary FString to look up the item in the index
+					return arrayHelper->FindIndexed(item);
+				}
+				// same comparison as FString::operator==, but without a temporary FString
+				const int32 num = arrayHelper->Num();
+				for (int32 i = 0; i < num; ++i)
+				{
+					auto& value = *reinterpret_cast<const FString*>(arrayHelper->GetRawPtr(i));
+					if (FCString::Stricmp(*value, item) == 0)
+					{
+						return i;
+					}
+				}
+				return INDEX_NONE;
 			}
 			// couldn't convert the string to the array element type
 			check(false);
@@ -291,6 +211,10 @@ namespace Klawr
 			if (arrayHelper->GetElementProperty()->IsA<UNameProperty>())
 			{
 				FName nameItem = ScriptNameToName(item);
+				if (arrayHelper->IsLookupIndexEnabled())
+				{
+					return arrayHelper->FindIndexed(&nameItem);
+				}
 				return arrayHelper->Find(&nameItem);
 			}
 			// couldn't convert the name to the array element type
@@ -308,6 +232,142 @@ namespace Klawr
 			arrayHelper->Remove(index);
 		}
 
+		int32 AddDefaulted(FArrayHelper* arrayHelper, int32 count)
+		{
+			return arrayHelper->AddDefaulted(count);
+		}
+
+		void InsertDefaulted(FArrayHelper* arrayHelper, int32 index, int32 count)
+		{
+			arrayHelper->InsertDefaulted(index, count);
+		}
+
+		int32 AppendRaw(FArrayHelper* arrayHelper, const void* items, int32 count)
+		{
+			return arrayHelper->AppendRaw(items, count);
+		}
+
+		void InsertRaw(FArrayHelper* arrayHelper, int32 index, const void* items, int32 count)
+		{
+			arrayHelper->InsertRaw(index, items, count);
+		}
+
+		void RemoveRange(FArrayHelper* arrayHelper, int32 index, int32 count)
+		{
+			arrayHelper->RemoveRange(index, count);
+		}
+
+		void Reserve(FArrayHelper* arrayHelper, int32 capacity)
+		{
+			arrayHelper->Reserve(capacity);
+		}
+
+		template <typename T>
+		bool IsElementType(const UProperty* elementProperty);
+
+		template <>
+		bool IsElementType<int32>(const UProperty* elementProperty)
+		{
+			return elementProperty->IsA<UIntProperty>();
+		}
+
+		template <>
+		bool IsElementType<float>(const UProperty* elementProperty)
+		{
+			return elementProperty->IsA<UFloatProperty>();
+		}
+
+		template <>
+		bool IsElementType<FVector>(const UProperty* elementProperty)
+		{
+			auto prop = Cast<UStructProperty>(elementProperty);
+			return prop && (prop->Struct->GetFName() == NAME_Vector);
+		}
+
+		/** 
+		 * Get a pointer to the contiguous storage of an array and the number of elements in it.
+		 * @return nullptr if the array is empty, or the elements are not of type T.
+		 */
+		template <typename T>
+		T* GetElements(FArrayHelper* arrayHelper, int32& outNum)
+		{
+			outNum = 0;
+			if (IsElementType<T>(arrayHelper->GetElementProperty()))
+			{
+				outNum = arrayHelper->Num();
+				return (outNum > 0) ? reinterpret_cast<T*>(arrayHelper->GetRawPtr(0)) : nullptr;
+			}
+			// the kernel doesn't match the array element type
+			check(false);
+			return nullptr;
+		}
+
+		template <typename T>
+		int32 FindElement(FArrayHelper* arrayHelper, T item)
+		{
+			int32 num;
+			const T* elements = GetElements<T>(arrayHelper, num);
+			return ArrayKernels::Find(elements, num, item);
+		}
+
+		template <typename TResult, typename T>
+		TResult SumElements(FArrayHelper* arrayHelper)
+		{
+			int32 num;
+			const T* elements = GetElements<T>(arrayHelper, num);
+			return ArrayKernels::Sum(elements, num);
+		}
+
+		template <typename T>
+		uint8 MinMaxElements(FArrayHelper* arrayHelper, T* outMin, T* outMax)
+		{
+			int32 num;
+			const T* elements = GetElements<T>(arrayHelper, num);
+			if (num > 0)
+			{
+				ArrayKernels::MinMax(elements, num, *outMin, *outMax);
+				return 1;
+			}
+			return 0;
+		}
+
+		template <typename T>
+		void SortElements(FArrayHelper* arrayHelper)
+		{
+			int32 num;
+			T* elements = GetElements<T>(arrayHelper, num);
+			if (num > 1)
+			{
+				::Sort(elements, num);
+				arrayHelper->InvalidateLookupIndex();
+			}
+		}
+
+		template <typename T>
+		int32 CountElements(FArrayHelper* arrayHelper, EArrayComparison comparison, T value)
+		{
+			int32 num;
+			const T* elements = GetElements<T>(arrayHelper, num);
+			return ArrayKernels::Count(elements, num, comparison, value);
+		}
+
+		int32 FindNearestVector(FArrayHelper* arrayHelper, FVector point)
+		{
+			int32 num;
+			const FVector* elements = GetElements<FVector>(arrayHelper, num);
+			return ArrayKernels::FindNearest(elements, num, point);
+		}
+
+		uint8 SetLookupIndexEnabled(FArrayHelper* arrayHelper, uint8 bEnabled)
+		{
+			return arrayHelper->SetLookupIndexEnabled(bEnabled != 0) ? 1 : 0;
+		}
+
+		void InvalidateLookupIndex(FArrayHelper* arrayHelper)
+		{
+			arrayHelper->InvalidateLookupIndex();
+		}
+
 		void Destroy(FArrayHelper* arrayHelper)
 		{
 			delete arrayHelper;
@@ -333,13 +393,36 @@ namespace Klawr
 		ArrayUtils::FindByPtr<void>,
 		ArrayUtils::FindByValue<uint8>,
 		ArrayUtils::FindByValue<int16>,
-		ArrayUtils::FindByValue<int32>,
+		ArrayUtils::FindElement<int32>,
 		ArrayUtils::FindByValue<int64>,
 		ArrayUtils::FindString,
 		ArrayUtils::FindName,
 		ArrayUtils::FindByPtr<UObject>,
 		ArrayUtils::Insert,
 		ArrayUtils::RemoveAt,
+		ArrayUtils::AddDefaulted,
+		ArrayUtils::InsertDefaulted,
+		ArrayUtils::AppendRaw,
+		ArrayUtils::InsertRaw,
+		ArrayUtils::RemoveRange,
+		ArrayUtils::Reserve,
+		ArrayUtils::SetValueAt<float>,
+		ArrayUtils::SetValueAt<FVector>,
+		ArrayUtils::FindElement<float>,
+		ArrayUtils::FindElement<FVector>,
+		ArrayUtils::SumElements<int64, int32>,
+		ArrayUtils::SumElements<float, float>,
+		ArrayUtils::SumElements<FVector, FVector>,
+		ArrayUtils::MinMaxElements<int32>,
+		ArrayUtils::MinMaxElements<float>,
+		ArrayUtils::MinMaxElements<FVector>,
+		ArrayUtils::SortElements<int32>,
+		ArrayUtils::SortElements<float>,
+		ArrayUtils::CountElements<int32>,
+		ArrayUtils::CountElements<float>,
+		ArrayUtils::FindNearestVector,
+		ArrayUtils::SetLookupIndexEnabled,
+		ArrayUtils::InvalidateLookupIndex,
 		ArrayUtils::Destroy,
 	};
 
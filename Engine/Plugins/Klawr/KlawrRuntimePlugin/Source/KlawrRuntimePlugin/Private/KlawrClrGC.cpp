@@ -0,0 +1,271 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrClrGC.h"
+
+DECLARE_STATS_GROUP(TEXT("Klawr GC"), STATGROUP_KlawrGC, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gen 0 Collections"), STAT_KlawrGCGen0Collections, STATGROUP_KlawrGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gen 1 Collections"), STAT_KlawrGCGen1Collections, STATGROUP_KlawrGC);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gen 2 Collections"), STAT_KlawrGCGen2Collections, STATGROUP_KlawrGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GC Pause (ms)"), STAT_KlawrGCPause, STATGROUP_KlawrGC);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Longest GC Pause (ms)"), STAT_KlawrGCLongestPause, STATGROUP_KlawrGC);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Total Collections"), STAT_KlawrGCTotalCollections, STATGROUP_KlawrGC);
+
+namespace Klawr {
+	namespace ClrGC {
+
+		static TAutoConsoleVariable<int32> CVarGameplayLatencyMode(
+			TEXT("klawr.gc.GameplayLatencyMode"),
+			static_cast<int32>(EClrGCLatencyMode::SustainedLowLatency),
+			TEXT("CLR GC latency mode to use while a game world is being played.\n")
+			TEXT(" 0: Batch\n")
+			TEXT(" 1: Interactive\n")
+			TEXT(" 2: LowLatency\n")
+			TEXT(" 3: SustainedLowLatency (default)")
+		);
+
+		static TAutoConsoleVariable<int32> CVarCollectOnLoadMap(
+			TEXT("klawr.gc.CollectOnLoadMap"),
+			1,
+			TEXT("If non-zero a blocking full CLR garbage collection is performed after every map load.")
+		);
+
+		static const int32 NumGenerations = 3;
+
+		// collections may be triggered on any thread that runs managed code, so the counts are
+		// accumulated here and published to the stats system on the game thread
+		static FThreadSafeCounter Collections[NumGenerations];
+		static FThreadSafeCounter PauseMicroseconds;
+		static volatile int32 LongestPauseMicroseconds = 0;
+
+		static FDelegateHandle PreLoadMapHandle;
+		static FDelegateHandle PostLoadMapHandle;
+		static EClrGCLatencyMode CurrentLatencyMode = EClrGCLatencyMode::Interactive;
+		// the last latency mode the CLR refused to switch to (e.g. SustainedLowLatency isn't 
+		// available when concurrent GC is disabled), -1 if none
+		static int32 RejectedLatencyMode = -1;
+		static bool bIsLoadingMap = false;
+		static bool bIsInNoGCRegion = false;
+
+		static void OnGCPause(int32 Generation, double PauseSeconds)
+		{
+			// the runtime is still suspended, so this must not block, the pause is only counted 
+			// here and logged by Tick() on the game thread
+			const int32 Microseconds = FMath::RoundToInt(PauseSeconds * 1000000.0);
+			Collections[Generation].Increment();
+			PauseMicroseconds.Add(Microseconds);
+			int32 Longest = LongestPauseMicroseconds;
+			while (Microseconds > Longest)
+			{
+				const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(
+					&LongestPauseMicroseconds, Microseconds, Longest
+				);
+				if (Previous == Longest)
+				{
+					break;
+				}
+				Longest = Previous;
+			}
+		}
+
+		static EClrGCFlavor GetFlavor()
+		{
+			FString Flavor;
+			if (GConfig->GetString(TEXT("Klawr"), TEXT("GCFlavor"), Flavor, GEngineIni))
+			{
+				if (Flavor == TEXT("Workstation"))
+				{
+					return EClrGCFlavor::Workstation;
+				}
+				else if (Flavor == TEXT("Server"))
+				{
+					return EClrGCFlavor::Server;
+				}
+				else if (Flavor == TEXT("ServerConcurrent"))
+				{
+					return EClrGCFlavor::ServerConcurrent;
+				}
+				else if (Flavor != TEXT("WorkstationConcurrent"))
+				{
+					UE_LOG(
+						LogKlawrRuntimePlugin, Warning, 
+						TEXT("Unknown CLR GC flavor '%s', using WorkstationConcurrent."), *Flavor
+					);
+				}
+			}
+			return EClrGCFlavor::WorkstationConcurrent;
+		}
+
+		static bool IsPlayingGame()
+		{
+			if (GEngine)
+			{
+				for (const FWorldContext& Context : GEngine->GetWorldContexts())
+				{
+					UWorld* World = Context.World();
+					if (World && ((Context.WorldType == EWorldType::Game) || 
+						(Context.WorldType == EWorldType::PIE)) && World->HasBegunPlay())
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		static void SetLatencyMode(EClrGCLatencyMode Mode)
+		{
+			// don't retry a mode the CLR has already refused until a different mode is requested
+			if ((Mode == CurrentLatencyMode) || (static_cast<int32>(Mode) == RejectedLatencyMode))
+			{
+				return;
+			}
+			if (IClrHost::Get()->SetGCLatencyMode(Mode))
+			{
+				CurrentLatencyMode = Mode;
+				RejectedLatencyMode = -1;
+			}
+			else
+			{
+				RejectedLatencyMode = static_cast<int32>(Mode);
+				UE_LOG(
+					LogKlawrRuntimePlugin, Warning, 
+					TEXT("CLR GC latency mode %d isn't available, staying in mode %d."), 
+					static_cast<int32>(Mode), static_cast<int32>(CurrentLatencyMode)
+				);
+			}
+		}
+
+		static void OnPreLoadMap(const FString& MapName)
+		{
+			// loading is all about throughput, no one is going to notice a long pause
+			bIsLoadingMap = true;
+			SetLatencyMode(EClrGCLatencyMode::Batch);
+		}
+
+		static void OnPostLoadMap()
+		{
+			bIsLoadingMap = false;
+			// the previous map's objects are now garbage, collect them before gameplay starts
+			// instead of leaving them to trigger a full collection mid-game
+			if (CVarCollectOnLoadMap.GetValueOnGameThread() != 0)
+			{
+				FClrGC::CollectAll();
+			}
+		}
+
+	} // namespace ClrGC
+
+	ClrStartupOptions FClrGC::GetStartupOptions(const ClrMemoryHooks* MemoryHooks)
+	{
+		ClrStartupOptions Options;
+		Options.GCFlavor = ClrGC::GetFlavor();
+		Options.MemoryHooks = MemoryHooks;
+		Options.OnGCPause = ClrGC::OnGCPause;
+		return Options;
+	}
+
+	void FClrGC::Startup()
+	{
+		ClrGC::PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddStatic(ClrGC::OnPreLoadMap);
+		ClrGC::PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMap.AddStatic(ClrGC::OnPostLoadMap);
+	}
+
+	void FClrGC::Shutdown()
+	{
+		FCoreUObjectDelegates::PreLoadMap.Remove(ClrGC::PreLoadMapHandle);
+		FCoreUObjectDelegates::PostLoadMap.Remove(ClrGC::PostLoadMapHandle);
+		EndNoGCRegion();
+	}
+
+	void FClrGC::Tick()
+	{
+		if (!ClrGC::bIsLoadingMap && !ClrGC::bIsInNoGCRegion)
+		{
+			const int32 GameplayMode = FMath::Clamp(
+				ClrGC::CVarGameplayLatencyMode.GetValueOnGameThread(),
+				static_cast<int32>(EClrGCLatencyMode::Batch),
+				static_cast<int32>(EClrGCLatencyMode::SustainedLowLatency)
+			);
+			ClrGC::SetLatencyMode(
+				ClrGC::IsPlayingGame() ? 
+				static_cast<EClrGCLatencyMode>(GameplayMode) : EClrGCLatencyMode::Interactive
+			);
+		}
+
+		const int32 Gen0 = ClrGC::Collections[0].Reset();
+		const int32 Gen1 = ClrGC::Collections[1].Reset();
+		const int32 Gen2 = ClrGC::Collections[2].Reset();
+		const int32 PauseMicroseconds = ClrGC::PauseMicroseconds.Reset();
+		const int32 LongestPauseMicroseconds = FPlatformAtomics::InterlockedExchange(
+			&ClrGC::LongestPauseMicroseconds, 0
+		);
+		INC_DWORD_STAT_BY(STAT_KlawrGCGen0Collections, Gen0);
+		INC_DWORD_STAT_BY(STAT_KlawrGCGen1Collections, Gen1);
+		INC_DWORD_STAT_BY(STAT_KlawrGCGen2Collections, Gen2);
+		INC_DWORD_STAT_BY(STAT_KlawrGCTotalCollections, Gen0 + Gen1 + Gen2);
+		INC_FLOAT_STAT_BY(STAT_KlawrGCPause, PauseMicroseconds / 1000.0f);
+		INC_FLOAT_STAT_BY(STAT_KlawrGCLongestPause, LongestPauseMicroseconds / 1000.0f);
+
+		if (Gen0 + Gen1 + Gen2 > 0)
+		{
+			UE_LOG(
+				LogKlawrRuntimePlugin, Verbose, 
+				TEXT("CLR GC: %d/%d/%d gen 0/1/2 collections, paused for %.3f ms (longest %.3f ms)"),
+				Gen0, Gen1, Gen2, PauseMicroseconds / 1000.0, LongestPauseMicroseconds / 1000.0
+			);
+		}
+	}
+
+	bool FClrGC::TryStartNoGCRegion(int64 TotalSize)
+	{
+		if (!ClrGC::bIsInNoGCRegion)
+		{
+			ClrGC::bIsInNoGCRegion = IClrHost::Get()->TryStartNoGCRegion(TotalSize);
+		}
+		else
+		{
+			UE_LOG(LogKlawrRuntimePlugin, Warning, TEXT("CLR no GC regions can't be nested."));
+			return false;
+		}
+		return ClrGC::bIsInNoGCRegion;
+	}
+
+	void FClrGC::EndNoGCRegion()
+	{
+		if (ClrGC::bIsInNoGCRegion)
+		{
+			IClrHost::Get()->EndNoGCRegion();
+			ClrGC::bIsInNoGCRegion = false;
+		}
+	}
+
+	void FClrGC::CollectAll()
+	{
+		IClrHost::Get()->CollectGarbage(-1, true);
+	}
+
+} // namespace Klawr
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+
+namespace Klawr {
+
+/** 
+ * @brief Schedules CLR garbage collections around the engine frame.
+ *
+ * While any game world is being played the CLR GC runs in the latency mode specified by 
+ * klawr.gc.GameplayLatencyMode (SustainedLowLatency by default), at all other times it runs in 
+ * the Interactive mode. A blocking full collection is performed after every map load (while the 
+ * loading screen is still up) unless klawr.gc.CollectOnLoadMap is zero. Every collection is 
+ * counted in "stat KlawrGC" along with the length of time managed threads were paused for.
+ *
+ * The GC flavor can only be chosen before the CLR starts, it's read from the GCFlavor key
+ * in the [Klawr] section of the engine config, valid values are Workstation, 
+ * WorkstationConcurrent (the default), Server, and ServerConcurrent.
+ */
+class FClrGC
+{
+public:
+	/** Get the options that should be passed to IClrHost::Startup(). */
+	static ClrStartupOptions GetStartupOptions(const ClrMemoryHooks* MemoryHooks);
+
+	/** Called once the CLR has started. */
+	static void Startup();
+	/** Called before the CLR is shut down. */
+	static void Shutdown();
+
+	/** Called at the end of every frame. */
+	static void Tick();
+
+	/**
+	 * Attempt to prevent garbage collections until EndNoGCRegion() is called, this is only 
+	 * meant to be used for short latency sensitive sections of gameplay.
+	 * @param TotalSize Number of bytes managed code can allocate before a collection is forced.
+	 * @return true if the no GC region was entered, false otherwise
+	 */
+	static bool TryStartNoGCRegion(int64 TotalSize);
+	/** Allow garbage collections again after a successful call to TryStartNoGCRegion(). */
+	static void EndNoGCRegion();
+
+	/** Perform a blocking collection of all generations. */
+	static void CollectAll();
+};
+
+} // namespace Klawr
@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrClrMemory.h"
+
+DECLARE_MEMORY_STAT(TEXT("Klawr CLR Heap"), STAT_KlawrClrHeap, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("Klawr CLR Executable Heap"), STAT_KlawrClrExecutableHeap, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("Klawr CLR GC Heap"), STAT_KlawrClrGCHeap, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("Klawr CLR Loader Heaps"), STAT_KlawrClrLoaderHeap, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("Klawr CLR JIT Code"), STAT_KlawrClrExecutableVirtualMemory, STATGROUP_Memory);
+
+namespace Klawr {
+	namespace ClrMemory {
+
+		static const int32 NumCategories = static_cast<int32>(EClrMemoryCategory::Count);
+		static FThreadSafeCounter64 AllocatedBytes[NumCategories];
+
+		static const TCHAR* CategoryNames[NumCategories] =
+		{
+			TEXT("Heap"),
+			TEXT("Executable Heap"),
+			TEXT("GC Heap"),
+			TEXT("Loader Heaps"),
+			TEXT("JIT Code"),
+		};
+
+		static void* Malloc(size_t size)
+		{
+			return FMemory::Malloc(size, 16);
+		}
+
+		static void Free(void* ptr)
+		{
+			FMemory::Free(ptr);
+		}
+
+		static void OnMemoryChanged(EClrMemoryCategory category, int64 delta)
+		{
+			AllocatedBytes[static_cast<int32>(category)].Add(delta);
+
+#if STATS
+			FName StatName;
+			switch (category)
+			{
+				case EClrMemoryCategory::Heap:
+					StatName = GET_STATFNAME(STAT_KlawrClrHeap);
+					break;
+				case EClrMemoryCategory::ExecutableHeap:
+					StatName = GET_STATFNAME(STAT_KlawrClrExecutableHeap);
+					break;
+				case EClrMemoryCategory::GCHeap:
+					StatName = GET_STATFNAME(STAT_KlawrClrGCHeap);
+					break;
+				case EClrMemoryCategory::LoaderHeap:
+					StatName = GET_STATFNAME(STAT_KlawrClrLoaderHeap);
+					break;
+				case EClrMemoryCategory::ExecutableVirtualMemory:
+					StatName = GET_STATFNAME(STAT_KlawrClrExecutableVirtualMemory);
+					break;
+				default:
+					return;
+			}
+			// memory stats are unsigned, releases must be reported as decrements
+			if (delta < 0)
+			{
+				DEC_MEMORY_STAT_BY_FName(StatName, -delta);
+			}
+			else
+			{
+				INC_MEMORY_STAT_BY_FName(StatName, delta);
+			}
+#endif // STATS
+		}
+
+		/** Handles the "Klawr MemReport" console command. */
+		class FMemReportExec : public FSelfRegisteringExec
+		{
+		public:
+			virtual bool Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar) override
+			{
+				if (FParse::Command(&Cmd, TEXT("Klawr")) && FParse::Command(&Cmd, TEXT("MemReport")))
+				{
+					FClrMemory::Dump(Ar);
+					return true;
+				}
+				return false;
+			}
+		};
+
+		static FMemReportExec MemReportExec;
+
+	} // namespace ClrMemory
+
+	void FClrMemory::Startup()
+	{
+		// plugin config files aren't merged into the engine config by this engine version, so
+		// the memreport commands listed in the plugin config are merged in by hand (in memory
+		// only, the engine config isn't saved)
+		const FString PluginConfigFilename = FPaths::EnginePluginsDir() / 
+			TEXT("Klawr/KlawrRuntimePlugin/Config/DefaultKlawrRuntimePlugin.ini");
+		FConfigFile PluginConfig;
+		PluginConfig.Read(PluginConfigFilename);
+
+		FConfigFile* EngineConfig = GConfig->FindConfigFile(GEngineIni);
+		if (!EngineConfig)
+		{
+			return;
+		}
+
+		TArray<FString> Commands;
+		PluginConfig.GetArray(TEXT("MemReportCommands"), TEXT("Cmd"), Commands);
+		if (Commands.Num() > 0)
+		{
+			FConfigSection* Section = EngineConfig->Find(TEXT("MemReportCommands"));
+			if (!Section)
+			{
+				Section = &EngineConfig->Add(TEXT("MemReportCommands"), FConfigSection());
+			}
+			for (const FString& Command : Commands)
+			{
+				Section->AddUnique(TEXT("Cmd"), Command);
+			}
+		}
+	}
+
+	const ClrMemoryHooks& FClrMemory::GetHooks()
+	{
+		static const ClrMemoryHooks Hooks =
+		{
+			ClrMemory::Malloc,
+			ClrMemory::Free,
+			ClrMemory::OnMemoryChanged
+		};
+		return Hooks;
+	}
+
+	int64 FClrMemory::GetAllocatedBytes(EClrMemoryCategory Category)
+	{
+		return ClrMemory::AllocatedBytes[static_cast<int32>(Category)].GetValue();
+	}
+
+	int64 FClrMemory::GetTotalAllocatedBytes()
+	{
+		int64 Total = 0;
+		for (int32 i = 0; i < ClrMemory::NumCategories; ++i)
+		{
+			Total += ClrMemory::AllocatedBytes[i].GetValue();
+		}
+		return Total;
+	}
+
+	void FClrMemory::Dump(FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("Klawr CLR memory:"));
+		for (int32 i = 0; i < ClrMemory::NumCategories; ++i)
+		{
+			Ar.Logf(
+				TEXT("  %-16s %10.2f KB"), ClrMemory::CategoryNames[i], 
+				ClrMemory::AllocatedBytes[i].GetValue() / 1024.0
+			);
+		}
+		Ar.Logf(TEXT("  %-16s %10.2f KB"), TEXT("Total"), GetTotalAllocatedBytes() / 1024.0);
+	}
+
+} // namespace Klawr
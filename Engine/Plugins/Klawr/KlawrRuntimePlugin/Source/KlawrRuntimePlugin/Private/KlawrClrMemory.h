@@ -0,0 +1,56 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+
+namespace Klawr {
+
+/** 
+ * @brief Tracks memory allocated by the CLR.
+ *
+ * The CLR allocates memory through the hooks returned by GetHooks(), non-executable heap blocks
+ * come from FMemory, and everything the CLR allocates shows up under the Klawr CLR entries in 
+ * "stat memory". The plugin config adds "Klawr MemReport" to the memreport commands, so
+ * memreport output includes a breakdown.
+ */
+class FClrMemory
+{
+public:
+	/** Add the memreport commands from the plugin config to the engine config. */
+	static void Startup();
+
+	/** Get the hooks that should be passed to IClrHost::Startup(). */
+	static const ClrMemoryHooks& GetHooks();
+
+	/** Get the number of bytes currently allocated by the CLR in the given category. */
+	static int64 GetAllocatedBytes(EClrMemoryCategory Category);
+	/** Get the number of bytes currently allocated by the CLR in all categories. */
+	static int64 GetTotalAllocatedBytes();
+
+	/** Print a breakdown of the memory allocated by the CLR. */
+	static void Dump(FOutputDevice& Ar);
+};
+
+} // namespace Klawr
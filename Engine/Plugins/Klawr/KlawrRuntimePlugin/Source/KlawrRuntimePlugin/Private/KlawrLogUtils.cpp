@@ -28,6 +28,9 @@
 
 namespace Klawr {
 	namespace LogUtils {
+
+		/** Verbosity of LogKlawrRuntimePlugin, mirrored for managed code. */
+		static volatile int32 Verbosity = ELogVerbosity::Log;
 		
 		void LogFatalError(const TCHAR* message)
 		{
@@ -64,6 +67,41 @@ namespace Klawr {
 			UE_LOG(LogKlawrRuntimePlugin, VeryVerbose, TEXT("%s"), message);
 		}
 
+		void LogBatch(const LogUtilsProxy::LogRecord* records, int32 numRecords, const TCHAR* text)
+		{
+			for (int32 i = 0; i < numRecords; ++i)
+			{
+				const TCHAR* message = text;
+				text += records[i].Length + 1;
+
+				// UE_LOG needs the verbosity at compile time
+				switch (records[i].Verbosity)
+				{
+					case ELogVerbosity::Fatal:
+						LogFatalError(message);
+						break;
+					case ELogVerbosity::Error:
+						LogError(message);
+						break;
+					case ELogVerbosity::Warning:
+						LogWarning(message);
+						break;
+					case ELogVerbosity::Display:
+						Display(message);
+						break;
+					case ELogVerbosity::Verbose:
+						LogVerbose(message);
+						break;
+					case ELogVerbosity::VeryVerbose:
+						LogVeryVerbose(message);
+						break;
+					default:
+						Log(message);
+						break;
+				}
+			}
+		}
+
 	} // namespace LogUtils
 
 	LogUtilsProxy FNativeUtils::Log =
@@ -75,6 +113,17 @@ namespace Klawr {
 		LogUtils::Log,
 		LogUtils::LogVerbose,
 		LogUtils::LogVeryVerbose,
+		LogUtils::LogBatch,
+		&LogUtils::Verbosity
 	};
 
+	void FNativeUtils::UpdateLogVerbosity()
+	{
+		// messages above the compile time verbosity are compiled out of UE_LOG
+		LogUtils::Verbosity = FMath::Min<int32>(
+			LogKlawrRuntimePlugin.GetVerbosity(), 
+			FLogCategoryLogKlawrRuntimePlugin::CompileTimeVerbosity
+		);
+	}
+
 } // namespace Klawr
\ No newline at end of file
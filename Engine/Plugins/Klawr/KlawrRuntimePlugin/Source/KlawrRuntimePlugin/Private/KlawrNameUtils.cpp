@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrNativeUtils.h"
+#include "KlawrClrHost.h"
+
+namespace Klawr {
+	namespace NameUtils {
+		
+		static int32 GetNameEntries(
+			int32 firstIndex, int32 count, TCHAR* buffer, int32 bufferLength, int32* outLengths
+		)
+		{
+			const int32 maxNames = FName::GetMaxNames();
+			int32 numCopied = 0;
+			int32 bufferOffset = 0;
+			while ((numCopied < count) && ((firstIndex + numCopied) < maxNames))
+			{
+				const FNameEntry* entry = FName::GetEntry(firstIndex + numCopied);
+				if (!entry)
+				{
+					outLengths[numCopied++] = -1;
+					continue;
+				}
+				
+				const bool bIsWide = entry->IsWide();
+				const int32 length = bIsWide ?
+					FCStringWide::Strlen(entry->GetWideName()) :
+					FCStringAnsi::Strlen(entry->GetAnsiName());
+				if ((bufferOffset + length) > bufferLength)
+				{
+					break;
+				}
+				
+				TCHAR* dest = buffer + bufferOffset;
+				if (bIsWide)
+				{
+					FMemory::Memcpy(dest, entry->GetWideName(), length * sizeof(TCHAR));
+				}
+				else
+				{
+					// names are only stored as ANSI strings if all their characters are ANSI
+					const ANSICHAR* src = entry->GetAnsiName();
+					for (int32 i = 0; i < length; ++i)
+					{
+						dest[i] = static_cast<TCHAR>(src[i]);
+					}
+				}
+				bufferOffset += length;
+				outLengths[numCopied++] = length;
+			}
+			return numCopied;
+		}
+
+		static FScriptName MakeName(const TCHAR* name)
+		{
+			return NameToScriptName(FName(name, FNAME_Add));
+		}
+
+	} // namespace NameUtils
+
+	NameUtilsProxy FNativeUtils::Name =
+	{
+		NameUtils::GetNameEntries,
+		NameUtils::MakeName
+	};
+
+} // namespace Klawr
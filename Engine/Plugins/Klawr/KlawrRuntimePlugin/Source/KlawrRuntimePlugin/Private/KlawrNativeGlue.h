@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+// everything the generated native wrappers (the *.klawr.h files) depend on
+#include "KlawrClrHost.h"
+#include "KlawrNativeUtils.h"
+#include "KlawrObjectReferencer.h"
+#include "KlawrThreadStringScratch.h"
+#include "KlawrParallelTick.h"
+#include "KlawrArrayHelper.h"
+
+namespace Klawr {
+
+/** Find a property declared by the given class (properties of super classes are ignored). */
+UProperty* FindScriptPropertyHelper(const UClass* Class, FName PropertyName);
+
+namespace NativeGlue {
+
+/** 
+ * The native wrappers are split between this many shards, each of which is compiled separately 
+ * (see NativeGlue/KlawrNativeGlueShard*.cpp). Must match NativeGlueShardCount in the code 
+ * generator.
+ */
+static const int32 ShardCount = 8;
+
+/** Register the native wrappers of every scriptable class with the CLR host. */
+void RegisterWrapperClasses();
+
+} // namespace NativeGlue
+} // namespace Klawr
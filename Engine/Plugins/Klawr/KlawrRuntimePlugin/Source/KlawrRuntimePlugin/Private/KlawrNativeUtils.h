@@ -33,6 +33,19 @@ struct FNativeUtils
 	static ObjectUtilsProxy Object;
 	static LogUtilsProxy Log;
 	static ArrayUtilsProxy Array;
+	static NameUtilsProxy Name;
+	static ScriptComponentUtilsProxy ScriptComponent;
+	static ProfilerUtilsProxy Profiler;
+	static TaskUtilsProxy Task;
+
+	/** 
+	 * Copy the current verbosity of the Klawr log category to the location LogUtilsProxy 
+	 * exposes to managed code, should be called whenever the verbosity may have changed.
+	 */
+	static void UpdateLogVerbosity();
+
+	/** Convert a Klawr.ClrHost.Managed.ScriptTickGroup value to the engine tick group. */
+	static ETickingGroup ToTickingGroup(int32 ScriptTickGroup);
 };
 
 } // namespace Klawr
@@ -0,0 +1,284 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrParallelTick.h"
+#include "KlawrScriptComponent.h"
+#include "KlawrScriptProfiler.h"
+#include "ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Klawr Concurrent Script Tick"), STAT_KlawrConcurrentScriptTick, STATGROUP_Game);
+
+namespace Klawr {
+	namespace ParallelTick {
+
+		static TAutoConsoleVariable<int32> CVarEnabled(
+			TEXT("klawr.ParallelTick"),
+			1,
+			TEXT("If zero, script components marked with ConcurrentTick are ticked on the game thread.")
+		);
+
+		static TAutoConsoleVariable<int32> CVarBatchSize(
+			TEXT("klawr.ParallelTick.BatchSize"),
+			32,
+			TEXT("Number of script components ticked by each task graph task during the concurrent script tick.")
+		);
+
+		struct FEntry
+		{
+			UKlawrScriptComponent* Component;
+			TickScriptComponentsAction TickAction;
+			__int64 InstanceID;
+		};
+
+		struct FBatch
+		{
+			TickScriptComponentsAction TickAction;
+			int32 First;
+			int32 Count;
+			// only set while the script profiler is running
+			UClass* ComponentClass;
+			uint32 Cycles;
+		};
+
+		class FWorldTickFunction : public FTickFunction
+		{
+		public:
+			TArray<FEntry> Entries;
+
+		public: // FTickFunction interface
+			virtual void ExecuteTick(
+				float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, 
+				const FGraphEventRef& MyCompletionGraphEvent
+			) override;
+
+			virtual FString DiagnosticMessage() override
+			{
+				return TEXT("Klawr concurrent script component tick");
+			}
+
+		private:
+			// these are only kept around to avoid reallocating them every frame
+			TArray<__int64> InstanceIDs;
+			TArray<float> DeltaTimes;
+			TArray<UClass*> ComponentClasses;
+			TArray<FBatch> Batches;
+		};
+
+		typedef TArray<FWorldTickFunction*, TInlineAllocator<1>> FWorldTickFunctionArray;
+
+		/** Tick functions of each world, one per tick group. */
+		static TMap<UWorld*, FWorldTickFunctionArray> WorldTickFunctions;
+
+	} // namespace ParallelTick
+
+	bool FParallelTick::bIsTickingConcurrently = false;
+
+	void ParallelTick::FWorldTickFunction::ExecuteTick(
+		float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, 
+		const FGraphEventRef& MyCompletionGraphEvent
+	)
+	{
+		if (TickType == LEVELTICK_ViewportsOnly)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_KlawrConcurrentScriptTick);
+
+		const int32 BatchSize = FMath::Max(1, CVarBatchSize.GetValueOnGameThread());
+		InstanceIDs.Reset();
+		DeltaTimes.Reset();
+		ComponentClasses.Reset();
+		Batches.Reset();
+#if KLAWR_SCRIPT_PROFILER
+		// while profiling each batch only contains components of a single class, so the time 
+		// spent ticking the batch can be attributed to that class
+		const bool bIsProfiling = FScriptProfiler::IsRunning();
+		if (bIsProfiling)
+		{
+			Entries.Sort([](const FEntry& A, const FEntry& B)
+			{
+				return A.Component->GetClass() < B.Component->GetClass();
+			});
+		}
+#else
+		const bool bIsProfiling = false;
+#endif // KLAWR_SCRIPT_PROFILER
+		// components from different app domains (e.g. the editor and PIE app domains) may share
+		// a world, each app domain has its own tick action so they're batched separately
+		TArray<TickScriptComponentsAction, TInlineAllocator<2>> TickActions;
+		for (const FEntry& Entry : Entries)
+		{
+			TickActions.AddUnique(Entry.TickAction);
+		}
+		for (TickScriptComponentsAction TickAction : TickActions)
+		{
+			const int32 First = InstanceIDs.Num();
+			for (const FEntry& Entry : Entries)
+			{
+				float ScriptDeltaTime;
+				if ((Entry.TickAction == TickAction) && Entry.Component->IsActive() && 
+					!Entry.Component->IsPendingKill() && !Entry.Component->IsSleeping() &&
+					Entry.Component->ConsumeScriptTickTime(DeltaTime, ScriptDeltaTime))
+				{
+					InstanceIDs.Add(Entry.InstanceID);
+					DeltaTimes.Add(ScriptDeltaTime);
+					if (bIsProfiling)
+					{
+						ComponentClasses.Add(Entry.Component->GetClass());
+					}
+				}
+			}
+			for (int32 Start = First; Start < InstanceIDs.Num(); )
+			{
+				FBatch Batch;
+				Batch.TickAction = TickAction;
+				Batch.First = Start;
+				Batch.Count = FMath::Min(BatchSize, InstanceIDs.Num() - Start);
+				Batch.ComponentClass = nullptr;
+				Batch.Cycles = 0;
+				if (bIsProfiling)
+				{
+					Batch.ComponentClass = ComponentClasses[Start];
+					int32 Count = 1;
+					while ((Count < Batch.Count) && 
+						(ComponentClasses[Start + Count] == Batch.ComponentClass))
+					{
+						++Count;
+					}
+					Batch.Count = Count;
+				}
+				Batches.Add(Batch);
+				Start += Batch.Count;
+			}
+		}
+
+		FParallelTick::bIsTickingConcurrently = true;
+		ParallelFor(
+			Batches.Num(), 
+			[this](int32 BatchIndex)
+			{
+				FBatch& Batch = Batches[BatchIndex];
+				const uint32 StartCycles = Batch.ComponentClass ? FPlatformTime::Cycles() : 0;
+				Batch.TickAction(&InstanceIDs[Batch.First], &DeltaTimes[Batch.First], Batch.Count);
+				if (Batch.ComponentClass)
+				{
+					Batch.Cycles = FPlatformTime::Cycles() - StartCycles;
+				}
+			},
+			CVarEnabled.GetValueOnGameThread() == 0
+		);
+		FParallelTick::bIsTickingConcurrently = false;
+
+		if (bIsProfiling)
+		{
+			for (const FBatch& Batch : Batches)
+			{
+				FScriptProfiler::RecordConcurrentTicks(
+					Batch.ComponentClass, Batch.Count, Batch.Cycles
+				);
+			}
+		}
+	}
+
+	void FParallelTick::Register(UKlawrScriptComponent* Component, int AppDomainID, __int64 InstanceID)
+	{
+		check(IsInGameThread() && !bIsTickingConcurrently);
+
+		UWorld* World = Component->GetWorld();
+		check(World);
+
+		ParallelTick::FEntry Entry;
+		Entry.Component = Component;
+		Entry.TickAction = IClrHost::Get()->GetTickScriptComponentsAction(AppDomainID);
+		Entry.InstanceID = InstanceID;
+		if (!Entry.TickAction)
+		{
+			UE_LOG(
+				LogKlawrRuntimePlugin, Error,
+				TEXT("Failed to register %s for concurrent ticks, app domain #%d doesn't exist!"),
+				*Component->GetName(), AppDomainID
+			);
+			return;
+		}
+
+		const ETickingGroup TickGroup = Component->PrimaryComponentTick.TickGroup;
+		ParallelTick::FWorldTickFunctionArray& TickFunctions = 
+			ParallelTick::WorldTickFunctions.FindOrAdd(World);
+		ParallelTick::FWorldTickFunction* TickFunction = nullptr;
+		for (ParallelTick::FWorldTickFunction* WorldTickFunction : TickFunctions)
+		{
+			if (WorldTickFunction->TickGroup == TickGroup)
+			{
+				TickFunction = WorldTickFunction;
+				break;
+			}
+		}
+		if (!TickFunction)
+		{
+			TickFunction = new ParallelTick::FWorldTickFunction();
+			TickFunction->TickGroup = TickGroup;
+			TickFunction->bCanEverTick = true;
+			TickFunction->bStartWithTickEnabled = true;
+			TickFunction->RegisterTickFunction(World->PersistentLevel);
+		}
+		TickFunction->Entries.Add(Entry);
+	}
+
+	void FParallelTick::Unregister(UKlawrScriptComponent* Component)
+	{
+		check(IsInGameThread() && !bIsTickingConcurrently);
+
+		UWorld* World = Component->GetWorld();
+		ParallelTick::FWorldTickFunctionArray* TickFunctions = 
+			ParallelTick::WorldTickFunctions.Find(World);
+		if (!TickFunctions)
+		{
+			return;
+		}
+
+		for (int32 i = TickFunctions->Num() - 1; i >= 0; --i)
+		{
+			ParallelTick::FWorldTickFunction* TickFunction = (*TickFunctions)[i];
+			TickFunction->Entries.RemoveAllSwap(
+				[Component](const ParallelTick::FEntry& Entry)
+				{
+					return Entry.Component == Component;
+				}
+			);
+			if (TickFunction->Entries.Num() == 0)
+			{
+				TickFunction->UnRegisterTickFunction();
+				delete TickFunction;
+				TickFunctions->RemoveAtSwap(i);
+			}
+		}
+		if (TickFunctions->Num() == 0)
+		{
+			ParallelTick::WorldTickFunctions.Remove(World);
+		}
+	}
+
+} // namespace Klawr
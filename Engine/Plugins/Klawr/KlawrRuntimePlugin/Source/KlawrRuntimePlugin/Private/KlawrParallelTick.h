@@ -0,0 +1,83 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+
+class UKlawrScriptComponent;
+
+namespace Klawr {
+
+/**
+ * @brief Ticks script components marked with ConcurrentTickAttribute in parallel.
+ *
+ * Each world gets a tick function for every script tick group its concurrently tickable script
+ * components use, every frame that tick function splits the active components into batches of
+ * klawr.ParallelTick.BatchSize and ticks the batches on task graph workers (with one transition 
+ * into managed code per batch). Set klawr.ParallelTick to zero to tick all the batches on the 
+ * game thread instead.
+ *
+ * Sleeping components are skipped, and components with a script tick interval are only included
+ * in the frames they're due to tick in.
+ */
+class FParallelTick
+{
+public:
+	/** 
+	 * Start ticking the given script component concurrently, in the tick group of its primary 
+	 * tick function.
+	 */
+	static void Register(UKlawrScriptComponent* Component, int AppDomainID, __int64 InstanceID);
+	/** Stop ticking the given script component. */
+	static void Unregister(UKlawrScriptComponent* Component);
+
+	/** Check if concurrent script component ticks are currently running. */
+	static bool IsTickingConcurrently()
+	{
+		return bIsTickingConcurrently;
+	}
+
+private:
+	// only ever modified on the game thread, outside of concurrent ticks
+	static bool bIsTickingConcurrently;
+};
+
+} // namespace Klawr
+
+/** 
+ * Native wrappers for engine functions that are not thread-safe use this to reject calls made 
+ * from concurrent script component ticks (or any other thread besides the game thread).
+ */
+#define KLAWR_CHECK_THREAD_SAFETY DO_CHECK
+
+#if KLAWR_CHECK_THREAD_SAFETY
+	#define KLAWR_CHECK_NOT_CONCURRENT(FunctionName) \
+		checkf( \
+			IsInGameThread() && !Klawr::FParallelTick::IsTickingConcurrently(), \
+			TEXT("%s isn't thread-safe, it must not be called from concurrent script component ticks or worker threads."), \
+			FunctionName \
+		)
+#else
+	#define KLAWR_CHECK_NOT_CONCURRENT(FunctionName)
+#endif // KLAWR_CHECK_THREAD_SAFETY
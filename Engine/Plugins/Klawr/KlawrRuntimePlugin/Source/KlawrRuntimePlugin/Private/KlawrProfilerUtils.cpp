@@ -0,0 +1,151 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrNativeUtils.h"
+
+DECLARE_STATS_GROUP(TEXT("Klawr Scripts"), STATGROUP_KlawrScripts, STATCAT_Advanced);
+
+namespace Klawr {
+	namespace ProfilerUtils {
+
+#if STATS
+		static FCriticalSection ScopesLock;
+		// scope name -> scope ID, protected by ScopesLock
+		static TMap<FString, int32> ScopeIDs;
+		// indexed by scope ID, protected by ScopesLock
+		static TArray<TStatId> ScopeStats;
+#endif // STATS
+
+		static int32 RegisterScope(const TCHAR* name)
+		{
+#if STATS
+			FScopeLock Lock(&ScopesLock);
+			if (const int32* ScopeID = ScopeIDs.Find(name))
+			{
+				return *ScopeID;
+			}
+			const int32 ScopeID = ScopeStats.Add(
+				FDynamicStats::CreateStatId<FStatGroup_STATGROUP_KlawrScripts>(FString(name))
+			);
+			ScopeIDs.Add(name, ScopeID);
+			return ScopeID;
+#else
+			return 0;
+#endif // STATS
+		}
+
+		static unsigned char EmitScopes(
+			const int32* scopeEvents, const int64* timestamps, int32 count
+		)
+		{
+#if STATS
+			if (!FThreadStats::IsCollectingData())
+			{
+				return 0;
+			}
+			if (count == 0)
+			{
+				return 1;
+			}
+
+			// Managed code timestamps scopes with Stopwatch, which uses QueryPerformanceCounter(),
+			// so do cycle stats, hence the timestamps can be passed through as they are (though 
+			// cycle stats are only 32-bit). The scopes are emitted after the fact, but they end 
+			// up in the hierarchy wherever the stat stack of this thread currently is.
+			FScopeLock Lock(&ScopesLock);
+
+			// Pair up the events first, a begin without a matching end (e.g. a scope that's still
+			// open, or one that spans an await) and an end without a matching begin are both 
+			// discarded, along with any scopes nested in a scope whose end didn't match, so only
+			// balanced scopes reach the stat stack of this thread.
+			TArray<int32, TInlineAllocator<256>> MatchingEnds;
+			MatchingEnds.Init(INDEX_NONE, count);
+			TArray<int32, TInlineAllocator<16>> OpenScopes;
+			for (int32 i = 0; i < count; ++i)
+			{
+				const int32 ScopeEvent = scopeEvents[i];
+				if (ScopeEvent >= 0)
+				{
+					OpenScopes.Push(i);
+				}
+				else
+				{
+					for (int32 j = OpenScopes.Num() - 1; j >= 0; --j)
+					{
+						if (scopeEvents[OpenScopes[j]] == ~ScopeEvent)
+						{
+							MatchingEnds[OpenScopes[j]] = i;
+							OpenScopes.RemoveAt(j, OpenScopes.Num() - j, false);
+							break;
+						}
+					}
+				}
+			}
+
+			// the ends of the scopes emitted so far, innermost last
+			TArray<int32, TInlineAllocator<16>> EmittedScopes;
+			for (int32 i = 0; i < count; ++i)
+			{
+				const int64 Timestamp = static_cast<int64>(static_cast<uint32>(timestamps[i]));
+				if ((EmittedScopes.Num() > 0) && (EmittedScopes.Last() == i))
+				{
+					EmittedScopes.Pop();
+					FThreadStats::AddMessage(
+						ScopeStats[~scopeEvents[i]].GetName(), EStatOperation::CycleScopeEnd,
+						Timestamp, true
+					);
+				}
+				else if (MatchingEnds[i] != INDEX_NONE)
+				{
+					const int32 ScopeID = scopeEvents[i];
+					// the stat is invalid if the stats group has been disabled, and an ID that 
+					// wasn't registered can only come from a broken buffer
+					if (ScopeStats.IsValidIndex(ScopeID) && ScopeStats[ScopeID].IsValidStat() &&
+						((EmittedScopes.Num() == 0) || (MatchingEnds[i] < EmittedScopes.Last())))
+					{
+						EmittedScopes.Push(MatchingEnds[i]);
+						FThreadStats::AddMessage(
+							ScopeStats[ScopeID].GetName(), EStatOperation::CycleScopeStart,
+							Timestamp, true
+						);
+					}
+				}
+			}
+			check(EmittedScopes.Num() == 0);
+			return 1;
+#else
+			return 0;
+#endif // STATS
+		}
+
+	} // namespace ProfilerUtils
+
+	ProfilerUtilsProxy FNativeUtils::Profiler =
+	{
+		ProfilerUtils::RegisterScope,
+		ProfilerUtils::EmitScopes
+	};
+
+} // namespace Klawr
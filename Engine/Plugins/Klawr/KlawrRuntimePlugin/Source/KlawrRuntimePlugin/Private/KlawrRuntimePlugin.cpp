@@ -25,6 +25,14 @@
 #include "KlawrClrHost.h"
 #include "KlawrNativeUtils.h"
 #include "KlawrObjectReferencer.h"
+#include "KlawrThreadStringScratch.h"
+#include "KlawrClrMemory.h"
+#include "KlawrClrGC.h"
+#include "KlawrParallelTick.h"
+#include "KlawrTickLod.h"
+#include "KlawrWorkQueue.h"
+#include "KlawrScriptProfiler.h"
+#include "KlawrNativeGlue.h"
 
 DEFINE_LOG_CATEGORY(LogKlawrRuntimePlugin);
 
@@ -44,16 +52,11 @@ UProperty* FindScriptPropertyHelper(const UClass* Class, FName PropertyName)
 	return nullptr;
 }
 
-namespace NativeGlue {
-
-// defined in KlawrGeneratedNativeWrappers.inl (included down below)
-void RegisterWrapperClasses();
-
-} // namespace NativeGlue
-
 class FRuntimePlugin : public IKlawrRuntimePlugin
 {
 	int PrimaryEngineAppDomainID;
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle MemoryTrimHandle;
 
 #if WITH_EDITOR
 	int PIEAppDomainID;
@@ -88,6 +91,13 @@ public:
 			{
 				PrimaryEngineAppDomainID = NewAppDomainID;
 				bReloaded = true;
+				// memory that isn't released when an app domain is unloaded will accumulate
+				// with every reload, so keep an eye on it
+				UE_LOG(
+					LogKlawrRuntimePlugin, Log, 
+					TEXT("Reloaded primary engine app domain, CLR memory: %.2f MB"),
+					FClrMemory::GetTotalAllocatedBytes() / (1024.0 * 1024.0)
+				);
 			}
 			else
 			{
@@ -114,6 +124,11 @@ public:
 			Types.Add(FString(scriptType.c_str()));
 		}
 	}
+
+	virtual bool WriteWrapperUsage(const FString& Filename) override
+	{
+		return IClrHost::Get()->WriteWrapperUsage(PrimaryEngineAppDomainID, *Filename);
+	}
 #endif // WITH_EDITOR
 
 	virtual int GetObjectAppDomainID(const UObject* Object) const override
@@ -172,7 +187,11 @@ public:
 			{
 				FNativeUtils::Object,
 				FNativeUtils::Log,
-				FNativeUtils::Array
+				FNativeUtils::Array,
+				FNativeUtils::Name,
+				FNativeUtils::ScriptComponent,
+				FNativeUtils::Profiler,
+				FNativeUtils::Task
 			};
 			return clrHost->InitEngineAppDomain(outAppDomainID, nativeUtils);
 		}
@@ -209,11 +228,59 @@ public:
 		return bDestroyed;
 	}
 
+	virtual bool TryStartNoGCRegion(int64 TotalSize) override
+	{
+		return FClrGC::TryStartNoGCRegion(TotalSize);
+	}
+
+	virtual void EndNoGCRegion() override
+	{
+		FClrGC::EndNoGCRegion();
+	}
+
+	virtual void CollectGarbage() override
+	{
+		FClrGC::CollectAll();
+	}
+
+private:
+	void FlushLogs()
+	{
+		IClrHost::Get()->FlushLogs();
+		// the verbosity can be changed at any time with the Log console command, and there's no
+		// notification when that happens
+		FNativeUtils::UpdateLogVerbosity();
+	}
+
+	void OnEndFrame()
+	{
+		// select how often script components tick next frame
+		FTickLod::Update();
+		// resume async script methods that are waiting for this frame, this is done before the
+		// logs are flushed so that anything they log shows up this frame
+		IClrHost::Get()->RunFrame(FApp::GetDeltaTime());
+		// run deferred script work within the work queue time budget
+		FWorkQueue::Tick();
+		// emit profiling scopes opened by anything that ran on the game thread outside of a tick
+		IClrHost::Get()->FlushProfilerScopes();
+		FlushLogs();
+		FClrGC::Tick();
+		FScriptProfiler::Tick();
+	}
+
+	void OnMemoryTrim()
+	{
+		// the engine is being asked to release memory, so the GC should collect more eagerly
+		IClrHost::Get()->NotifyLowMemory();
+	}
+
 public: // IModuleInterface interface
 	
 	virtual void StartupModule() override
 	{
 		FObjectReferencer::Startup();
+		FThreadStringScratch::Startup();
+		FNativeUtils::UpdateLogVerbosity();
 		FString GameAssembliesDir = FPaths::ConvertRelativePathToFull(
 			FPaths::Combine(
 				*FPaths::GameDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory(),
@@ -221,9 +288,21 @@ public: // IModuleInterface interface
 			)
 		);
 		
-		if (IClrHost::Get()->Startup(*GameAssembliesDir, TEXT("GameScripts")))
+		if (IClrHost::Get()->Startup(
+			*GameAssembliesDir, TEXT("GameScripts"), 
+			FClrGC::GetStartupOptions(&FClrMemory::GetHooks())
+		))
 		{
 			NativeGlue::RegisterWrapperClasses();
+			FClrGC::Startup();
+			FClrMemory::Startup();
+			// managed code queues log messages and continuations of async methods, process 
+			// them in one batch per frame, and adjust the GC latency mode to whatever the engine
+			// is doing
+			EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FRuntimePlugin::OnEndFrame);
+			MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddRaw(
+				this, &FRuntimePlugin::OnMemoryTrim
+			);
 #if !WITH_EDITOR
 			// When running in the editor the primary app domain will be created when the Klawr 
 			// editor plugin starts up, which will be after the runtime plugin, this is done so that
@@ -240,9 +319,17 @@ public: // IModuleInterface interface
 	
 	virtual void ShutdownModule() override
 	{
+		if (EndFrameHandle.IsValid())
+		{
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+			FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+			FlushLogs();
+			FClrGC::Shutdown();
+		}
 		// the host will destroy all app domains on shutdown, there is no need to explicitly
 		// destroy the primary app domain
 		IClrHost::Get()->Shutdown();
+		FThreadStringScratch::Shutdown();
 		FObjectReferencer::Shutdown();
 	}
 
@@ -26,10 +26,45 @@
 #include "KlawrScriptComponent.h"
 #include "KlawrClrHost.h"
 #include "KlawrBlueprintGeneratedClass.h"
+#include "KlawrParallelTick.h"
+#include "KlawrNativeUtils.h"
+#include "KlawrTickLod.h"
+#include "KlawrScriptProfiler.h"
+
+namespace Klawr {
+	namespace ScriptComponent {
+
+		/** Number of staggered script tick intervals set so far. */
+		static FThreadSafeCounter NumStaggeredIntervals;
+
+		/** 
+		 * Get the fraction of the interval by which to delay the next script tick, consecutive 
+		 * calls return values that are spread fairly evenly across [0, 1) no matter how many 
+		 * components are created.
+		 */
+		static float GetNextStaggerPhase()
+		{
+			const double GoldenRatioConjugate = 0.6180339887498949;
+			const double Phase = 
+				static_cast<uint32>(NumStaggeredIntervals.Increment()) * GoldenRatioConjugate;
+			return static_cast<float>(Phase - FMath::FloorToDouble(Phase));
+		}
+
+	} // namespace ScriptComponent
+} // namespace Klawr
 
 UKlawrScriptComponent::UKlawrScriptComponent(const FObjectInitializer& objectInitializer)
 	: Super(objectInitializer)
 	, Proxy(nullptr)
+	, ScriptTickInterval(0.0f)
+	, TimeUntilScriptTick(0.0f)
+	, TimeSinceScriptTick(0.0f)
+	, StaggerPhase(0.0f)
+	, TickLodInterval(0.0f)
+	, TickLod(static_cast<int32>(EScriptTickLod::Full))
+	, bTicksConcurrently(false)
+	, bIsSleeping(false)
+	, bUsesTickLod(false)
 {
 	// by default disable everything, re-enable only the relevant bits in OnRegister()
 	PrimaryComponentTick.bCanEverTick = false;
@@ -90,11 +125,35 @@ void UKlawrScriptComponent::OnRegister()
 		// users don't have to implement InitializeComponent() and TickComponent() in their scripts,
 		// so here we figure out which of those have been implemented
 		bWantsInitializeComponent = !!Proxy->InitializeComponent;
-		PrimaryComponentTick.bCanEverTick = !!Proxy->TickComponent;
-		bAutoActivate = PrimaryComponentTick.bCanEverTick;
+		bAutoActivate = !!Proxy->TickComponent;
+		TickLod = static_cast<int32>(EScriptTickLod::Full);
+		TickLodInterval = 0.0f;
+		SetScriptTickInterval(Proxy->TickInterval, !!Proxy->bStaggerTicks);
+		SetScriptTickGroup(Klawr::FNativeUtils::ToTickingGroup(Proxy->TickGroup));
+		// components that can tick concurrently are ticked in batches in a separate tick function
+		UWorld* World = GetWorld();
+		bTicksConcurrently = bAutoActivate && Proxy->bCanTickConcurrently &&
+			World && World->IsGameWorld();
+		PrimaryComponentTick.bCanEverTick = bAutoActivate && !bTicksConcurrently;
+		PrimaryComponentTick.bStartWithTickEnabled = !bIsSleeping;
+		if (bTicksConcurrently)
+		{
+			Klawr::FParallelTick::Register(
+				this, IKlawrRuntimePlugin::Get().GetObjectAppDomainID(this), Proxy->InstanceID
+			);
+		}
+		// some components tick at a reduced rate when they're less significant
+		bUsesTickLod = bAutoActivate && Proxy->bUseTickLod && World && World->IsGameWorld();
+		if (bUsesTickLod)
+		{
+			Klawr::FTickLod::Register(
+				this, IKlawrRuntimePlugin::Get().GetObjectAppDomainID(this), *Proxy
+			);
+		}
 
 		if (Proxy->OnRegister)
 		{
+			KLAWR_SCOPE_SCRIPT_PROFILER(this, Klawr::EScriptProfileEvent::OnRegister);
 			Proxy->OnRegister();
 		}
 	}
@@ -105,10 +164,23 @@ void UKlawrScriptComponent::OnRegister()
 
 void UKlawrScriptComponent::OnUnregister()
 {
+	if (bTicksConcurrently)
+	{
+		Klawr::FParallelTick::Unregister(this);
+		bTicksConcurrently = false;
+	}
+
+	if (bUsesTickLod)
+	{
+		Klawr::FTickLod::Unregister(this);
+		bUsesTickLod = false;
+	}
+
 	if (Proxy)
 	{
 		if (Proxy->OnUnregister)
 		{
+			KLAWR_SCOPE_SCRIPT_PROFILER(this, Klawr::EScriptProfileEvent::OnUnregister);
 			Proxy->OnUnregister();
 		}
 	
@@ -124,6 +196,7 @@ void UKlawrScriptComponent::InitializeComponent()
 
 	if (Proxy && Proxy->InitializeComponent)
 	{
+		KLAWR_SCOPE_SCRIPT_PROFILER(this, Klawr::EScriptProfileEvent::InitializeComponent);
 		Proxy->InitializeComponent();
 	}
 }
@@ -134,8 +207,112 @@ void UKlawrScriptComponent::TickComponent(
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (Proxy && Proxy->TickComponent)
+	float ScriptDeltaTime;
+	if (Proxy && Proxy->TickComponent && ConsumeScriptTickTime(DeltaTime, ScriptDeltaTime))
+	{
+		KLAWR_SCOPE_SCRIPT_PROFILER(this, Klawr::EScriptProfileEvent::TickComponent);
+		Proxy->TickComponent(ScriptDeltaTime);
+#if STATS
+		// emit any profiling scopes the script opened while the stat scope of this tick is active
+		if (FThreadStats::IsCollectingData())
+		{
+			Proxy->FlushProfilerScopes();
+		}
+#endif // STATS
+	}
+}
+
+void UKlawrScriptComponent::SetScriptTickInterval(float Interval, bool bStagger)
+{
+	ScriptTickInterval = FMath::Max(0.0f, Interval);
+	StaggerPhase = bStagger ? Klawr::ScriptComponent::GetNextStaggerPhase() : 0.0f;
+	TimeUntilScriptTick = GetEffectiveScriptTickInterval() * StaggerPhase;
+}
+
+void UKlawrScriptComponent::SetScriptTickGroup(ETickingGroup TickGroup)
+{
+	// the tick task manager reads the tick group every frame, so there's no need to re-register
+	// the tick function for the change to take effect
+	PrimaryComponentTick.TickGroup = TickGroup;
+	// concurrently ticked components have to move to the tick function of the new tick group
+	if (bTicksConcurrently && Proxy)
+	{
+		Klawr::FParallelTick::Unregister(this);
+		Klawr::FParallelTick::Register(
+			this, IKlawrRuntimePlugin::Get().GetObjectAppDomainID(this), Proxy->InstanceID
+		);
+	}
+}
+
+void UKlawrScriptComponent::Sleep()
+{
+	if (!bIsSleeping)
+	{
+		bIsSleeping = true;
+		UpdateTickEnabled();
+	}
+}
+
+void UKlawrScriptComponent::Wake()
+{
+	if (bIsSleeping)
+	{
+		bIsSleeping = false;
+		// the first tick after waking up shouldn't include the time spent sleeping
+		TimeSinceScriptTick = 0.0f;
+		UpdateTickEnabled();
+	}
+}
+
+void UKlawrScriptComponent::SetTickLod(int32 Lod, float Interval)
+{
+	const bool bWasSuspended = IsTickLodSuspended();
+	TickLod = Lod;
+	if (Interval != TickLodInterval)
+	{
+		TickLodInterval = Interval;
+		// tick sooner if the interval got shorter, but keep counting down if it got longer
+		TimeUntilScriptTick = FMath::Min(
+			TimeUntilScriptTick, GetEffectiveScriptTickInterval() * StaggerPhase
+		);
+	}
+	if (bWasSuspended != IsTickLodSuspended())
+	{
+		UpdateTickEnabled();
+	}
+}
+
+void UKlawrScriptComponent::UpdateTickEnabled()
+{
+	// concurrently ticked components are skipped by Klawr::FParallelTick instead
+	if (!bTicksConcurrently)
 	{
-		Proxy->TickComponent(DeltaTime);
+		SetComponentTickEnabled(!bIsSleeping && !IsTickLodSuspended());
+	}
+}
+
+bool UKlawrScriptComponent::ConsumeScriptTickTime(float DeltaTime, float& OutDeltaTime)
+{
+	// like sleeping, time spent suspended doesn't count towards the next script tick
+	if (IsTickLodSuspended())
+	{
+		return false;
+	}
+
+	const float Interval = GetEffectiveScriptTickInterval();
+	TimeSinceScriptTick += DeltaTime;
+	if (Interval > 0.0f)
+	{
+		TimeUntilScriptTick -= DeltaTime;
+		if (TimeUntilScriptTick > 0.0f)
+		{
+			return false;
+		}
+		// after a long frame tick once and skip the missed ticks rather than trying to catch up,
+		// but keep the phase so staggered components stay spread across frames
+		TimeUntilScriptTick = FMath::Fmod(TimeUntilScriptTick, Interval) + Interval;
 	}
+	OutDeltaTime = TimeSinceScriptTick;
+	TimeSinceScriptTick = 0.0f;
+	return true;
 }
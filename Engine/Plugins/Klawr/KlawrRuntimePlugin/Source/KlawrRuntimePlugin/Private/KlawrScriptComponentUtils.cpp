@@ -0,0 +1,103 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrNativeUtils.h"
+#include "KlawrClrHost.h"
+#include "KlawrScriptComponent.h"
+#include "KlawrParallelTick.h"
+
+namespace Klawr {
+	namespace ScriptComponentUtils {
+
+		static UKlawrScriptComponent* ToScriptComponent(UObject* component)
+		{
+			UKlawrScriptComponent* scriptComponent = Cast<UKlawrScriptComponent>(component);
+			check(scriptComponent);
+			return scriptComponent;
+		}
+
+		static void SetTickInterval(UObject* component, float interval, unsigned char bStagger)
+		{
+			KLAWR_CHECK_NOT_CONCURRENT(TEXT("ScriptComponent::SetTickInterval"));
+			ToScriptComponent(component)->SetScriptTickInterval(interval, bStagger != 0);
+		}
+
+		static void SetTickGroup(UObject* component, int32 tickGroup)
+		{
+			KLAWR_CHECK_NOT_CONCURRENT(TEXT("ScriptComponent::SetTickGroup"));
+			ToScriptComponent(component)->SetScriptTickGroup(FNativeUtils::ToTickingGroup(tickGroup));
+		}
+
+		static void Sleep(UObject* component)
+		{
+			KLAWR_CHECK_NOT_CONCURRENT(TEXT("ScriptComponent::Sleep"));
+			ToScriptComponent(component)->Sleep();
+		}
+
+		static void Wake(UObject* component)
+		{
+			KLAWR_CHECK_NOT_CONCURRENT(TEXT("ScriptComponent::Wake"));
+			ToScriptComponent(component)->Wake();
+		}
+
+		static unsigned char IsSleeping(UObject* component)
+		{
+			return ToScriptComponent(component)->IsSleeping() ? 1 : 0;
+		}
+
+		static const int32* GetTickLodAddress(UObject* component)
+		{
+			return ToScriptComponent(component)->GetTickLodAddress();
+		}
+
+	} // namespace ScriptComponentUtils
+
+	ScriptComponentUtilsProxy FNativeUtils::ScriptComponent =
+	{
+		ScriptComponentUtils::SetTickInterval,
+		ScriptComponentUtils::SetTickGroup,
+		ScriptComponentUtils::Sleep,
+		ScriptComponentUtils::Wake,
+		ScriptComponentUtils::IsSleeping,
+		ScriptComponentUtils::GetTickLodAddress
+	};
+
+	ETickingGroup FNativeUtils::ToTickingGroup(int32 ScriptTickGroup)
+	{
+		// must be kept in sync with Klawr.ClrHost.Managed.ScriptTickGroup
+		switch (ScriptTickGroup)
+		{
+			case 2:
+				return TG_DuringPhysics;
+			case 3:
+				return TG_PostPhysics;
+			case 4:
+				return TG_PostUpdateWork;
+			default:
+				return TG_PrePhysics;
+		}
+	}
+
+} // namespace Klawr
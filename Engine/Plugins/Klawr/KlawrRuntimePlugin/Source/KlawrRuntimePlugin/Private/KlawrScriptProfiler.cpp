@@ -0,0 +1,375 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrScriptProfiler.h"
+#include "KlawrScriptComponent.h"
+#include "KlawrBlueprintGeneratedClass.h"
+#include "KlawrClrHost.h"
+
+namespace Klawr {
+	namespace ScriptProfiler {
+
+		static TMap<const UClass*, FScriptProfileRecord> ClassRecords;
+		static TMap<TWeakObjectPtr<UKlawrScriptComponent>, FScriptProfileRecord> InstanceRecords;
+		// allocation count of each app domain with profiled script components at the end of the 
+		// previous frame, indexed by app domain ID
+		static TMap<int, int64> LastAllocatedBytes;
+		static FScriptProfileAllocations Allocations;
+		static double CapturedSeconds = 0.0;
+		static double StartSeconds = 0.0;
+
+		static const TCHAR* EventNames[] = 
+		{
+			TEXT("OnRegister"),
+			TEXT("OnUnregister"),
+			TEXT("InitializeComponent"),
+			TEXT("TickComponent")
+		};
+		static_assert(
+			ARRAY_COUNT(EventNames) == (int32)EScriptProfileEvent::Count, 
+			"EventNames doesn't match EScriptProfileEvent!"
+		);
+
+		static FString GetScriptTypeName(UClass* ComponentClass)
+		{
+			auto GeneratedClass = UKlawrBlueprintGeneratedClass::GetBlueprintGeneratedClass(
+				ComponentClass
+			);
+			return GeneratedClass ? GeneratedClass->ScriptDefinedType : ComponentClass->GetName();
+		}
+
+		static FScriptProfileRecord& FindOrAddClassRecord(UClass* ComponentClass)
+		{
+			FScriptProfileRecord* Record = ClassRecords.Find(ComponentClass);
+			if (!Record)
+			{
+				Record = &ClassRecords.Add(ComponentClass);
+				Record->TypeName = GetScriptTypeName(ComponentClass);
+				Record->Name = Record->TypeName;
+			}
+			return *Record;
+		}
+
+		static FScriptProfileRecord& FindOrAddInstanceRecord(UKlawrScriptComponent* Component)
+		{
+			FScriptProfileRecord* Record = InstanceRecords.Find(Component);
+			if (!Record)
+			{
+				Record = &InstanceRecords.Add(Component);
+				Record->TypeName = GetScriptTypeName(Component->GetClass());
+				AActor* Owner = Component->GetOwner();
+				Record->Name = Owner ? 
+					FString::Printf(TEXT("%s.%s"), *Owner->GetName(), *Component->GetName()) :
+					Component->GetName();
+			}
+			return *Record;
+		}
+
+		static void Record(
+			UKlawrScriptComponent* Component, EScriptProfileEvent Event, 
+			const FScriptProfileCounters& Counters
+		)
+		{
+			FindOrAddClassRecord(Component->GetClass()).Events[(int32)Event].Add(Counters);
+			if (FScriptProfiler::IsPerInstance())
+			{
+				FindOrAddInstanceRecord(Component).Events[(int32)Event].Add(Counters);
+			}
+		}
+
+		static void SampleAllocations(UKlawrScriptComponent* Component)
+		{
+			const int AppDomainID = IKlawrRuntimePlugin::Get().GetObjectAppDomainID(Component);
+			if (!LastAllocatedBytes.Contains(AppDomainID))
+			{
+				// allocations are counted from the end of this frame on
+				GetAllocatedBytesFunc GetAllocatedBytes = 
+					IClrHost::Get()->GetAllocatedBytesFunction(AppDomainID);
+				LastAllocatedBytes.Add(AppDomainID, GetAllocatedBytes ? GetAllocatedBytes() : 0);
+			}
+		}
+
+		static void PrintRecords(TArray<FScriptProfileRecord>& Records, const FString& SortBy)
+		{
+			if (SortBy == TEXT("calls"))
+			{
+				Records.Sort([](const FScriptProfileRecord& A, const FScriptProfileRecord& B)
+				{
+					return A.GetTotal().Calls > B.GetTotal().Calls;
+				});
+			}
+			else
+			{
+				Records.Sort([](const FScriptProfileRecord& A, const FScriptProfileRecord& B)
+				{
+					return A.GetTotal().Cycles > B.GetTotal().Cycles;
+				});
+			}
+
+			const double Seconds = FMath::Max(FScriptProfiler::GetCapturedSeconds(), 0.001);
+			const FScriptProfileAllocations FrameAllocations = FScriptProfiler::GetAllocations();
+			UE_LOG(
+				LogKlawrRuntimePlugin, Display, 
+				TEXT("Script profile (%.1f seconds, %lld frames): managed allocations %.1f KB ")
+				TEXT("per frame on average, %.1f KB peak (counted in ~8 KB steps per thread)"),
+				Seconds, FrameAllocations.Frames, FrameAllocations.GetAverageFrameBytes() / 1024.0,
+				FrameAllocations.PeakFrameBytes / 1024.0
+			);
+			UE_LOG(
+				LogKlawrRuntimePlugin, Display, TEXT("  %-40s %10s %12s %10s"),
+				TEXT("Name"), TEXT("Calls"), TEXT("Total (ms)"), TEXT("ms/sec")
+			);
+			for (const FScriptProfileRecord& Record : Records)
+			{
+				const FScriptProfileCounters Total = Record.GetTotal();
+				UE_LOG(
+					LogKlawrRuntimePlugin, Display, TEXT("  %-40s %10lld %12.2f %10.3f"),
+					*Record.Name, Total.Calls, Total.GetMilliseconds(), 
+					Total.GetMilliseconds() / Seconds
+				);
+				for (int32 i = 0; i < (int32)EScriptProfileEvent::Count; ++i)
+				{
+					const FScriptProfileCounters& Counters = Record.Events[i];
+					if (Counters.Calls > 0)
+					{
+						UE_LOG(
+							LogKlawrRuntimePlugin, Display, 
+							TEXT("    %-38s %10lld %12.2f %10.3f"),
+							EventNames[i], Counters.Calls, Counters.GetMilliseconds(), 
+							Counters.GetMilliseconds() / Seconds
+						);
+					}
+				}
+			}
+		}
+
+		static void ExecCommand(const TArray<FString>& Args)
+		{
+			const FString Command = (Args.Num() > 0) ? Args[0].ToLower() : FString();
+			if (Command == TEXT("start"))
+			{
+				FScriptProfiler::Start(Args.Contains(TEXT("instances")));
+			}
+			else if (Command == TEXT("stop"))
+			{
+				FScriptProfiler::Stop();
+			}
+			else if (Command == TEXT("reset"))
+			{
+				FScriptProfiler::Reset();
+			}
+			else if (Command == TEXT("dump"))
+			{
+				const FString SortBy = (Args.Num() > 1) ? Args[1].ToLower() : FString();
+				TArray<FScriptProfileRecord> Records;
+				if (Args.Contains(TEXT("instances")))
+				{
+					FScriptProfiler::GetInstanceRecords(Records);
+				}
+				else
+				{
+					FScriptProfiler::GetTypeRecords(Records);
+				}
+				PrintRecords(Records, SortBy);
+			}
+			else
+			{
+				UE_LOG(
+					LogKlawrRuntimePlugin, Display, 
+					TEXT("Usage: klawr.ScriptProfiler Start [instances] | Stop | Reset | ")
+					TEXT("Dump [time|calls] [instances]")
+				);
+			}
+		}
+
+		static FAutoConsoleCommand Command(
+			TEXT("klawr.ScriptProfiler"),
+			TEXT("Profile calls into managed script components.\n")
+			TEXT(" Start [instances]: start profiling (per script type, and optionally per instance)\n")
+			TEXT(" Stop: stop profiling\n")
+			TEXT(" Reset: clear everything gathered so far\n")
+			TEXT(" Dump [time|calls] [instances]: log the results sorted by the given column"),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&ExecCommand)
+		);
+
+	} // namespace ScriptProfiler
+
+	bool FScriptProfiler::bIsRunning = false;
+	bool FScriptProfiler::bIsPerInstance = false;
+
+	void FScriptProfiler::Start(bool bPerInstance)
+	{
+		check(IsInGameThread());
+
+		if (!bIsRunning)
+		{
+			bIsRunning = true;
+			ScriptProfiler::StartSeconds = FPlatformTime::Seconds();
+			// don't count allocations made while the profiler was stopped
+			ScriptProfiler::LastAllocatedBytes.Empty();
+		}
+		bIsPerInstance = bPerInstance;
+	}
+
+	void FScriptProfiler::Stop()
+	{
+		check(IsInGameThread());
+
+		if (bIsRunning)
+		{
+			bIsRunning = false;
+			ScriptProfiler::CapturedSeconds += 
+				FPlatformTime::Seconds() - ScriptProfiler::StartSeconds;
+		}
+	}
+
+	void FScriptProfiler::Reset()
+	{
+		check(IsInGameThread());
+
+		ScriptProfiler::ClassRecords.Empty();
+		ScriptProfiler::InstanceRecords.Empty();
+		ScriptProfiler::LastAllocatedBytes.Empty();
+		ScriptProfiler::Allocations = FScriptProfileAllocations();
+		ScriptProfiler::CapturedSeconds = 0.0;
+		ScriptProfiler::StartSeconds = FPlatformTime::Seconds();
+	}
+
+	double FScriptProfiler::GetCapturedSeconds()
+	{
+		double Seconds = ScriptProfiler::CapturedSeconds;
+		if (bIsRunning)
+		{
+			Seconds += FPlatformTime::Seconds() - ScriptProfiler::StartSeconds;
+		}
+		return Seconds;
+	}
+
+	void FScriptProfiler::GetTypeRecords(TArray<FScriptProfileRecord>& OutRecords)
+	{
+		check(IsInGameThread());
+
+		// different blueprints may share the same script type
+		OutRecords.Reset();
+		TMap<FString, int32> TypeIndices;
+		for (const auto& ClassRecord : ScriptProfiler::ClassRecords)
+		{
+			const FScriptProfileRecord& Record = ClassRecord.Value;
+			const int32* Index = TypeIndices.Find(Record.TypeName);
+			if (Index)
+			{
+				FScriptProfileRecord& TypeRecord = OutRecords[*Index];
+				for (int32 i = 0; i < (int32)EScriptProfileEvent::Count; ++i)
+				{
+					TypeRecord.Events[i].Add(Record.Events[i]);
+				}
+			}
+			else
+			{
+				TypeIndices.Add(Record.TypeName, OutRecords.Add(Record));
+			}
+		}
+	}
+
+	void FScriptProfiler::GetInstanceRecords(TArray<FScriptProfileRecord>& OutRecords)
+	{
+		check(IsInGameThread());
+
+		OutRecords.Reset();
+		for (const auto& InstanceRecord : ScriptProfiler::InstanceRecords)
+		{
+			OutRecords.Add(InstanceRecord.Value);
+		}
+	}
+
+	FScriptProfileAllocations FScriptProfiler::GetAllocations()
+	{
+		return ScriptProfiler::Allocations;
+	}
+
+	void FScriptProfiler::RecordConcurrentTicks(
+		UClass* ComponentClass, int32 NumComponents, uint64 Cycles
+	)
+	{
+		check(IsInGameThread());
+
+		FScriptProfileCounters& Counters = ScriptProfiler::FindOrAddClassRecord(ComponentClass)
+			.Events[(int32)EScriptProfileEvent::TickComponent];
+		Counters.Calls += NumComponents;
+		Counters.Cycles += Cycles;
+	}
+
+	void FScriptProfiler::Tick()
+	{
+		check(IsInGameThread());
+
+		if (!bIsRunning || (ScriptProfiler::LastAllocatedBytes.Num() == 0))
+		{
+			return;
+		}
+
+		int64 FrameBytes = 0;
+		for (auto It = ScriptProfiler::LastAllocatedBytes.CreateIterator(); It; ++It)
+		{
+			// the app domain may have been unloaded since the previous frame
+			GetAllocatedBytesFunc GetAllocatedBytes = 
+				IClrHost::Get()->GetAllocatedBytesFunction(It.Key());
+			if (!GetAllocatedBytes)
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+			const int64 AllocatedBytes = GetAllocatedBytes();
+			FrameBytes += AllocatedBytes - It.Value();
+			It.Value() = AllocatedBytes;
+		}
+
+		FScriptProfileAllocations& Allocations = ScriptProfiler::Allocations;
+		++Allocations.Frames;
+		Allocations.TotalBytes += FrameBytes;
+		Allocations.PeakFrameBytes = FMath::Max(Allocations.PeakFrameBytes, FrameBytes);
+	}
+
+	void FScriptProfiler::FScope::Begin(
+		UKlawrScriptComponent* InComponent, EScriptProfileEvent InEvent
+	)
+	{
+		check(IsInGameThread());
+
+		Component = InComponent;
+		Event = InEvent;
+		ScriptProfiler::SampleAllocations(InComponent);
+		StartCycles = FPlatformTime::Cycles();
+	}
+
+	void FScriptProfiler::FScope::End()
+	{
+		FScriptProfileCounters Counters;
+		Counters.Cycles = FPlatformTime::Cycles() - StartCycles;
+		Counters.Calls = 1;
+		ScriptProfiler::Record(Component, Event, Counters);
+	}
+
+} // namespace Klawr
@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrNativeUtils.h"
+
+DECLARE_CYCLE_STAT(TEXT("Klawr Managed Work Item"), STAT_KlawrManagedWorkItem, STATGROUP_TaskGraphTasks);
+
+namespace Klawr {
+	namespace TaskUtils {
+
+		/** 
+		 * Keeps track of the work items that call a particular callback, each app domain has its
+		 * own callback, and its work items must not run once the app domain has been unloaded.
+		 */
+		struct FWorkOwner
+		{
+			/** Number of work items currently calling the callback. */
+			FThreadSafeCounter NumRunning;
+			/** Non-zero once CancelWork() has been called for the callback. */
+			volatile int32 bCancelled;
+
+			FWorkOwner() : bCancelled(0) {}
+		};
+
+		typedef TSharedPtr<FWorkOwner, ESPMode::ThreadSafe> FWorkOwnerPtr;
+
+		static TMap<TaskUtilsProxy::WorkCallback, FWorkOwnerPtr> WorkOwners;
+		static FCriticalSection WorkOwnersLock;
+
+		static FWorkOwnerPtr GetWorkOwner(TaskUtilsProxy::WorkCallback Callback)
+		{
+			FScopeLock Lock(&WorkOwnersLock);
+			FWorkOwnerPtr& Owner = WorkOwners.FindOrAdd(Callback);
+			if (!Owner.IsValid())
+			{
+				Owner = MakeShareable(new FWorkOwner());
+			}
+			return Owner;
+		}
+
+		static uint8 QueueWork(TaskUtilsProxy::WorkCallback Callback, void* Context)
+		{
+			// managed code falls back to the CLR thread pool once the task graph is gone
+			if (!FTaskGraphInterface::IsRunning())
+			{
+				return 0;
+			}
+			FWorkOwnerPtr Owner = GetWorkOwner(Callback);
+			FFunctionGraphTask::CreateAndDispatchWhenReady(
+				[Owner, Callback, Context]()
+				{
+					// the counter is incremented before the flag is checked, and CancelWork() 
+					// sets the flag before it checks the counter, so either the callback isn't
+					// called or CancelWork() waits for it to return
+					Owner->NumRunning.Increment();
+					if (!Owner->bCancelled)
+					{
+						Callback(Context);
+					}
+					Owner->NumRunning.Decrement();
+				},
+				GET_STATID(STAT_KlawrManagedWorkItem), nullptr, ENamedThreads::AnyThread
+			);
+			return 1;
+		}
+
+		static int32 GetNumWorkerThreads()
+		{
+			if (!FTaskGraphInterface::IsRunning())
+			{
+				return 1;
+			}
+			return FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		}
+
+		static void CancelWork(TaskUtilsProxy::WorkCallback Callback)
+		{
+			FWorkOwnerPtr Owner;
+			{
+				FScopeLock Lock(&WorkOwnersLock);
+				WorkOwners.RemoveAndCopyValue(Callback, Owner);
+			}
+			if (!Owner.IsValid())
+			{
+				return;
+			}
+			// work items that are still queued keep the owner alive, and skip the callback
+			FPlatformAtomics::InterlockedExchange(&Owner->bCancelled, 1);
+			while (Owner->NumRunning.GetValue() > 0)
+			{
+				FPlatformProcess::Sleep(0.0f);
+			}
+		}
+
+	} // namespace TaskUtils
+
+	TaskUtilsProxy FNativeUtils::Task =
+	{
+		TaskUtils::QueueWork,
+		TaskUtils::GetNumWorkerThreads,
+		TaskUtils::CancelWork
+	};
+
+} // namespace Klawr
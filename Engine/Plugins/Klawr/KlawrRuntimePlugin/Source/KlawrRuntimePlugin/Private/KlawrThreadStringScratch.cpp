@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrThreadStringScratch.h"
+
+namespace Klawr {
+
+FThreadStringScratch* FThreadStringScratch::Singleton = nullptr;
+
+void FThreadStringScratch::Startup()
+{
+	check(!Singleton);
+
+	Singleton = new FThreadStringScratch();
+}
+
+void FThreadStringScratch::Shutdown()
+{
+	if (Singleton)
+	{
+		delete Singleton;
+		Singleton = nullptr;
+	}
+}
+
+StringRef FThreadStringScratch::MakeStringRef(const FString& Str)
+{
+	StringRef Ref;
+	Ref.Chars = nullptr;
+	Ref.Length = Str.Len();
+	if ((Ref.Length > 0) && ensure(Singleton))
+	{
+		TArray<TCHAR>& Buffer = Singleton->GetThreadBuffer();
+		if ((Buffer.Max() > RetainedBufferSize) && (Ref.Length <= RetainedBufferSize))
+		{
+			Buffer.Empty(RetainedBufferSize);
+		}
+		Buffer.Reset(Ref.Length);
+		Buffer.AddUninitialized(Ref.Length);
+		FMemory::Memcpy(Buffer.GetData(), *Str, Ref.Length * sizeof(TCHAR));
+		Ref.Chars = Buffer.GetData();
+	}
+	else
+	{
+		Ref.Length = 0;
+	}
+	return Ref;
+}
+
+FThreadStringScratch::FThreadStringScratch()
+	: TlsSlot(FPlatformTLS::AllocTlsSlot())
+{
+}
+
+FThreadStringScratch::~FThreadStringScratch()
+{
+	FPlatformTLS::FreeTlsSlot(TlsSlot);
+	for (TArray<TCHAR>* Buffer : ThreadBuffers)
+	{
+		delete Buffer;
+	}
+}
+
+TArray<TCHAR>& FThreadStringScratch::GetThreadBuffer()
+{
+	auto Buffer = static_cast<TArray<TCHAR>*>(FPlatformTLS::GetTlsValue(TlsSlot));
+	if (!Buffer)
+	{
+		Buffer = new TArray<TCHAR>();
+		FPlatformTLS::SetTlsValue(TlsSlot, Buffer);
+
+		FScopeLock ScopeLock(&Lock);
+		ThreadBuffers.Add(Buffer);
+	}
+	return *Buffer;
+}
+
+} // namespace Klawr
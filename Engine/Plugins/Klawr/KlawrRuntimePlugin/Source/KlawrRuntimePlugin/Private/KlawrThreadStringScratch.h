@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrNativeUtils.h"
+
+namespace Klawr {
+
+/** 
+ * @brief Make a StringRef to the characters of an FString without copying them.
+ * @note The FString must not be modified or destroyed until managed code has finished reading 
+ *       the StringRef.
+ */
+inline StringRef MakeStringRef(const FString& Str)
+{
+	StringRef Ref;
+	Ref.Chars = Str.Len() ? *Str : nullptr;
+	Ref.Length = Str.Len();
+	return Ref;
+}
+
+/** 
+ * @brief Per-thread storage for strings returned to managed code.
+ *
+ * Strings that don't outlive the native function returning them (e.g. UFunction return values)
+ * are copied into a buffer owned by the calling thread, and a StringRef to the copy is returned 
+ * to managed code. Managed code converts the StringRef to a managed string before it makes any 
+ * other native call on that thread, so the copy only has to survive until the next string is 
+ * returned on the same thread, which reuses the buffer. Unlike MakeStringCopyForCLR() there is 
+ * no heap allocation (and corresponding free by the CLR) for every string returned, and nothing 
+ * depends on the engine ticking, or on what any other thread is doing.
+ */
+class FThreadStringScratch
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	/** 
+	 * Copy a string into the buffer of the calling thread, the copy will remain valid until the 
+	 * next call on the same thread.
+	 */
+	static StringRef MakeStringRef(const FString& Str);
+
+private:
+	FThreadStringScratch();
+	~FThreadStringScratch();
+
+	/** Get the buffer of the calling thread, it's created on first use. */
+	TArray<TCHAR>& GetThreadBuffer();
+
+private:
+	/** 
+	 * Number of characters a buffer can hold without being shrunk, buffers grown past this by 
+	 * an unusually long string are shrunk back by the next string that fits.
+	 */
+	static const int32 RetainedBufferSize = 16 * 1024;
+
+	/** TLS slot that stores a pointer to the buffer of each thread. */
+	uint32 TlsSlot;
+	/** The buffers of all the threads that returned strings, they're freed on shutdown. */
+	TArray<TArray<TCHAR>*> ThreadBuffers;
+	/** Guards ThreadBuffers, managed code may call into native code from any thread. */
+	FCriticalSection Lock;
+
+	static FThreadStringScratch* Singleton;
+};
+
+} // namespace Klawr
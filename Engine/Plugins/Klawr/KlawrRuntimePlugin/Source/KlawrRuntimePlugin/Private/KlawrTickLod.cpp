@@ -0,0 +1,320 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrTickLod.h"
+#include "KlawrScriptComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Klawr Tick LOD Update"), STAT_KlawrTickLodUpdate, STATGROUP_Game);
+
+namespace Klawr {
+	namespace TickLod {
+
+		static TAutoConsoleVariable<int32> CVarEnabled(
+			TEXT("klawr.TickLod"),
+			1,
+			TEXT("If zero, script components marked with TickLod always tick at full rate.")
+		);
+
+		static TAutoConsoleVariable<float> CVarRenderedTolerance(
+			TEXT("klawr.TickLod.RenderedTolerance"),
+			0.5f,
+			TEXT("Number of seconds since an actor was last rendered for it to still count as recently rendered.")
+		);
+
+		struct FEntry
+		{
+			UKlawrScriptComponent* Component;
+			// null unless the script component overrides SelectTickLod()
+			UpdateTickLodsAction UpdateAction;
+			__int64 InstanceID;
+			float NearDistanceSquared;
+			float FarDistanceSquared;
+			float ReducedInterval;
+			float MinimalInterval;
+			bool bSuspendWhenNotRendered;
+		};
+
+		static TMap<UWorld*, TArray<FEntry>> WorldEntries;
+		static bool bIsUpdating = false;
+		// SelectTickLod() may spawn or destroy script components, WorldEntries can't be modified
+		// while it's being iterated so any changes made during an update are applied afterwards
+		static TArray<FEntry> PendingRegistrations;
+		static TSet<UKlawrScriptComponent*> PendingRemovals;
+
+		// these are only kept around to avoid reallocating them every frame
+		static TArray<int32> Lods;
+		static TArray<float> Distances;
+		static TArray<uint8> Rendered;
+		static TArray<int32> CallbackEntries;
+		static TArray<__int64> CallbackInstanceIDs;
+		static TArray<float> CallbackDistances;
+		static TArray<uint8> CallbackRendered;
+		static TArray<int32> CallbackLods;
+
+		static float GetInterval(const FEntry& Entry, int32 Lod)
+		{
+			switch (static_cast<EScriptTickLod>(Lod))
+			{
+				case EScriptTickLod::Reduced:
+					return Entry.ReducedInterval;
+				case EScriptTickLod::Minimal:
+					return Entry.MinimalInterval;
+				default:
+					return 0.0f;
+			}
+		}
+
+		static bool IsPendingRemoval(const FEntry& Entry)
+		{
+			return PendingRemovals.Contains(Entry.Component);
+		}
+
+		static void RemoveEntry(UKlawrScriptComponent* Component)
+		{
+			UWorld* World = Component->GetWorld();
+			TArray<FEntry>* Entries = WorldEntries.Find(World);
+			if (!Entries)
+			{
+				return;
+			}
+
+			Entries->RemoveAllSwap(
+				[Component](const FEntry& Entry)
+				{
+					return Entry.Component == Component;
+				}
+			);
+			if (Entries->Num() == 0)
+			{
+				WorldEntries.Remove(World);
+			}
+		}
+
+		static void UpdateWorld(UWorld* World, TArray<FEntry>& Entries, bool bEnabled)
+		{
+			TArray<FVector, TInlineAllocator<4>> ViewLocations;
+			if (bEnabled)
+			{
+				for (auto It = World->GetPlayerControllerIterator(); It; ++It)
+				{
+					APlayerController* PlayerController = *It;
+					if (PlayerController)
+					{
+						FVector ViewLocation;
+						FRotator ViewRotation;
+						PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+						ViewLocations.Add(ViewLocation);
+					}
+				}
+			}
+
+			const float WorldTime = World->GetTimeSeconds();
+			const float RenderedTolerance = CVarRenderedTolerance.GetValueOnGameThread();
+			// a dedicated server never renders anything, so the last render time never advances
+			const bool bWorldRenders = 
+				!IsRunningDedicatedServer() && !World->IsNetMode(NM_DedicatedServer);
+			Lods.SetNumUninitialized(Entries.Num());
+			Distances.SetNumUninitialized(Entries.Num());
+			Rendered.SetNumUninitialized(Entries.Num());
+			CallbackEntries.Reset();
+
+			for (int32 i = 0; i < Entries.Num(); ++i)
+			{
+				const FEntry& Entry = Entries[i];
+				const AActor* Owner = Entry.Component->GetOwner();
+				// without any views there's nothing to be significant to, so tick at full rate
+				if (!Owner || (ViewLocations.Num() == 0))
+				{
+					Lods[i] = static_cast<int32>(EScriptTickLod::Full);
+					Distances[i] = 0.0f;
+					Rendered[i] = 1;
+					continue;
+				}
+
+				const FVector OwnerLocation = Owner->GetActorLocation();
+				float DistanceSquared = MAX_flt;
+				for (const FVector& ViewLocation : ViewLocations)
+				{
+					DistanceSquared = FMath::Min(
+						DistanceSquared, FVector::DistSquared(OwnerLocation, ViewLocation)
+					);
+				}
+				const bool bRecentlyRendered = !bWorldRenders ||
+					((WorldTime - Owner->GetLastRenderTime()) <= RenderedTolerance);
+
+				int32 Lod = static_cast<int32>(
+					(DistanceSquared <= Entry.NearDistanceSquared) ? EScriptTickLod::Full :
+					(DistanceSquared <= Entry.FarDistanceSquared) ? EScriptTickLod::Reduced :
+					EScriptTickLod::Minimal
+				);
+				if (!bRecentlyRendered)
+				{
+					Lod = Entry.bSuspendWhenNotRendered ? 
+						static_cast<int32>(EScriptTickLod::Suspended) :
+						FMath::Min(Lod + 1, static_cast<int32>(EScriptTickLod::Minimal));
+				}
+				Lods[i] = Lod;
+				Distances[i] = FMath::Sqrt(DistanceSquared);
+				Rendered[i] = bRecentlyRendered ? 1 : 0;
+			}
+
+			// let the script components that override SelectTickLod() adjust the selection, each
+			// app domain with components in this world (e.g. the editor and PIE app domains) has
+			// its own callback
+			TArray<UpdateTickLodsAction, TInlineAllocator<2>> UpdateActions;
+			for (const FEntry& Entry : Entries)
+			{
+				if (Entry.UpdateAction)
+				{
+					UpdateActions.AddUnique(Entry.UpdateAction);
+				}
+			}
+			for (UpdateTickLodsAction UpdateAction : UpdateActions)
+			{
+				CallbackEntries.Reset();
+				CallbackInstanceIDs.Reset();
+				CallbackDistances.Reset();
+				CallbackRendered.Reset();
+				CallbackLods.Reset();
+				for (int32 i = 0; i < Entries.Num(); ++i)
+				{
+					// an earlier callback may have destroyed the component
+					if ((Entries[i].UpdateAction == UpdateAction) && !IsPendingRemoval(Entries[i]))
+					{
+						CallbackEntries.Add(i);
+						CallbackInstanceIDs.Add(Entries[i].InstanceID);
+						CallbackDistances.Add(Distances[i]);
+						CallbackRendered.Add(Rendered[i]);
+						CallbackLods.Add(Lods[i]);
+					}
+				}
+				UpdateAction(
+					CallbackInstanceIDs.GetData(), CallbackDistances.GetData(), 
+					CallbackRendered.GetData(), CallbackLods.GetData(), CallbackEntries.Num()
+				);
+				for (int32 i = 0; i < CallbackEntries.Num(); ++i)
+				{
+					Lods[CallbackEntries[i]] = FMath::Clamp(
+						CallbackLods[i], 
+						static_cast<int32>(EScriptTickLod::Full), 
+						static_cast<int32>(EScriptTickLod::Suspended)
+					);
+				}
+			}
+
+			for (int32 i = 0; i < Entries.Num(); ++i)
+			{
+				if (!IsPendingRemoval(Entries[i]))
+				{
+					Entries[i].Component->SetTickLod(Lods[i], GetInterval(Entries[i], Lods[i]));
+				}
+			}
+		}
+
+	} // namespace TickLod
+
+	void FTickLod::Register(
+		UKlawrScriptComponent* Component, int AppDomainID, const ScriptComponentProxy& Proxy
+	)
+	{
+		check(IsInGameThread());
+
+		UWorld* World = Component->GetWorld();
+		check(World);
+
+		TickLod::FEntry Entry;
+		Entry.Component = Component;
+		Entry.UpdateAction = Proxy.SelectTickLod ? 
+			IClrHost::Get()->GetUpdateTickLodsAction(AppDomainID) : nullptr;
+		Entry.InstanceID = Proxy.InstanceID;
+		Entry.NearDistanceSquared = FMath::Square(Proxy.TickLodNearDistance);
+		Entry.FarDistanceSquared = FMath::Square(
+			FMath::Max(Proxy.TickLodNearDistance, Proxy.TickLodFarDistance)
+		);
+		Entry.ReducedInterval = FMath::Max(0.0f, Proxy.TickLodReducedInterval);
+		Entry.MinimalInterval = FMath::Max(Entry.ReducedInterval, Proxy.TickLodMinimalInterval);
+		Entry.bSuspendWhenNotRendered = !!Proxy.bSuspendTickWhenNotRendered;
+		if (TickLod::bIsUpdating)
+		{
+			TickLod::PendingRegistrations.Add(Entry);
+		}
+		else
+		{
+			TickLod::WorldEntries.FindOrAdd(World).Add(Entry);
+		}
+	}
+
+	void FTickLod::Unregister(UKlawrScriptComponent* Component)
+	{
+		check(IsInGameThread());
+
+		if (TickLod::bIsUpdating)
+		{
+			TickLod::PendingRegistrations.RemoveAllSwap(
+				[Component](const TickLod::FEntry& Entry)
+				{
+					return Entry.Component == Component;
+				}
+			);
+			TickLod::PendingRemovals.Add(Component);
+		}
+		else
+		{
+			TickLod::RemoveEntry(Component);
+		}
+	}
+
+	void FTickLod::Update()
+	{
+		check(IsInGameThread());
+
+		if (TickLod::WorldEntries.Num() == 0)
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_KlawrTickLodUpdate);
+
+		const bool bEnabled = TickLod::CVarEnabled.GetValueOnGameThread() != 0;
+		TickLod::bIsUpdating = true;
+		for (auto& WorldEntries : TickLod::WorldEntries)
+		{
+			TickLod::UpdateWorld(WorldEntries.Key, WorldEntries.Value, bEnabled);
+		}
+		TickLod::bIsUpdating = false;
+
+		for (UKlawrScriptComponent* Component : TickLod::PendingRemovals)
+		{
+			TickLod::RemoveEntry(Component);
+		}
+		TickLod::PendingRemovals.Reset();
+		for (const TickLod::FEntry& Entry : TickLod::PendingRegistrations)
+		{
+			TickLod::WorldEntries.FindOrAdd(Entry.Component->GetWorld()).Add(Entry);
+		}
+		TickLod::PendingRegistrations.Reset();
+	}
+
+} // namespace Klawr
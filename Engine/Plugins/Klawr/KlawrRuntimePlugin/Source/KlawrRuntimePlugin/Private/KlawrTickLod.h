@@ -0,0 +1,59 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+
+class UKlawrScriptComponent;
+
+namespace Klawr {
+
+/**
+ * @brief Selects how often script components marked with TickLodAttribute tick.
+ *
+ * Once per frame the tick LOD of every registered script component is selected in bulk based on
+ * the distance from the owner of the component to the nearest player view, and whether the owner
+ * was rendered within the last klawr.TickLod.RenderedTolerance seconds (on a dedicated server 
+ * every owner counts as rendered). Script components that override SelectTickLod() get to 
+ * adjust the selection, with one transition into managed code per app domain. Set klawr.TickLod
+ * to zero to tick all script components at full rate.
+ *
+ * Script components registered or unregistered while the selection is in progress (e.g. from
+ * SelectTickLod()) are only added or removed once it's done.
+ */
+class FTickLod
+{
+public:
+	/** Start selecting the tick LOD of the given script component. */
+	static void Register(
+		UKlawrScriptComponent* Component, int AppDomainID, const ScriptComponentProxy& Proxy
+	);
+	/** Stop selecting the tick LOD of the given script component. */
+	static void Unregister(UKlawrScriptComponent* Component);
+
+	/** Select the tick LODs of all registered script components, called once per frame. */
+	static void Update();
+};
+
+} // namespace Klawr
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrRuntimePluginPrivatePCH.h"
+#include "KlawrWorkQueue.h"
+#include "KlawrClrHost.h"
+
+DECLARE_STATS_GROUP(TEXT("Klawr Work Queue"), STATGROUP_KlawrWorkQueue, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Run Work Items"), STAT_KlawrWorkQueueRun, STATGROUP_KlawrWorkQueue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Carried Over Work Items"), STAT_KlawrWorkQueueCarriedOver, STATGROUP_KlawrWorkQueue);
+
+namespace Klawr {
+	namespace WorkQueue {
+
+		static TAutoConsoleVariable<float> CVarBudgetMs(
+			TEXT("klawr.WorkQueue.BudgetMs"),
+			2.0f,
+			TEXT("Milliseconds of game thread time work items queued by scripts can run for each frame.\n")
+			TEXT("At least one work item runs every frame regardless of the budget.")
+		);
+
+		static void LogStats()
+		{
+			IClrHost::Get()->LogWorkQueueStats();
+			// the stats are logged by managed code, so they have to be flushed to show up now
+			IClrHost::Get()->FlushLogs();
+		}
+
+		static FAutoConsoleCommand LogStatsCommand(
+			TEXT("klawr.WorkQueue.Stats"),
+			TEXT("Log queue depth and latency statistics for each category of work item queued by scripts."),
+			FConsoleCommandDelegate::CreateStatic(&LogStats)
+		);
+
+	} // namespace WorkQueue
+
+	void FWorkQueue::Tick()
+	{
+		check(IsInGameThread());
+
+		SCOPE_CYCLE_COUNTER(STAT_KlawrWorkQueueRun);
+
+		const double BudgetSeconds = 
+			FMath::Max(0.0f, WorkQueue::CVarBudgetMs.GetValueOnGameThread()) / 1000.0;
+		const int32 NumCarriedOver = IClrHost::Get()->RunWorkQueues(BudgetSeconds);
+		INC_DWORD_STAT_BY(STAT_KlawrWorkQueueCarriedOver, NumCarriedOver);
+	}
+
+} // namespace Klawr
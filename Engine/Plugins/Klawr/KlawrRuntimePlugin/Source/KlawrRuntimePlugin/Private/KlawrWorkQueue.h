@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+namespace Klawr {
+
+/**
+ * @brief Runs work items queued by scripts via Klawr.ClrHost.Managed.Threading.WorkQueue.
+ *
+ * Every frame the queued work items get klawr.WorkQueue.BudgetMs milliseconds of game thread
+ * time (shared by all engine app domains), work items that don't fit in the budget are carried 
+ * over to the next frame. The time spent and the number of work items carried over are shown in
+ * "stat KlawrWorkQueue", the klawr.WorkQueue.Stats console command logs queue depth and latency
+ * statistics for each category of work item.
+ */
+class FWorkQueue
+{
+public:
+	/** Called once per frame on the game thread. */
+	static void Tick();
+};
+
+} // namespace Klawr
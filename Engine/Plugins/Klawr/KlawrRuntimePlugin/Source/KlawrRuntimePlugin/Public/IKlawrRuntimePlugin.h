@@ -61,10 +61,33 @@ public:
 	virtual void SetPIEAppDomainID(int AppDomainID) = 0;
 	virtual bool ReloadPrimaryAppDomain() = 0;
 	virtual void GetScriptComponentTypes(TArray<FString>& Types) = 0;
+	/**
+	 * Write out the names of all the wrapper types and members used by the game scripts loaded in
+	 * the primary app domain, the code generator can then trim the wrappers down to those.
+	 * @return true if the file was written, false otherwise
+	 */
+	virtual bool WriteWrapperUsage(const FString& Filename) = 0;
 #endif // WITH_EDITOR
 
 	/**
 	 * Get the ID of the app domain in which the given object is referenced.
 	 */
 	virtual int GetObjectAppDomainID(const UObject* Object) const = 0;
+
+	/**
+	 * Attempt to prevent CLR garbage collections until EndNoGCRegion() is called, this is only 
+	 * meant to be used for short latency sensitive sections of gameplay.
+	 * @param TotalSize Number of bytes managed code can allocate before a collection is forced.
+	 * @return true if the no GC region was entered, false otherwise
+	 */
+	virtual bool TryStartNoGCRegion(int64 TotalSize) = 0;
+
+	/** Allow CLR garbage collections again after a successful call to TryStartNoGCRegion(). */
+	virtual void EndNoGCRegion() = 0;
+
+	/**
+	 * Perform a blocking collection of all CLR generations, this is already done after every map
+	 * load but may also be useful at other points where a long pause won't be noticed.
+	 */
+	virtual void CollectGarbage() = 0;
 };
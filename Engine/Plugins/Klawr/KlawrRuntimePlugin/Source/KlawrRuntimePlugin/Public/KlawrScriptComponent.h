@@ -30,6 +30,22 @@ namespace Klawr
 	struct ScriptComponentProxy;
 } // namespace Klawr
 
+/** 
+ * Rates script components tick at, selected by Klawr::FTickLod.
+ * Must be kept in sync with Klawr.ClrHost.Managed.TickLod.
+ */
+enum class EScriptTickLod : int32
+{
+	/** Tick at the script tick interval. */
+	Full,
+	/** Tick at the reduced interval specified by TickLodAttribute. */
+	Reduced,
+	/** Tick at the minimal interval specified by TickLodAttribute. */
+	Minimal,
+	/** Don't tick at all. */
+	Suspended
+};
+
 /**
  * A component whose functionality is implemented in C# or any other CLI language.
  */
@@ -63,11 +79,92 @@ public: // UActorComponent interface
 		float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction
 	) override;
 
+public:
+	/** 
+	 * Set the number of seconds between script ticks, zero to tick every frame.
+	 * @param Interval Seconds between script ticks.
+	 * @param bStagger If true the next script tick is delayed by a fraction of the interval that 
+	 *                 differs between components, so that components sharing the same interval 
+	 *                 don't all tick in the same frame.
+	 */
+	void SetScriptTickInterval(float Interval, bool bStagger);
+	
+	/** 
+	 * Set the tick group the script ticks in.
+	 * Components that tick concurrently are ticked by the concurrent tick function of this tick 
+	 * group instead.
+	 */
+	void SetScriptTickGroup(ETickingGroup TickGroup);
+
+	/** Stop ticking the script until Wake() is called. */
+	void Sleep();
+	/** Resume ticking a script that was put to sleep. */
+	void Wake();
+	
+	/** Check if the script was put to sleep. */
+	bool IsSleeping() const
+	{
+		return bIsSleeping;
+	}
+
+	/** 
+	 * Advance the script tick timer by the given frame delta time.
+	 * @param DeltaTime Seconds elapsed since the previous frame.
+	 * @param OutDeltaTime Set to the seconds elapsed since the previous script tick.
+	 * @return true if the script should be ticked this frame, false otherwise.
+	 */
+	bool ConsumeScriptTickTime(float DeltaTime, float& OutDeltaTime);
+
+	/** 
+	 * Set the current tick LOD, this is done by Klawr::FTickLod.
+	 * @param Lod One of the EScriptTickLod values.
+	 * @param Interval Minimum number of seconds between script ticks at the given tick LOD.
+	 */
+	void SetTickLod(int32 Lod, float Interval);
+
+	/** 
+	 * Get the address the current tick LOD is stored at, managed code reads the tick LOD 
+	 * directly from this address.
+	 */
+	const int32* GetTickLodAddress() const
+	{
+		return &TickLod;
+	}
+
 private:
 	void CreateScriptComponentProxy();
 	void DestroyScriptComponentProxy();
+	void UpdateTickEnabled();
+
+	float GetEffectiveScriptTickInterval() const
+	{
+		return FMath::Max(ScriptTickInterval, TickLodInterval);
+	}
+
+	bool IsTickLodSuspended() const
+	{
+		return TickLod == static_cast<int32>(EScriptTickLod::Suspended);
+	}
 
 private:
 	// a proxy that represents the managed counterpart of this script component
 	Klawr::ScriptComponentProxy* Proxy;
+	// seconds between script ticks, zero to tick every frame
+	float ScriptTickInterval;
+	// seconds left until the next script tick
+	float TimeUntilScriptTick;
+	// seconds elapsed since the previous script tick
+	float TimeSinceScriptTick;
+	// fraction of the tick interval the script ticks are offset by
+	float StaggerPhase;
+	// seconds between script ticks at the current tick LOD
+	float TickLodInterval;
+	// one of the EScriptTickLod values, stored as an int32 because managed code reads it directly
+	int32 TickLod;
+	// true if this component is ticked by Klawr::FParallelTick rather than PrimaryComponentTick
+	bool bTicksConcurrently;
+	// true if the script was put to sleep via Sleep()
+	bool bIsSleeping;
+	// true if this component is registered with Klawr::FTickLod
+	bool bUsesTickLod;
 };
@@ -0,0 +1,218 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+class UKlawrScriptComponent;
+
+/** The script profiler is compiled out of shipping builds. */
+#define KLAWR_SCRIPT_PROFILER !UE_BUILD_SHIPPING
+
+namespace Klawr {
+
+/** Calls into managed script components that are timed by the script profiler. */
+enum class EScriptProfileEvent : int32
+{
+	OnRegister,
+	OnUnregister,
+	InitializeComponent,
+	TickComponent,
+
+	Count
+};
+
+/** Counters gathered for one kind of call. */
+struct FScriptProfileCounters
+{
+	/** Number of calls. */
+	int64 Calls;
+	/** Inclusive time spent in the calls (in CPU cycles). */
+	uint64 Cycles;
+
+	FScriptProfileCounters()
+		: Calls(0)
+		, Cycles(0)
+	{
+	}
+
+	void Add(const FScriptProfileCounters& Other)
+	{
+		Calls += Other.Calls;
+		Cycles += Other.Cycles;
+	}
+
+	double GetMilliseconds() const
+	{
+		return Cycles * FPlatformTime::GetSecondsPerCycle() * 1000.0;
+	}
+};
+
+/** 
+ * Bytes allocated by managed code in the app domains of the profiled script components, sampled
+ * once per frame.
+ */
+struct FScriptProfileAllocations
+{
+	/** Number of frames sampled. */
+	int64 Frames;
+	/** Number of bytes allocated in all the sampled frames. */
+	int64 TotalBytes;
+	/** Largest number of bytes allocated in a single frame. */
+	int64 PeakFrameBytes;
+
+	FScriptProfileAllocations()
+		: Frames(0)
+		, TotalBytes(0)
+		, PeakFrameBytes(0)
+	{
+	}
+
+	double GetAverageFrameBytes() const
+	{
+		return (Frames > 0) ? (static_cast<double>(TotalBytes) / Frames) : 0.0;
+	}
+};
+
+/** Counters gathered for a script type, or a single script component instance. */
+struct FScriptProfileRecord
+{
+	/** Name of the script type, or the owner and name of the script component instance. */
+	FString Name;
+	/** Fully qualified name of the script type. */
+	FString TypeName;
+	/** Counters for each kind of call, indexed by EScriptProfileEvent. */
+	FScriptProfileCounters Events[(int32)EScriptProfileEvent::Count];
+
+	/** Get the sum of the counters for all kinds of calls. */
+	FScriptProfileCounters GetTotal() const
+	{
+		FScriptProfileCounters Total;
+		for (const FScriptProfileCounters& Counters : Events)
+		{
+			Total.Add(Counters);
+		}
+		return Total;
+	}
+};
+
+/**
+ * @brief Measures the time spent in (and the memory allocated by) managed script components.
+ *
+ * While the profiler is running every call from UKlawrScriptComponent into managed code is timed,
+ * and the results are aggregated for each script type (and optionally for each instance). 
+ * Concurrent ticks are timed per batch, with each batch containing a single script type. 
+ * When the profiler isn't running the only cost is a branch per call.
+ *
+ * Managed allocations are only reported per frame, for all the app domains that contain profiled
+ * script components. The CLR only updates the allocation count of an app domain when a thread 
+ * runs out of its allocation context (roughly every 8 KB), so a single call would almost always
+ * measure either 0 or 8 KB, while a frame's worth of allocations is off by at most 8 KB per 
+ * thread. The count includes everything allocated in the app domain, not just by script 
+ * components.
+ *
+ * The profiler is controlled with the klawr.ScriptProfiler console command, or the Script 
+ * Profiler panel in the editor.
+ */
+class KLAWRRUNTIMEPLUGIN_API FScriptProfiler
+{
+public:
+	/** 
+	 * Start gathering counters (without clearing the ones gathered so far).
+	 * @param bPerInstance If true counters are also gathered for each script component instance.
+	 */
+	static void Start(bool bPerInstance);
+	/** Stop gathering counters. */
+	static void Stop();
+	/** Clear all the counters gathered so far. */
+	static void Reset();
+
+	static bool IsRunning()
+	{
+		return bIsRunning;
+	}
+
+	static bool IsPerInstance()
+	{
+		return bIsPerInstance;
+	}
+
+	/** Get the number of seconds the profiler has been running for since the last reset. */
+	static double GetCapturedSeconds();
+	/** Get the counters gathered for each script type. */
+	static void GetTypeRecords(TArray<FScriptProfileRecord>& OutRecords);
+	/** Get the counters gathered for each script component instance. */
+	static void GetInstanceRecords(TArray<FScriptProfileRecord>& OutRecords);
+
+	/** Get the managed allocations sampled so far. */
+	static FScriptProfileAllocations GetAllocations();
+
+	/** Add the time spent ticking a batch of script components of the same class concurrently. */
+	static void RecordConcurrentTicks(UClass* ComponentClass, int32 NumComponents, uint64 Cycles);
+
+	/** Sample the managed allocations made this frame, called at the end of every frame. */
+	static void Tick();
+
+	/** Times a single call into a managed script component. */
+	class FScope
+	{
+	public:
+		FScope(UKlawrScriptComponent* InComponent, EScriptProfileEvent InEvent)
+			: Component(nullptr)
+		{
+			if (bIsRunning)
+			{
+				Begin(InComponent, InEvent);
+			}
+		}
+
+		~FScope()
+		{
+			if (Component)
+			{
+				End();
+			}
+		}
+
+	private:
+		KLAWRRUNTIMEPLUGIN_API void Begin(UKlawrScriptComponent* InComponent, EScriptProfileEvent InEvent);
+		KLAWRRUNTIMEPLUGIN_API void End();
+
+	private:
+		UKlawrScriptComponent* Component;
+		uint32 StartCycles;
+		EScriptProfileEvent Event;
+	};
+
+private:
+	static bool bIsRunning;
+	static bool bIsPerInstance;
+};
+
+} // namespace Klawr
+
+#if KLAWR_SCRIPT_PROFILER
+	#define KLAWR_SCOPE_SCRIPT_PROFILER(Component, Event) \
+		Klawr::FScriptProfiler::FScope ScriptProfilerScope(Component, Event)
+#else
+	#define KLAWR_SCOPE_SCRIPT_PROFILER(Component, Event)
+#endif // KLAWR_SCRIPT_PROFILER
@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+
+public class KlawrCodeGeneratorTest : ModuleRules
+{
+	public KlawrCodeGeneratorTest(TargetInfo Target)
+	{
+		PublicIncludePaths.Add("Runtime/Launch/Public");
+		// for LaunchEngineLoop.cpp
+		PrivateIncludePaths.Add("Runtime/Launch/Private");
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Projects",
+				"KlawrCodeGeneratorPlugin",
+			}
+		);
+	}
+}
@@ -0,0 +1,48 @@
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+public class KlawrCodeGeneratorTestTarget : TargetRules
+{
+	public KlawrCodeGeneratorTestTarget(TargetInfo Target)
+	{
+		Type = TargetType.Program;
+	}
+
+	public override void SetupBinaries(
+		TargetInfo Target,
+		ref List<UEBuildBinaryConfiguration> OutBuildBinaryConfigurations,
+		ref List<string> OutExtraModuleNames
+		)
+	{
+		OutBuildBinaryConfigurations.Add(
+			new UEBuildBinaryConfiguration(
+				InType: UEBuildBinaryType.Executable,
+				InModuleNames: new List<string>() { "KlawrCodeGeneratorTest" }
+			)
+		);
+	}
+
+	public override void SetupGlobalEnvironment(
+		TargetInfo Target,
+		ref LinkEnvironmentConfiguration OutLinkEnvironmentConfiguration,
+		ref CPPEnvironmentConfiguration OutCPPEnvironmentConfiguration
+		)
+	{
+		// the code generator plugin is normally only built into the header tool, so build it
+		// the same way the header tool does
+		UEBuildConfiguration.bCompileLeanAndMeanUE = true;
+		UEBuildConfiguration.bBuildEditor = false;
+		UEBuildConfiguration.bBuildWithEditorOnlyData = true;
+		UEBuildConfiguration.bCompileAgainstEngine = false;
+		UEBuildConfiguration.bCompileAgainstCoreUObject = true;
+		OutLinkEnvironmentConfiguration.bIsBuildingConsoleApplication = true;
+		OutCPPEnvironmentConfiguration.Definitions.Add("HACK_HEADER_GENERATOR=1");
+	}
+
+	public override bool ShouldCompileMonolithic(
+		UnrealTargetPlatform InPlatform, UnrealTargetConfiguration InConfiguration
+		)
+	{
+		return true;
+	}
+}
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "Core.h"
+#include "KlawrCodeGeneratorTest.h"
+#include "RequiredProgramMainCPPInclude.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogKlawrCodeGeneratorTest, Log, All);
+
+IMPLEMENT_APPLICATION(KlawrCodeGeneratorTest, "KlawrCodeGeneratorTest");
+
+/**
+ * Checks the Klawr wrapper generators against the golden files checked in with the code generator
+ * plugin, without running the header tool.
+ *
+ * -UpdateGolden regenerates the golden files instead of checking against them.
+ * -Benchmark measures how long the generators take to generate the wrappers for a synthetic API
+ *  instead, -Classes=<N> sets the number of classes in that API.
+ *
+ * The exit code is non-zero if the check failed.
+ */
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	GEngineLoop.PreInit(ArgC, ArgV);
+
+	int32 exitCode = 0;
+	const TCHAR* commandLine = FCommandLine::Get();
+	if (FParse::Param(commandLine, TEXT("Benchmark")))
+	{
+		int32 numClasses = Klawr::FCodeGeneratorTest::SyntheticClassCount;
+		FParse::Value(commandLine, TEXT("Classes="), numClasses);
+		Klawr::FCodeGeneratorTest::Benchmark(FMath::Max(numClasses, 1));
+	}
+	else if (!Klawr::FCodeGeneratorTest::Run(FParse::Param(commandLine, TEXT("UpdateGolden"))))
+	{
+		UE_LOG(LogKlawrCodeGeneratorTest, Error, TEXT("The code generator check failed."));
+		exitCode = 1;
+	}
+
+	GLog->Flush();
+	FEngineLoop::AppPreExit();
+	FModuleManager::Get().UnloadModulesAtShutdown();
+	FEngineLoop::AppExit();
+	return exitCode;
+}
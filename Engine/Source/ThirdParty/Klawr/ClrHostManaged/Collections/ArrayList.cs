@@ -69,6 +69,14 @@ namespace Klawr.ClrHost.Managed.Collections
             }
         }
 
+        /// <summary>
+        /// The wrapped UE TArray instance.
+        /// </summary>
+        internal INativeArray<T> NativeArray
+        {
+            get { return _nativeArray; }
+        }
+
         #endregion
 
         /// <summary>
@@ -83,6 +91,15 @@ namespace Klawr.ClrHost.Managed.Collections
 
         #region Methods
 
+        /// <summary>
+        /// Let enumerators know the list was modified by an operation implemented outside this
+        /// class (e.g. sorting the native array in place).
+        /// </summary>
+        internal void OnModified()
+        {
+            ++_modificationCount;
+        }
+
         public void Add(T item)
         {
             _nativeArray.Add(item);
@@ -159,6 +176,124 @@ namespace Klawr.ClrHost.Managed.Collections
             _nativeArray.RemoveAt(index);
         }
 
+        /// <summary>
+        /// Append the items in the given collection to the end of the list.
+        /// </summary>
+        /// <remarks>The underlying native array is grown only once regardless of how many items 
+        /// are appended. Items of plain-old-data types (e.g. int, float and FVector) are then 
+        /// copied in the same native call, but every other item (e.g. strings, names and objects)
+        /// still takes a native call of its own.</remarks>
+        public void AddRange(IEnumerable<T> collection)
+        {
+            if (collection == null)
+            {
+                throw new ArgumentNullException("collection");
+            }
+
+            _nativeArray.AddRange(GetRangeItems(collection));
+            ++_modificationCount;
+        }
+
+        /// <summary>
+        /// Insert the items in the given collection into the list at the given index.
+        /// </summary>
+        /// <remarks>See AddRange() for the cost of inserting items that aren't plain-old-data.
+        /// </remarks>
+        public void InsertRange(int index, IEnumerable<T> collection)
+        {
+            if (collection == null)
+            {
+                throw new ArgumentNullException("collection");
+            }
+
+            if ((index < 0) || (index > Count))
+            {
+                throw new ArgumentOutOfRangeException("index");
+            }
+
+            _nativeArray.InsertRange(GetRangeItems(collection), index);
+            ++_modificationCount;
+        }
+
+        /// <summary>
+        /// Get the items of a collection that's about to be added to this list.
+        /// </summary>
+        /// <remarks>When a list is added to itself, or to another list that wraps the same native
+        /// array, the native array grows before the items are copied, so the items are copied 
+        /// out of it first (just like List&lt;T&gt; does).</remarks>
+        private IList<T> GetRangeItems(IEnumerable<T> collection)
+        {
+            if ((collection == this) || SharesNativeArrayWith(collection as ArrayList<T>))
+            {
+                var items = new T[Count];
+                if (items.Length > 0)
+                {
+                    CopyTo(items, 0);
+                }
+                return items;
+            }
+            return collection as IList<T> ?? new List<T>(collection);
+        }
+
+        /// <summary>
+        /// Check if another list wraps the same (non-empty) native array as this one.
+        /// </summary>
+        private bool SharesNativeArrayWith(ArrayList<T> other)
+        {
+            if (other == null)
+            {
+                return false;
+            }
+            var nativeArray = _nativeArray as NativeArrayPropertyBase<T>;
+            var otherNativeArray = other._nativeArray as NativeArrayPropertyBase<T>;
+            if ((nativeArray == null) || (otherNativeArray == null))
+            {
+                return false;
+            }
+            // the storage of distinct arrays never overlaps, and an empty array has no items that
+            // could be overwritten while they're being copied
+            var dataPtr = otherNativeArray.GetDataPtr();
+            return (dataPtr != IntPtr.Zero) && (dataPtr == nativeArray.GetDataPtr());
+        }
+
+        /// <summary>
+        /// Remove a contiguous range of items from the list.
+        /// </summary>
+        public void RemoveRange(int index, int count)
+        {
+            if (index < 0)
+            {
+                throw new ArgumentOutOfRangeException("index");
+            }
+
+            if (count < 0)
+            {
+                throw new ArgumentOutOfRangeException("count");
+            }
+
+            if ((Count - index) < count)
+            {
+                throw new ArgumentException("index and count do not denote a valid range!");
+            }
+
+            ++_modificationCount;
+            _nativeArray.RemoveRange(index, count);
+        }
+
+        /// <summary>
+        /// Ensure the list can hold at least the given number of items without reallocating
+        /// the underlying native array.
+        /// </summary>
+        public void Reserve(int capacity)
+        {
+            if (capacity < 0)
+            {
+                throw new ArgumentOutOfRangeException("capacity");
+            }
+
+            _nativeArray.Reserve(capacity);
+        }
+
         IEnumerator IEnumerable.GetEnumerator()
         {
             return new Enumerator(this);
@@ -0,0 +1,177 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+using Klawr.UnrealEngine;
+using System;
+
+namespace Klawr.ClrHost.Managed.Collections
+{
+    /// <summary>
+    /// Bulk operations on lists that are backed by a native UE TArray.
+    /// </summary>
+    /// <remarks>Each operation is performed natively over the entire TArray in a single call,
+    /// this is much faster than enumerating the list (which requires a native call per item).
+    /// </remarks>
+    public static class ArrayListExtensions
+    {
+        public static Int64 Sum(this ArrayList<Int32> list)
+        {
+            return GetNativeArray<Int32, Int32ArrayProperty>(list).Sum();
+        }
+
+        public static Int32 Min(this ArrayList<Int32> list)
+        {
+            Int32 min, max;
+            if (!GetNativeArray<Int32, Int32ArrayProperty>(list).TryGetMinMax(out min, out max))
+            {
+                throw new InvalidOperationException("The list is empty!");
+            }
+            return min;
+        }
+
+        public static Int32 Max(this ArrayList<Int32> list)
+        {
+            Int32 min, max;
+            if (!GetNativeArray<Int32, Int32ArrayProperty>(list).TryGetMinMax(out min, out max))
+            {
+                throw new InvalidOperationException("The list is empty!");
+            }
+            return max;
+        }
+
+        public static void Sort(this ArrayList<Int32> list)
+        {
+            GetNativeArray<Int32, Int32ArrayProperty>(list).Sort();
+            list.OnModified();
+        }
+
+        public static int CountIf(
+            this ArrayList<Int32> list, ArrayComparison comparison, Int32 value
+        )
+        {
+            return GetNativeArray<Int32, Int32ArrayProperty>(list).CountIf(comparison, value);
+        }
+
+        public static float Sum(this ArrayList<float> list)
+        {
+            return GetNativeArray<float, FloatArrayProperty>(list).Sum();
+        }
+
+        public static float Min(this ArrayList<float> list)
+        {
+            float min, max;
+            if (!GetNativeArray<float, FloatArrayProperty>(list).TryGetMinMax(out min, out max))
+            {
+                throw new InvalidOperationException("The list is empty!");
+            }
+            return min;
+        }
+
+        public static float Max(this ArrayList<float> list)
+        {
+            float min, max;
+            if (!GetNativeArray<float, FloatArrayProperty>(list).TryGetMinMax(out min, out max))
+            {
+                throw new InvalidOperationException("The list is empty!");
+            }
+            return max;
+        }
+
+        public static void Sort(this ArrayList<float> list)
+        {
+            GetNativeArray<float, FloatArrayProperty>(list).Sort();
+            list.OnModified();
+        }
+
+        public static int CountIf(
+            this ArrayList<float> list, ArrayComparison comparison, float value
+        )
+        {
+            return GetNativeArray<float, FloatArrayProperty>(list).CountIf(comparison, value);
+        }
+
+        public static FVector Sum(this ArrayList<FVector> list)
+        {
+            return GetNativeArray<FVector, VectorArrayProperty>(list).Sum();
+        }
+
+        /// <summary>
+        /// Compute the component-wise bounds of all the vectors in the list.
+        /// </summary>
+        /// <returns>false if the list is empty, true otherwise.</returns>
+        public static bool TryGetBounds(
+            this ArrayList<FVector> list, out FVector min, out FVector max
+        )
+        {
+            var nativeArray = GetNativeArray<FVector, VectorArrayProperty>(list);
+            return nativeArray.TryGetBounds(out min, out max);
+        }
+
+        /// <summary>
+        /// Find the vector closest to the given point.
+        /// </summary>
+        /// <returns>Index of the closest vector, or -1 if the list is empty.</returns>
+        public static int FindNearest(this ArrayList<FVector> list, FVector point)
+        {
+            return GetNativeArray<FVector, VectorArrayProperty>(list).FindNearest(point);
+        }
+
+        /// <summary>
+        /// Enable or disable constant time lookups in a list of strings.
+        /// </summary>
+        /// <remarks>See StringArrayProperty.UseLookupIndex.</remarks>
+        public static void SetLookupIndexEnabled(this ArrayList<string> list, bool enabled)
+        {
+            GetNativeArray<string, StringArrayProperty>(list).UseLookupIndex = enabled;
+        }
+
+        /// <summary>
+        /// Enable or disable constant time lookups in a list of names.
+        /// </summary>
+        /// <remarks>See NameArrayProperty.UseLookupIndex.</remarks>
+        public static void SetLookupIndexEnabled(this ArrayList<FScriptName> list, bool enabled)
+        {
+            GetNativeArray<FScriptName, NameArrayProperty>(list).UseLookupIndex = enabled;
+        }
+
+        private static TNativeArray GetNativeArray<T, TNativeArray>(ArrayList<T> list)
+            where TNativeArray : class, INativeArray<T>
+        {
+            if (list == null)
+            {
+                throw new ArgumentNullException("list");
+            }
+
+            var nativeArray = list.NativeArray as TNativeArray;
+            if (nativeArray == null)
+            {
+                throw new NotSupportedException(
+                    "The list is not backed by a " + typeof(TNativeArray).Name
+                );
+            }
+            return nativeArray;
+        }
+    }
+}
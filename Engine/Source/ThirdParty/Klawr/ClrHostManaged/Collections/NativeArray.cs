@@ -25,6 +25,8 @@
 using Klawr.ClrHost.Managed.SafeHandles;
 using Klawr.UnrealEngine;
 using System;
+using System.Collections.Generic;
+using System.Linq;
 using System.Runtime.InteropServices;
 
 namespace Klawr.ClrHost.Managed.Collections
@@ -40,6 +42,11 @@ namespace Klawr.ClrHost.Managed.Collections
         void Insert(T item, int index);
         bool RemoveSingle(T item);
         void RemoveAt(int index);
+        void AddRange(IList<T> items);
+        void AddDefaulted(int count);
+        void InsertRange(IList<T> items, int index);
+        void RemoveRange(int index, int count);
+        void Reserve(int capacity);
     }
 
     /// <summary>
@@ -120,6 +127,134 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.RemoveAt(NativeArrayHandle, index);
         }
 
+        /// <summary>
+        /// Append a range of items to the end of the native array.
+        /// </summary>
+        public void AddRange(IList<T> items)
+        {
+            if (items.Count > 0)
+            {
+                AppendValues(items);
+            }
+        }
+
+        /// <summary>
+        /// Append the given number of default constructed items to the end of the native array.
+        /// </summary>
+        public void AddDefaulted(int count)
+        {
+            if (count > 0)
+            {
+                ArrayUtils.AddDefaulted(NativeArrayHandle, count);
+            }
+        }
+
+        /// <summary>
+        /// Insert a range of items into the native array at the given index.
+        /// </summary>
+        public void InsertRange(IList<T> items, int index)
+        {
+            if (items.Count > 0)
+            {
+                InsertValues(index, items);
+            }
+        }
+
+        public void RemoveRange(int index, int count)
+        {
+            if (count > 0)
+            {
+                ArrayUtils.RemoveRange(NativeArrayHandle, index, count);
+            }
+        }
+
+        /// <summary>
+        /// Ensure the native array has room for at least the given number of items, 
+        /// unlike Reset() this won't remove any existing items.
+        /// </summary>
+        public void Reserve(int capacity)
+        {
+            ArrayUtils.Reserve(NativeArrayHandle, capacity);
+        }
+
+        /// <summary>
+        /// Get the address of the first element of the native array.
+        /// </summary>
+        /// <returns>IntPtr.Zero if the array is empty, otherwise an address that's only shared
+        /// by wrappers of the same native array.</returns>
+        internal IntPtr GetDataPtr()
+        {
+            return (Num() > 0) ? ArrayUtils.GetRawPtr(NativeArrayHandle, 0) : IntPtr.Zero;
+        }
+
+        /// <summary>
+        /// Append a non-empty range of items to the end of the native array.
+        /// </summary>
+        /// <remarks>The default implementation appends default constructed items in a single
+        /// native call and then sets their values one by one, so for arrays of anything other
+        /// than plain-old-data (e.g. strings, names and objects) appending N items still takes
+        /// N + 1 native calls. Subclasses that wrap arrays of plain-old-data should override 
+        /// this to copy all the values in one go.</remarks>
+        protected virtual void AppendValues(IList<T> items)
+        {
+            var index = ArrayUtils.AddDefaulted(NativeArrayHandle, items.Count);
+            SetValues(index, items);
+        }
+
+        /// <summary>
+        /// Insert a non-empty range of items into the native array at the given index.
+        /// </summary>
+        /// <remarks>See AppendValues().</remarks>
+        protected virtual void InsertValues(int index, IList<T> items)
+        {
+            ArrayUtils.InsertDefaulted(NativeArrayHandle, index, items.Count);
+            SetValues(index, items);
+        }
+
+        private void SetValues(int index, IList<T> items)
+        {
+            for (int i = 0; i < items.Count; ++i)
+            {
+                SetValue(index + i, items[i]);
+            }
+        }
+
+        /// <summary>
+        /// Copy plain-old-data items to the end of the native array.
+        /// </summary>
+        protected void AppendRawValues<TRaw>(TRaw[] items) where TRaw : struct
+        {
+            var pinnedItems = GCHandle.Alloc(items, GCHandleType.Pinned);
+            try
+            {
+                ArrayUtils.AppendRaw(
+                    NativeArrayHandle, pinnedItems.AddrOfPinnedObject(), items.Length
+                );
+            }
+            finally
+            {
+                pinnedItems.Free();
+            }
+        }
+
+        /// <summary>
+        /// Copy plain-old-data items into the native array at the given index.
+        /// </summary>
+        protected void InsertRawValues<TRaw>(int index, TRaw[] items) where TRaw : struct
+        {
+            var pinnedItems = GCHandle.Alloc(items, GCHandleType.Pinned);
+            try
+            {
+                ArrayUtils.InsertRaw(
+                    NativeArrayHandle, index, pinnedItems.AddrOfPinnedObject(), items.Length
+                );
+            }
+            finally
+            {
+                pinnedItems.Free();
+            }
+        }
+
         /// <summary>
         /// Dispose of any unmanaged (and managed) resources.
         /// </summary>
@@ -164,6 +299,16 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.SetUInt8At(NativeArrayHandle, index, Convert.ToByte(item));
         }
 
+        protected override void AppendValues(IList<bool> items)
+        {
+            AppendRawValues(items.Select(item => Convert.ToByte(item)).ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<bool> items)
+        {
+            InsertRawValues(index, items.Select(item => Convert.ToByte(item)).ToArray());
+        }
+
         public override int Find(bool item)
         {
             return ArrayUtils.FindUInt8(NativeArrayHandle, Convert.ToByte(item));
@@ -191,6 +336,16 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.SetUInt8At(NativeArrayHandle, index, item);
         }
 
+        protected override void AppendValues(IList<byte> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<byte> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
         public override int Find(byte item)
         {
             return ArrayUtils.FindUInt8(NativeArrayHandle, item);
@@ -218,6 +373,16 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.SetInt16At(NativeArrayHandle, index, item);
         }
 
+        protected override void AppendValues(IList<Int16> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<Int16> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
         public override int Find(Int16 item)
         {
             return ArrayUtils.FindInt16(NativeArrayHandle, item);
@@ -245,10 +410,54 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.SetInt32At(NativeArrayHandle, index, item);
         }
 
+        protected override void AppendValues(IList<Int32> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<Int32> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
         public override int Find(Int32 item)
         {
             return ArrayUtils.FindInt32(NativeArrayHandle, item);
         }
+
+        /// <summary>
+        /// Compute the sum of all the items in the array (natively, in a single call).
+        /// </summary>
+        /// <returns>64-bit sum of all the items, so it can't overflow.</returns>
+        public Int64 Sum()
+        {
+            return ArrayUtils.SumInt32(NativeArrayHandle);
+        }
+
+        /// <summary>
+        /// Find the smallest and largest items in the array (natively, in a single call).
+        /// </summary>
+        /// <returns>false if the array is empty, true otherwise.</returns>
+        public bool TryGetMinMax(out Int32 min, out Int32 max)
+        {
+            return ArrayUtils.MinMaxInt32(NativeArrayHandle, out min, out max);
+        }
+
+        /// <summary>
+        /// Sort the items in the array in ascending order.
+        /// </summary>
+        public void Sort()
+        {
+            ArrayUtils.SortInt32(NativeArrayHandle);
+        }
+
+        /// <summary>
+        /// Count the items for which (item comparison value) is true.
+        /// </summary>
+        public int CountIf(ArrayComparison comparison, Int32 value)
+        {
+            return ArrayUtils.CountInt32(NativeArrayHandle, comparison, value);
+        }
     }
 
     /// <summary>
@@ -272,18 +481,171 @@ namespace Klawr.ClrHost.Managed.Collections
             ArrayUtils.SetInt64At(NativeArrayHandle, index, item);
         }
 
+        protected override void AppendValues(IList<Int64> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<Int64> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
         public override int Find(Int64 item)
         {
             return ArrayUtils.FindInt64(NativeArrayHandle, item);
         }
     }
 
+    /// <summary>
+    /// A wrapper for a native UE <![CDATA[ TArray<float> ]]> that is a member of a native UObject 
+    /// derived class.
+    /// </summary>
+    public class FloatArrayProperty : NativeArrayPropertyBase<float>
+    {
+        // reused by GetValue() to avoid allocating a new buffer for every read
+        private readonly float[] _valueBuffer = new float[1];
+
+        public FloatArrayProperty(UObjectHandle objectHandle, ArrayHandle arrayHandle)
+            : base(objectHandle, arrayHandle)
+        {
+        }
+
+        protected override float GetValue(int index)
+        {
+            Marshal.Copy(ArrayUtils.GetRawPtr(NativeArrayHandle, index), _valueBuffer, 0, 1);
+            return _valueBuffer[0];
+        }
+
+        protected override void SetValue(int index, float item)
+        {
+            ArrayUtils.SetFloatAt(NativeArrayHandle, index, item);
+        }
+
+        protected override void AppendValues(IList<float> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<float> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
+        public override int Find(float item)
+        {
+            return ArrayUtils.FindFloat(NativeArrayHandle, item);
+        }
+
+        /// <summary>
+        /// Compute the sum of all the items in the array (natively, in a single call).
+        /// </summary>
+        /// <remarks>The items are not summed in order so the result may differ slightly from
+        /// a sequential sum due to rounding.</remarks>
+        public float Sum()
+        {
+            return ArrayUtils.SumFloat(NativeArrayHandle);
+        }
+
+        /// <summary>
+        /// Find the smallest and largest items in the array (natively, in a single call).
+        /// </summary>
+        /// <returns>false if the array is empty, true otherwise.</returns>
+        public bool TryGetMinMax(out float min, out float max)
+        {
+            return ArrayUtils.MinMaxFloat(NativeArrayHandle, out min, out max);
+        }
+
+        /// <summary>
+        /// Sort the items in the array in ascending order.
+        /// </summary>
+        public void Sort()
+        {
+            ArrayUtils.SortFloat(NativeArrayHandle);
+        }
+
+        /// <summary>
+        /// Count the items for which (item comparison value) is true.
+        /// </summary>
+        public int CountIf(ArrayComparison comparison, float value)
+        {
+            return ArrayUtils.CountFloat(NativeArrayHandle, comparison, value);
+        }
+    }
+
+    /// <summary>
+    /// A wrapper for a native UE <![CDATA[ TArray<FVector> ]]> that is a member of a native 
+    /// UObject derived class.
+    /// </summary>
+    public class VectorArrayProperty : NativeArrayPropertyBase<FVector>
+    {
+        public VectorArrayProperty(UObjectHandle objectHandle, ArrayHandle arrayHandle)
+            : base(objectHandle, arrayHandle)
+        {
+        }
+
+        protected override FVector GetValue(int index)
+        {
+            return (FVector)Marshal.PtrToStructure(
+                ArrayUtils.GetRawPtr(NativeArrayHandle, index), typeof(FVector)
+            );
+        }
+
+        protected override void SetValue(int index, FVector item)
+        {
+            ArrayUtils.SetVectorAt(NativeArrayHandle, index, item);
+        }
+
+        protected override void AppendValues(IList<FVector> items)
+        {
+            AppendRawValues(items.ToArray());
+        }
+
+        protected override void InsertValues(int index, IList<FVector> items)
+        {
+            InsertRawValues(index, items.ToArray());
+        }
+
+        public override int Find(FVector item)
+        {
+            return ArrayUtils.FindVector(NativeArrayHandle, item);
+        }
+
+        /// <summary>
+        /// Compute the sum of all the vectors in the array (natively, in a single call).
+        /// </summary>
+        public FVector Sum()
+        {
+            return ArrayUtils.SumVector(NativeArrayHandle);
+        }
+
+        /// <summary>
+        /// Compute the component-wise bounds of all the vectors in the array.
+        /// </summary>
+        /// <returns>false if the array is empty, true otherwise.</returns>
+        public bool TryGetBounds(out FVector min, out FVector max)
+        {
+            return ArrayUtils.MinMaxVector(NativeArrayHandle, out min, out max);
+        }
+
+        /// <summary>
+        /// Find the vector closest to the given point.
+        /// </summary>
+        /// <returns>Index of the closest vector, or -1 if the array is empty.</returns>
+        public int FindNearest(FVector point)
+        {
+            return ArrayUtils.FindNearestVector(NativeArrayHandle, point);
+        }
+    }
+
     /// <summary>
     /// A wrapper for a native UE <![CDATA[ TArray<FString> ]]> that is a member of a native
     /// UObject derived class.
     /// </summary>
     public class StringArrayProperty : NativeArrayPropertyBase<string>
     {
+        private bool _useLookupIndex = false;
+
         public StringArrayProperty(UObjectHandle objectHandle, ArrayHandle arrayHandle)
             : base(objectHandle, arrayHandle)
         {
@@ -303,6 +665,31 @@ namespace Klawr.ClrHost.Managed.Collections
         {
             return ArrayUtils.FindString(NativeArrayHandle, item);
         }
+
+        /// <summary>
+        /// Enable or disable a hashed index of the items in the native array.
+        /// </summary>
+        /// <remarks>
+        /// While the index is enabled Find(), Contains() and RemoveSingle() look up items in 
+        /// constant time without any allocations. The index is rebuilt lazily by the first lookup
+        /// after the array is modified, so it's only worth enabling for arrays that are searched
+        /// much more often than they are modified (e.g. sets of tags). Modifications made through
+        /// any wrapper of the native array are tracked, but if native code overwrites items in
+        /// place InvalidateLookupIndex() must be called before the next lookup.
+        /// </remarks>
+        public bool UseLookupIndex
+        {
+            get { return _useLookupIndex; }
+            set { _useLookupIndex = ArrayUtils.SetLookupIndexEnabled(NativeArrayHandle, value); }
+        }
+
+        /// <summary>
+        /// Let the lookup index know that native code has overwritten items in place.
+        /// </summary>
+        public void InvalidateLookupIndex()
+        {
+            ArrayUtils.InvalidateLookupIndex(NativeArrayHandle);
+        }
     }
 
     /// <summary>
@@ -311,6 +698,8 @@ namespace Klawr.ClrHost.Managed.Collections
     /// </summary>
     public class NameArrayProperty : NativeArrayPropertyBase<FScriptName>
     {
+        private bool _useLookupIndex = false;
+
         public NameArrayProperty(UObjectHandle objectHandle, ArrayHandle arrayHandle)
             : base(objectHandle, arrayHandle)
         {
@@ -330,6 +719,31 @@ namespace Klawr.ClrHost.Managed.Collections
         {
             return ArrayUtils.FindName(NativeArrayHandle, item);
         }
+
+        /// <summary>
+        /// Enable or disable a hashed index of the items in the native array.
+        /// </summary>
+        /// <remarks>
+        /// While the index is enabled Find(), Contains() and RemoveSingle() look up items in 
+        /// constant time without any allocations. The index is rebuilt lazily by the first lookup
+        /// after the array is modified, so it's only worth enabling for arrays that are searched
+        /// much more often than they are modified (e.g. sets of tags). Modifications made through
+        /// any wrapper of the native array are tracked, but if native code overwrites items in
+        /// place InvalidateLookupIndex() must be called before the next lookup.
+        /// </remarks>
+        public bool UseLookupIndex
+        {
+            get { return _useLookupIndex; }
+            set { _useLookupIndex = ArrayUtils.SetLookupIndexEnabled(NativeArrayHandle, value); }
+        }
+
+        /// <summary>
+        /// Let the lookup index know that native code has overwritten items in place.
+        /// </summary>
+        public void InvalidateLookupIndex()
+        {
+            ArrayUtils.InvalidateLookupIndex(NativeArrayHandle);
+        }
     }
 
     /// <summary>
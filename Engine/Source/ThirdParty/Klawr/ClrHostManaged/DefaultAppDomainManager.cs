@@ -26,6 +26,7 @@ using Klawr.ClrHost.Interfaces;
 using System;
 using System.Collections.Generic;
 using System.IO;
+using System.Runtime;
 
 namespace Klawr.ClrHost.Managed
 {
@@ -125,5 +126,25 @@ namespace Klawr.ClrHost.Managed
             }
             _engineAppDomains.Clear();
         }
+
+        public bool SetGCLatencyMode(int latencyMode)
+        {
+            return GarbageCollection.SetLatencyMode((GCLatencyMode)latencyMode);
+        }
+
+        public void CollectGarbage(int generation, bool blocking)
+        {
+            GarbageCollection.Collect(generation, blocking);
+        }
+
+        public bool TryStartNoGCRegion(long totalSize)
+        {
+            return GarbageCollection.TryStartNoGCRegion(totalSize);
+        }
+
+        public void EndNoGCRegion()
+        {
+            GarbageCollection.EndNoGCRegion();
+        }
     }
 }
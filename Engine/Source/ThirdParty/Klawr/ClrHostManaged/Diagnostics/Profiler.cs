@@ -0,0 +1,278 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace Klawr.ClrHost.Managed.Diagnostics
+{
+    /// <summary>
+    /// Lets scripts mark regions of their own code that should show up in the engine profiler.
+    /// </summary>
+    /// <remarks>
+    /// Opening and closing a scope only writes a scope ID and a timestamp to a buffer owned by
+    /// the current thread, the buffer is handed to the engine after each script component tick
+    /// and at the end of each frame, at which point the scopes are re-emitted as cycle stats in 
+    /// the "Klawr Scripts" stats group, nested under whatever the engine was doing when the 
+    /// script code was called (e.g. the tick of the owning script component).
+    /// 
+    /// Scope names are interned to integer IDs the first time they're used, to avoid even the 
+    /// name lookup in hot code get the ID once with GetScopeId() and open scopes with that.
+    /// 
+    /// Scopes are only recorded while the engine is collecting stats, and only scopes opened on 
+    /// the game thread or in concurrently ticked script components are reported, a scope must be
+    /// closed on the same thread and in the same frame it was opened (so it mustn't span an 
+    /// await), otherwise it's discarded. Scopes recorded on any other thread (e.g. by thread pool
+    /// work) are never handed to the engine, they're dropped the next time that thread opens or 
+    /// closes a scope in a later frame.
+    /// </remarks>
+    /// <example>
+    /// private static readonly int PathingScopeId = Profiler.GetScopeId("Pathing");
+    /// 
+    /// using (Profiler.Scope(PathingScopeId))
+    /// {
+    ///     UpdatePath();
+    /// }
+    /// </example>
+    public class Profiler
+    {
+        /// <summary>
+        /// Scope events recorded on a single thread, waiting to be handed to the engine.
+        /// </summary>
+        internal sealed class ThreadBuffer
+        {
+            // hard limit on the number of events buffered between flushes, anything recorded 
+            // past this point is dropped
+            private const int MaxEvents = 64 * 1024;
+            private const int InitialCapacity = 256;
+
+            // scope IDs of begin events, and the complement (~) of scope IDs of end events
+            private int[] _scopeEvents = new int[InitialCapacity];
+            private long[] _timestamps = new long[InitialCapacity];
+            private int _count;
+            // number of begin events dropped since the buffer filled up whose end events must 
+            // be dropped too to keep the events balanced
+            private int _droppedDepth;
+            // the frame the buffered events were recorded in
+            private int _frame;
+            // the buffer only grows past its initial capacity once it's known to be flushed, so
+            // threads that are never flushed don't hold on to large buffers
+            private bool _hasBeenFlushed;
+
+            public void Begin(int scopeId)
+            {
+                DropStaleEvents();
+                if (Reserve())
+                {
+                    _scopeEvents[_count] = scopeId;
+                    _timestamps[_count++] = Stopwatch.GetTimestamp();
+                }
+                else
+                {
+                    ++_droppedDepth;
+                }
+            }
+
+            public void End(int scopeId)
+            {
+                DropStaleEvents();
+                if (_droppedDepth > 0)
+                {
+                    --_droppedDepth;
+                }
+                else if (Reserve())
+                {
+                    _scopeEvents[_count] = ~scopeId;
+                    _timestamps[_count++] = Stopwatch.GetTimestamp();
+                }
+            }
+
+            /// <summary>
+            /// Hand all the buffered events to the engine.
+            /// </summary>
+            /// <returns>true if the engine is still collecting stats.</returns>
+            public bool Flush()
+            {
+                var scopeEvents = GCHandle.Alloc(_scopeEvents, GCHandleType.Pinned);
+                var timestamps = GCHandle.Alloc(_timestamps, GCHandleType.Pinned);
+                try
+                {
+                    return _proxy.EmitScopes(
+                        scopeEvents.AddrOfPinnedObject(), timestamps.AddrOfPinnedObject(), _count
+                    );
+                }
+                finally
+                {
+                    timestamps.Free();
+                    scopeEvents.Free();
+                    _count = 0;
+                    _droppedDepth = 0;
+                    _hasBeenFlushed = true;
+                }
+            }
+
+            public int Count
+            {
+                get { return _count; }
+            }
+
+            /// <summary>
+            /// Drop the buffered events if they weren't flushed by the end of the frame they were
+            /// recorded in, which means they were recorded on a thread that's never flushed.
+            /// </summary>
+            private void DropStaleEvents()
+            {
+                var frame = _currentFrame;
+                if (_frame != frame)
+                {
+                    _frame = frame;
+                    _count = 0;
+                    _droppedDepth = 0;
+                }
+            }
+
+            private bool Reserve()
+            {
+                if (_count == _scopeEvents.Length)
+                {
+                    if ((_count == MaxEvents) || !_hasBeenFlushed)
+                    {
+                        return false;
+                    }
+                    Array.Resize(ref _scopeEvents, _count * 2);
+                    Array.Resize(ref _timestamps, _count * 2);
+                }
+                return true;
+            }
+        }
+
+        private static ProfilerUtilsProxy _proxy;
+        // name -> ID of every scope opened so far
+        private static readonly ConcurrentDictionary<string, int> _scopeIds = 
+            new ConcurrentDictionary<string, int>();
+        private static readonly Func<string, int> _registerScope = RegisterScope;
+        // updated by FlushFrame() to reflect whether the engine is collecting stats
+        private static volatile bool _isEnabled;
+        // incremented by FlushFrame() at the end of each frame
+        private static volatile int _currentFrame;
+        [ThreadStatic]
+        private static ThreadBuffer _threadBuffer;
+
+        internal Profiler(ref ProfilerUtilsProxy proxy)
+        {
+            _proxy = proxy;
+        }
+
+        /// <summary>
+        /// Check if scopes are currently being recorded.
+        /// </summary>
+        public static bool IsEnabled
+        {
+            get { return _isEnabled; }
+        }
+
+        /// <summary>
+        /// Get the ID of the scope with the given name, registering the name with the engine if
+        /// it hasn't been seen before.
+        /// </summary>
+        public static int GetScopeId(string name)
+        {
+            if (name == null)
+            {
+                throw new ArgumentNullException("name");
+            }
+            return _scopeIds.GetOrAdd(name, _registerScope);
+        }
+
+        /// <summary>
+        /// Open a profiling scope, the scope will be closed when the return value is disposed.
+        /// </summary>
+        /// <param name="name">Name the scope will be displayed under in the engine profiler.</param>
+        public static ProfilerScope Scope(string name)
+        {
+            if (!_isEnabled)
+            {
+                return default(ProfilerScope);
+            }
+            return Scope(GetScopeId(name));
+        }
+
+        /// <summary>
+        /// Open a profiling scope, the scope will be closed when the return value is disposed.
+        /// </summary>
+        /// <param name="scopeId">ID previously obtained from GetScopeId().</param>
+        public static ProfilerScope Scope(int scopeId)
+        {
+            if (!_isEnabled)
+            {
+                return default(ProfilerScope);
+            }
+            var buffer = _threadBuffer;
+            if (buffer == null)
+            {
+                buffer = new ThreadBuffer();
+                _threadBuffer = buffer;
+            }
+            buffer.Begin(scopeId);
+            return new ProfilerScope(buffer, scopeId);
+        }
+
+        /// <summary>
+        /// Hand any scopes recorded on the current thread to the engine, this is called after each 
+        /// script component tick (but only while the engine is collecting stats).
+        /// </summary>
+        internal static void Flush()
+        {
+            var buffer = _threadBuffer;
+            if ((buffer != null) && (buffer.Count > 0))
+            {
+                buffer.Flush();
+            }
+        }
+
+        /// <summary>
+        /// Hand any scopes recorded on the game thread to the engine, and find out if the engine 
+        /// is still collecting stats, this is called on the game thread at the end of each frame.
+        /// </summary>
+        internal static void FlushFrame()
+        {
+            var buffer = _threadBuffer;
+            if (buffer == null)
+            {
+                buffer = new ThreadBuffer();
+                _threadBuffer = buffer;
+            }
+            _isEnabled = buffer.Flush();
+            // any events still buffered on other threads will never be flushed
+            _currentFrame = _currentFrame + 1;
+        }
+
+        private static int RegisterScope(string name)
+        {
+            return _proxy.RegisterScope(name);
+        }
+    }
+}
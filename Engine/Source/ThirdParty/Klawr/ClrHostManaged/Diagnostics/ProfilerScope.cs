@@ -0,0 +1,56 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+
+namespace Klawr.ClrHost.Managed.Diagnostics
+{
+    /// <summary>
+    /// A region of code that's being profiled, the region ends when the scope is disposed.
+    /// </summary>
+    /// <remarks>
+    /// This is a struct so that opening a scope doesn't allocate, it should only ever be used in
+    /// a using statement (which won't box it).
+    /// </remarks>
+    public struct ProfilerScope : IDisposable
+    {
+        private readonly Profiler.ThreadBuffer _buffer;
+        private readonly int _scopeId;
+
+        internal ProfilerScope(Profiler.ThreadBuffer buffer, int scopeId)
+        {
+            _buffer = buffer;
+            _scopeId = scopeId;
+        }
+
+        public void Dispose()
+        {
+            // the buffer is null if the profiler wasn't enabled when the scope was opened
+            if (_buffer != null)
+            {
+                _buffer.End(_scopeId);
+            }
+        }
+    }
+}
@@ -23,12 +23,15 @@
 //
 
 using Klawr.ClrHost.Interfaces;
+using Klawr.ClrHost.Managed.Diagnostics;
 using Klawr.ClrHost.Managed.SafeHandles;
+using Klawr.ClrHost.Managed.Threading;
 using System;
 using System.Collections.Generic;
 using System.Linq;
 using System.Linq.Expressions;
 using System.Reflection;
+using System.Runtime.InteropServices;
 using System.Threading;
 
 namespace Klawr.ClrHost.Managed
@@ -73,14 +76,34 @@ namespace Klawr.ClrHost.Managed
         {
             public ConstructorInfo Constructor;
             public ScriptComponentMethodInfo[] Methods;
+            public bool CanTickConcurrently;
+            public TickSettingsAttribute TickSettings;
+            public TickLodAttribute TickLod;
         }
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void TickScriptComponentsAction(IntPtr instanceIDs, IntPtr deltaTimes, int count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void UpdateTickLodsAction(
+            IntPtr instanceIDs, IntPtr viewDistances, IntPtr recentlyRendered, IntPtr tickLods, int count
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate long GetAllocatedBytesFunc();
+
         // only set for the engine app domain manager
         private Dictionary<string /*Native Class*/, IntPtr[]> _nativeFunctionPointers = new Dictionary<string, IntPtr[]>();
         // all currently registered script objects
         private Dictionary<long /*Instance ID*/, ScriptObjectInfo> _scriptObjects = new Dictionary<long, ScriptObjectInfo>();
         // identifier of the most recently registered ScriptObject instance
         private long _lastScriptObjectID = 0;
+        // the core wrapper assembly, which lists all the other wrapper assemblies
+        private Assembly _wrapperAssembly;
+        // set once all the other wrapper assemblies have been loaded
+        private bool _allWrapperAssembliesLoaded = false;
+        // only set in packaged games whose wrappers were trimmed down to what the scripts use
+        private TrimmedWrappersAttribute _trimmedWrappers;
         // cache of previously created script object types
         private Dictionary<string /*Full Type Name*/, Type> _scriptObjectTypeCache = new Dictionary<string, Type>();
 
@@ -89,6 +112,17 @@ namespace Klawr.ClrHost.Managed
         private Dictionary<long /*Instance ID*/, ScriptComponentInfo> _scriptComponents = new Dictionary<long, ScriptComponentInfo>();
         // cache of previously created script component types
         private Dictionary<string /*Full Type Name*/, ScriptComponentTypeInfo> _scriptComponentTypeCache = new Dictionary<string, ScriptComponentTypeInfo>();
+        // native code calls this to tick batches of script components, it's stored here so that the
+        // corresponding function pointer remains valid for the lifetime of the app domain
+        private TickScriptComponentsAction _tickScriptComponents;
+        // native code calls this to select the tick LODs of batches of script components
+        private UpdateTickLodsAction _updateTickLods;
+        // native code calls this to measure how much script components allocate
+        private GetAllocatedBytesFunc _getAllocatedBytes;
+        // native code calls this after ticking a script component to collect profiling scopes,
+        // the same delegate instance is shared by all script component proxies
+        private readonly ScriptComponentProxy.FlushProfilerScopesAction _flushProfilerScopes =
+            Profiler.Flush;
 
         // NOTE: the base implementation of this method does nothing, so no need to call it
         public override void InitializeNewDomain(AppDomainSetup appDomainInfo)
@@ -112,7 +146,16 @@ namespace Klawr.ClrHost.Managed
 
         public IntPtr[] GetNativeFunctionPointers(string nativeClassName)
         {
-            return _nativeFunctionPointers[nativeClassName];
+            IntPtr[] functionPointers;
+            if (!_nativeFunctionPointers.TryGetValue(nativeClassName, out functionPointers))
+            {
+                throw new InvalidOperationException(String.Format(
+                    "No native wrapper functions were registered for {0}{1}.", nativeClassName,
+                    (_trimmedWrappers != null) ? 
+                        ", the wrappers were trimmed to " + _trimmedWrappers.UsageFilename : ""
+                ));
+            }
+            return functionPointers;
         }
 
         public void LoadUnrealEngineWrapperAssembly()
@@ -122,7 +165,81 @@ namespace Klawr.ClrHost.Managed
 
             var wrapperAssembly = new AssemblyName();
             wrapperAssembly.Name = "Klawr.UnrealEngine";
-            Assembly.Load(wrapperAssembly);
+            // the wrappers of other modules are loaded on demand, see LoadWrapperAssemblies()
+            _wrapperAssembly = Assembly.Load(wrapperAssembly);
+            _trimmedWrappers = _wrapperAssembly.GetCustomAttribute<TrimmedWrappersAttribute>();
+        }
+
+        /// <summary>
+        /// Load all the wrapper assemblies listed by the core Klawr.UnrealEngine assembly that 
+        /// haven't been loaded yet.
+        /// </summary>
+        /// <remarks>
+        /// Wrapper assemblies referenced by script assemblies are loaded by the CLR as soon as
+        /// they're needed, this is only necessary when looking up wrapper types by name.
+        /// </remarks>
+        /// <returns>true if any wrapper assemblies were loaded, false otherwise</returns>
+        private bool LoadWrapperAssemblies()
+        {
+            if ((_wrapperAssembly == null) || _allWrapperAssembliesLoaded)
+            {
+                return false;
+            }
+            _allWrapperAssembliesLoaded = true;
+
+            var loadedAssemblyNames = new HashSet<string>(
+                AppDomain.CurrentDomain.GetAssemblies().Select(assembly => assembly.GetName().Name)
+            );
+            bool loadedAny = false;
+            foreach (var attribute in _wrapperAssembly.GetCustomAttributes<WrapperAssemblyAttribute>())
+            {
+                if (!loadedAssemblyNames.Contains(attribute.AssemblyName))
+                {
+                    loadedAny |= LoadAssembly(attribute.AssemblyName);
+                }
+            }
+            return loadedAny;
+        }
+
+        public bool WriteWrapperUsage(string assemblyName, string outputFilename)
+        {
+            try
+            {
+                var assembly = AppDomain.CurrentDomain.GetAssemblies()
+                    .FirstOrDefault(a => a.GetName().Name.Equals(assemblyName));
+                if (assembly == null)
+                {
+                    Console.WriteLine("Can't analyze wrapper usage, {0} isn't loaded.", assemblyName);
+                    return false;
+                }
+                if (_wrapperAssembly == null)
+                {
+                    Console.WriteLine("Can't analyze wrapper usage, Klawr.UnrealEngine isn't loaded.");
+                    return false;
+                }
+                // the scripts may reference types in wrapper assemblies that aren't loaded yet
+                LoadWrapperAssemblies();
+
+                var analyzer = new WrapperUsageAnalyzer();
+                analyzer.AnalyzeAssembly(assembly);
+                // the wrapper project template sources must still compile once the wrappers 
+                // are trimmed
+                analyzer.AnalyzeTemplateTypes(_wrapperAssembly);
+                using (var writer = new System.IO.StreamWriter(outputFilename))
+                {
+                    analyzer.Write(writer);
+                }
+                Console.WriteLine(
+                    "Wrote the {0} wrapper types and members used by {1} to {2}",
+                    analyzer.UsedNames.Count(), assemblyName, outputFilename
+                );
+            }
+            catch (Exception except)
+            {
+                Console.WriteLine(except.ToString());
+                return false;
+            }
+            return true;
         }
 
         public bool LoadAssembly(string assemblyName)
@@ -250,11 +367,33 @@ namespace Klawr.ClrHost.Managed
         }
 
         /// <summary>
-        /// Search all loaded (non-dynamic) assemblies for a Type matching the given name.
+        /// Search all loaded (non-dynamic) assemblies for a Type matching the given name, if no
+        /// match is found any wrapper assemblies that haven't been loaded yet are loaded and
+        /// searched too.
         /// </summary>
         /// <param name="typeName">The full name of a type (including the namespace).</param>
         /// <returns>Matching Type instance, or null if no match was found.</returns>
-        private static Type FindTypeByName(string typeName)
+        private Type FindTypeByName(string typeName)
+        {
+            var type = FindLoadedTypeByName(typeName);
+            // the type may be in a wrapper assembly that hasn't been needed until now
+            if ((type == null) && LoadWrapperAssemblies())
+            {
+                type = FindLoadedTypeByName(typeName);
+            }
+            // a wrapper type that was trimmed away would otherwise just look like a typo
+            if ((type == null) && (_trimmedWrappers != null) && 
+                typeName.StartsWith(_wrapperAssembly.GetName().Name + "."))
+            {
+                throw new TypeLoadException(String.Format(
+                    "{0} was trimmed from the wrapper assemblies, they only contain what's listed in {1}.",
+                    typeName, _trimmedWrappers.UsageFilename
+                ));
+            }
+            return type;
+        }
+
+        private static Type FindLoadedTypeByName(string typeName)
         {
             return AppDomain.CurrentDomain.GetAssemblies()
                 .Where(assembly => !assembly.IsDynamic)
@@ -265,7 +404,11 @@ namespace Klawr.ClrHost.Managed
         public void BindUtils(
             ref ObjectUtilsProxy objectUtilsProxy,
             ref LogUtilsProxy logUtilsProxy,
-            ref ArrayUtilsProxy arrayUtilsProxy
+            ref ArrayUtilsProxy arrayUtilsProxy,
+            ref NameUtilsProxy nameUtilsProxy,
+            ref ScriptComponentUtilsProxy scriptComponentUtilsProxy,
+            ref ProfilerUtilsProxy profilerUtilsProxy,
+            ref TaskUtilsProxy taskUtilsProxy
         )
         {
             new ObjectUtils(ref objectUtilsProxy);
@@ -273,6 +416,12 @@ namespace Klawr.ClrHost.Managed
             // redirect output to the UE console and log file (needs LogUtils)
             System.Console.SetOut(new UELogWriter());
             new ArrayUtils(ref arrayUtilsProxy);
+            new NameUtils(ref nameUtilsProxy);
+            new ScriptComponentUtils(ref scriptComponentUtilsProxy);
+            new Profiler(ref profilerUtilsProxy);
+            new TaskUtils(ref taskUtilsProxy);
+            // this is called on the game thread, so it's a good time to install the context
+            FrameSynchronizationContext.Initialize();
         }
 
         public bool CreateScriptComponent(
@@ -295,6 +444,25 @@ namespace Klawr.ClrHost.Managed
                     );
                     // initialize the script component proxy
                     proxy.InstanceID = instanceID;
+                    proxy.CanTickConcurrently = componentTypeInfo.CanTickConcurrently ? 1 : 0;
+                    proxy.FlushProfilerScopes = _flushProfilerScopes;
+                    var tickSettings = componentTypeInfo.TickSettings;
+                    if (tickSettings != null)
+                    {
+                        proxy.TickInterval = tickSettings.Interval;
+                        proxy.TickGroup = (int)tickSettings.Group;
+                        proxy.StaggerTicks = tickSettings.Stagger ? 1 : 0;
+                    }
+                    var tickLod = componentTypeInfo.TickLod;
+                    if (tickLod != null)
+                    {
+                        proxy.UseTickLod = 1;
+                        proxy.TickLodNearDistance = tickLod.NearDistance;
+                        proxy.TickLodFarDistance = tickLod.FarDistance;
+                        proxy.TickLodReducedInterval = tickLod.ReducedInterval;
+                        proxy.TickLodMinimalInterval = tickLod.MinimalInterval;
+                        proxy.SuspendTickWhenNotRendered = tickLod.SuspendWhenNotRendered ? 1 : 0;
+                    }
                     foreach (var methodInfo in componentTypeInfo.Methods)
                     {
                         methodInfo.BindToProxy(
@@ -319,6 +487,104 @@ namespace Klawr.ClrHost.Managed
             instance.Dispose();
         }
 
+        public long GetTickScriptComponentsFunction()
+        {
+            if (_tickScriptComponents == null)
+            {
+                _tickScriptComponents = new TickScriptComponentsAction(TickScriptComponents);
+            }
+            return (long)Marshal.GetFunctionPointerForDelegate(_tickScriptComponents);
+        }
+
+        /// <summary>
+        /// Tick a batch of script components.
+        /// 
+        /// This may be called on multiple threads at once, the set of registered script components
+        /// can't change while that's happening so reading _scriptComponents is safe.
+        /// </summary>
+        private unsafe void TickScriptComponents(IntPtr instanceIDs, IntPtr deltaTimes, int count)
+        {
+            var ids = (long*)instanceIDs;
+            var times = (float*)deltaTimes;
+            for (int i = 0; i < count; ++i)
+            {
+                ScriptComponentInfo componentInfo;
+                if (_scriptComponents.TryGetValue(ids[i], out componentInfo))
+                {
+                    try
+                    {
+                        componentInfo.Proxy.TickComponent(times[i]);
+                    }
+                    catch (Exception except)
+                    {
+                        // an exception escaping into a task graph worker would take down the 
+                        // whole process, so just log it and carry on with the rest of the batch
+                        LogUtils.LogError(except.ToString());
+                    }
+                }
+            }
+            // emit the profiling scopes while still inside the native stat scope of the batch
+            Profiler.Flush();
+        }
+
+        public long GetUpdateTickLodsFunction()
+        {
+            if (_updateTickLods == null)
+            {
+                _updateTickLods = new UpdateTickLodsAction(UpdateTickLods);
+            }
+            return (long)Marshal.GetFunctionPointerForDelegate(_updateTickLods);
+        }
+
+        /// <summary>
+        /// Let a batch of script components select their own tick LODs.
+        /// </summary>
+        private unsafe void UpdateTickLods(
+            IntPtr instanceIDs, IntPtr viewDistances, IntPtr recentlyRendered, IntPtr tickLods, int count
+        )
+        {
+            var ids = (long*)instanceIDs;
+            var distances = (float*)viewDistances;
+            var rendered = (byte*)recentlyRendered;
+            var lods = (int*)tickLods;
+            for (int i = 0; i < count; ++i)
+            {
+                ScriptComponentInfo componentInfo;
+                if (_scriptComponents.TryGetValue(ids[i], out componentInfo) &&
+                    (componentInfo.Proxy.SelectTickLod != null))
+                {
+                    try
+                    {
+                        lods[i] = (int)componentInfo.Proxy.SelectTickLod(
+                            distances[i], rendered[i] != 0, (TickLod)lods[i]
+                        );
+                    }
+                    catch (Exception except)
+                    {
+                        // keep the default tick LOD, and carry on with the rest of the batch
+                        LogUtils.LogError(except.ToString());
+                    }
+                }
+            }
+        }
+
+        public long GetAllocatedBytesFunction()
+        {
+            if (_getAllocatedBytes == null)
+            {
+                // once enabled monitoring can't be disabled, and it applies to all app domains
+                AppDomain.MonitoringIsEnabled = true;
+                _getAllocatedBytes = new GetAllocatedBytesFunc(GetAllocatedBytes);
+            }
+            return (long)Marshal.GetFunctionPointerForDelegate(_getAllocatedBytes);
+        }
+
+        private static long GetAllocatedBytes()
+        {
+            // only updated when a thread runs out of its allocation context (roughly every 8 KB)
+            return AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize;
+        }
+
         private void RegisterScriptComponent(
             long instanceID, IDisposable scriptComponent, ScriptComponentProxy proxy
         )
@@ -401,6 +667,14 @@ namespace Klawr.ClrHost.Managed
                 }
             }
             typeInfo.Methods = implementedMethodList.ToArray();
+            typeInfo.CanTickConcurrently = 
+                componentType.IsDefined(typeof(ConcurrentTickAttribute), true);
+            typeInfo.TickSettings = (TickSettingsAttribute)Attribute.GetCustomAttribute(
+                componentType, typeof(TickSettingsAttribute), true
+            );
+            typeInfo.TickLod = (TickLodAttribute)Attribute.GetCustomAttribute(
+                componentType, typeof(TickLodAttribute), true
+            );
             return typeInfo;
         }
 
@@ -471,5 +745,30 @@ namespace Klawr.ClrHost.Managed
                 .Select(t => t.FullName)
                 .ToArray();
         }
+
+        public void FlushLog()
+        {
+            LogUtils.Flush();
+        }
+
+        public void RunFrame(float deltaTime)
+        {
+            FrameSynchronizationContext.Instance.RunFrame(deltaTime);
+        }
+
+        public int RunWorkQueue(double budgetSeconds)
+        {
+            return WorkQueue.Run(budgetSeconds);
+        }
+
+        public void LogWorkQueueStats()
+        {
+            WorkQueue.LogStats();
+        }
+
+        public void FlushProfilerScopes()
+        {
+            Profiler.FlushFrame();
+        }
     }
 }
@@ -0,0 +1,235 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Reflection;
+using System.Runtime;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Controls the garbage collector, the settings are shared by all app domains.
+    /// </summary>
+    public static class GarbageCollection
+    {
+        // GC.TryStartNoGCRegion() and GC.EndNoGCRegion() were only added in .NET 4.6, so when 
+        // running on an older runtime no GC regions are simply unavailable
+        private static readonly Func<long, bool> _tryStartNoGCRegion;
+        private static readonly Action _endNoGCRegion;
+        private static readonly object _lock = new object();
+        private static bool _isInNoGCRegion;
+
+        static GarbageCollection()
+        {
+            var tryStartMethod = typeof(GC).GetMethod(
+                "TryStartNoGCRegion", BindingFlags.Public | BindingFlags.Static,
+                null, new Type[] { typeof(long) }, null
+            );
+            var endMethod = typeof(GC).GetMethod(
+                "EndNoGCRegion", BindingFlags.Public | BindingFlags.Static,
+                null, Type.EmptyTypes, null
+            );
+            if ((tryStartMethod != null) && (endMethod != null))
+            {
+                _tryStartNoGCRegion = (Func<long, bool>)Delegate.CreateDelegate(
+                    typeof(Func<long, bool>), tryStartMethod
+                );
+                _endNoGCRegion = (Action)Delegate.CreateDelegate(typeof(Action), endMethod);
+            }
+        }
+
+        /// <summary>
+        /// Check if no GC regions are supported by the runtime.
+        /// </summary>
+        public static bool IsNoGCRegionSupported
+        {
+            get { return _tryStartNoGCRegion != null; }
+        }
+
+        /// <summary>
+        /// Check if a no GC region is currently active.
+        /// </summary>
+        public static bool IsInNoGCRegion
+        {
+            get { return _isInNoGCRegion; }
+        }
+
+        /// <summary>
+        /// Change the latency mode of the garbage collector.
+        /// </summary>
+        /// <param name="latencyMode">The new latency mode.</param>
+        /// <returns>true if the latency mode was changed, false otherwise</returns>
+        public static bool SetLatencyMode(GCLatencyMode latencyMode)
+        {
+            lock (_lock)
+            {
+                // the latency mode can't be changed while a no GC region is active
+                if (_isInNoGCRegion)
+                {
+                    return false;
+                }
+                try
+                {
+                    GCSettings.LatencyMode = latencyMode;
+                    return GCSettings.LatencyMode == latencyMode;
+                }
+                catch (ArgumentOutOfRangeException)
+                {
+                    return false;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Collect garbage.
+        /// </summary>
+        /// <param name="generation">The oldest generation to collect, -1 to collect all 
+        /// generations.</param>
+        /// <param name="blocking">true if the collection should complete before this method 
+        /// returns, false to let the garbage collector perform a background collection if it can.
+        /// </param>
+        public static void Collect(int generation, bool blocking)
+        {
+            lock (_lock)
+            {
+                // any collection would end the no GC region, so let the region end explicitly
+                if (_isInNoGCRegion)
+                {
+                    return;
+                }
+            }
+            if ((generation < 0) || (generation > GC.MaxGeneration))
+            {
+                generation = GC.MaxGeneration;
+            }
+            GC.Collect(generation, GCCollectionMode.Forced, blocking);
+            if (blocking && (generation == GC.MaxGeneration))
+            {
+                // objects with finalizers only get collected after their finalizers have run
+                GC.WaitForPendingFinalizers();
+                GC.Collect(generation, GCCollectionMode.Forced, true);
+            }
+        }
+
+        /// <summary>
+        /// Attempt to prevent garbage collections until EndNoGCRegion() is called.
+        /// </summary>
+        /// <param name="totalSize">Number of bytes that can be allocated before a collection is 
+        /// forced, this must not exceed the size of an ephemeral segment.</param>
+        /// <returns>true if the no GC region was entered, false otherwise</returns>
+        public static bool TryStartNoGCRegion(long totalSize)
+        {
+            if (_tryStartNoGCRegion == null)
+            {
+                return false;
+            }
+            lock (_lock)
+            {
+                if (_isInNoGCRegion)
+                {
+                    return false;
+                }
+                try
+                {
+                    _isInNoGCRegion = _tryStartNoGCRegion(totalSize);
+                }
+                catch (ArgumentOutOfRangeException)
+                {
+                    // totalSize was too large
+                    _isInNoGCRegion = false;
+                }
+                return _isInNoGCRegion;
+            }
+        }
+
+        /// <summary>
+        /// Allow garbage collections again after a successful call to TryStartNoGCRegion().
+        /// </summary>
+        public static void EndNoGCRegion()
+        {
+            lock (_lock)
+            {
+                if (!_isInNoGCRegion)
+                {
+                    return;
+                }
+                _isInNoGCRegion = false;
+                try
+                {
+                    _endNoGCRegion();
+                }
+                catch (InvalidOperationException)
+                {
+                    // the region was already ended by a collection (because more memory was 
+                    // allocated than requested, or GC.Collect() was called by someone else)
+                }
+            }
+        }
+
+        /// <summary>
+        /// Start a no GC region that will be ended when the returned object is disposed.
+        /// </summary>
+        /// <example>
+        /// using (GarbageCollection.NoGCRegion(16 * 1024 * 1024))
+        /// {
+        ///     // latency sensitive code
+        /// }
+        /// </example>
+        /// <param name="totalSize">Number of bytes that can be allocated before a collection is 
+        /// forced.</param>
+        public static NoGCRegionScope NoGCRegion(long totalSize)
+        {
+            return new NoGCRegionScope(TryStartNoGCRegion(totalSize));
+        }
+
+        /// <summary>
+        /// Ends a no GC region when disposed.
+        /// </summary>
+        public struct NoGCRegionScope : IDisposable
+        {
+            private readonly bool _isActive;
+
+            internal NoGCRegionScope(bool isActive)
+            {
+                _isActive = isActive;
+            }
+
+            /// <summary>
+            /// true if the no GC region was entered, false otherwise.
+            /// </summary>
+            public bool IsActive
+            {
+                get { return _isActive; }
+            }
+
+            public void Dispose()
+            {
+                if (_isActive)
+                {
+                    EndNoGCRegion();
+                }
+            }
+        }
+    }
+}
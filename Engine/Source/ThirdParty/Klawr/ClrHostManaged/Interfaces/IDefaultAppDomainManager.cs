@@ -58,5 +58,35 @@ namespace Klawr.ClrHost.Interfaces
         /// Unload all engine app domains.
         /// </summary>
         void DestroyAllEngineAppDomains();
+
+        /// <summary>
+        /// Change the latency mode of the garbage collector.
+        /// </summary>
+        /// <param name="latencyMode">One of the System.Runtime.GCLatencyMode values.</param>
+        /// <returns>true if the latency mode was changed, false otherwise</returns>
+        bool SetGCLatencyMode(int latencyMode);
+
+        /// <summary>
+        /// Collect garbage in all app domains.
+        /// </summary>
+        /// <param name="generation">The oldest generation to collect, -1 to collect all 
+        /// generations.</param>
+        /// <param name="blocking">true if the collection should complete before this method 
+        /// returns, false to let the garbage collector perform a background collection if it can.
+        /// </param>
+        void CollectGarbage(int generation, bool blocking);
+
+        /// <summary>
+        /// Attempt to prevent garbage collections until EndNoGCRegion() is called.
+        /// </summary>
+        /// <param name="totalSize">Number of bytes that can be allocated before a collection is 
+        /// forced.</param>
+        /// <returns>true if the no GC region was entered, false otherwise</returns>
+        bool TryStartNoGCRegion(long totalSize);
+
+        /// <summary>
+        /// Allow garbage collections again after a successful call to TryStartNoGCRegion().
+        /// </summary>
+        void EndNoGCRegion();
     }
 }
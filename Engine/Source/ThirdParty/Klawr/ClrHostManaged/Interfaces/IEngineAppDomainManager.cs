@@ -51,10 +51,21 @@ namespace Klawr.ClrHost.Interfaces
         IntPtr[] GetNativeFunctionPointers(string nativeClassName);
 
         /// <summary>
-        /// Load the Klawr.UnrealEngine assembly into the engine app domain.
+        /// Load the core Klawr.UnrealEngine assembly into the engine app domain, the wrapper 
+        /// assemblies of other modules are loaded on demand.
         /// </summary>
         void LoadUnrealEngineWrapperAssembly();
 
+        /// <summary>
+        /// Write out the names of all the wrapper types and members referenced by an assembly that
+        /// has already been loaded into the engine app domain, one per line, along with those 
+        /// referenced by the wrapper project template sources.
+        /// </summary>
+        /// <param name="assemblyName">Name of the assembly to analyze (without a file extension).</param>
+        /// <param name="outputFilename">Name of the file to write.</param>
+        /// <returns>true if the file was written, false otherwise</returns>
+        bool WriteWrapperUsage(string assemblyName, string outputFilename);
+
         /// <summary>
         /// Load the specified assembly into the engine app domain.
         /// </summary>
@@ -86,7 +97,11 @@ namespace Klawr.ClrHost.Interfaces
         void BindUtils(
             ref ObjectUtilsProxy objectUtilsProxy,
             ref LogUtilsProxy logUtilsProxy,
-            ref ArrayUtilsProxy arrayUtilsProxy
+            ref ArrayUtilsProxy arrayUtilsProxy,
+            ref NameUtilsProxy nameUtilsProxy,
+            ref ScriptComponentUtilsProxy scriptComponentUtilsProxy,
+            ref ProfilerUtilsProxy profilerUtilsProxy,
+            ref TaskUtilsProxy taskUtilsProxy
         );
                 
         bool CreateScriptComponent(
@@ -95,11 +110,71 @@ namespace Klawr.ClrHost.Interfaces
 
         void DestroyScriptComponent(long scriptComponentID);
 
+        /// <summary>
+        /// Get a pointer to a function that calls TickComponent() on a batch of script components.
+        /// 
+        /// The function takes a pointer to an array of script component instance IDs, a pointer
+        /// to an array of delta times (one per component), and the number of components. Batches
+        /// of components whose types are marked with ConcurrentTickAttribute can be ticked 
+        /// concurrently on different threads, provided no script components are created or 
+        /// destroyed in the meantime.
+        /// </summary>
+        /// <returns>Function pointer (as a long to avoid truncation on 64-bit platforms).</returns>
+        long GetTickScriptComponentsFunction();
+
+        /// <summary>
+        /// Get a pointer to a function that calls SelectTickLod() on a batch of script components.
+        /// 
+        /// The function takes a pointer to an array of script component instance IDs, pointers
+        /// to arrays of view distances, recently rendered flags (one byte each), and default tick
+        /// LODs (overwritten with the selected tick LODs), and the number of components.
+        /// </summary>
+        /// <returns>Function pointer (as a long to avoid truncation on 64-bit platforms).</returns>
+        long GetUpdateTickLodsFunction();
+
+        /// <summary>
+        /// Get a pointer to a function that returns the total number of bytes allocated by managed
+        /// code in this app domain. Calling this enables app domain resource monitoring.
+        /// </summary>
+        /// <returns>Function pointer (as a long to avoid truncation on 64-bit platforms).</returns>
+        long GetAllocatedBytesFunction();
+
         /// <summary>
         /// Get the fully qualified names (including namespace) of all currently loaded managed 
         /// types derived from UKlawrScriptComponent.
         /// </summary>
         /// <returns>Script component type names.</returns>
         string[] GetScriptComponentTypes();
+
+        /// <summary>
+        /// Print all log messages queued by managed code in this app domain.
+        /// </summary>
+        void FlushLog();
+
+        /// <summary>
+        /// Run all continuations of async script methods that are due this frame, this must be
+        /// called on the game thread once per frame.
+        /// </summary>
+        /// <param name="deltaTime">Number of seconds since the previous frame.</param>
+        void RunFrame(float deltaTime);
+
+        /// <summary>
+        /// Run work items queued in the WorkQueue until the budget runs out, this must be called on
+        /// the game thread once per frame.
+        /// </summary>
+        /// <param name="budgetSeconds">Number of seconds the work items can run for.</param>
+        /// <returns>Number of work items left in the queue.</returns>
+        int RunWorkQueue(double budgetSeconds);
+
+        /// <summary>
+        /// Log the statistics gathered by the WorkQueue.
+        /// </summary>
+        void LogWorkQueueStats();
+
+        /// <summary>
+        /// Hand any profiling scopes recorded on the game thread to the engine, and find out 
+        /// whether the engine is still collecting stats (scopes aren't recorded when it isn't).
+        /// </summary>
+        void FlushProfilerScopes();
     }
 }
@@ -0,0 +1,129 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Threading;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Fixed size lock-free queue of log messages.
+    /// </summary>
+    /// <remarks>
+    /// Any number of threads can add messages to the queue concurrently, but only one thread at 
+    /// a time may remove messages from the queue. Each slot has a sequence number that tells 
+    /// producers and the consumer whose turn it is to access the slot, so slots are never locked.
+    /// </remarks>
+    internal class LogQueue
+    {
+        private readonly int _mask;
+        private readonly int[] _sequences;
+        private readonly LogVerbosity[] _verbosities;
+        private readonly string[] _messages;
+        private int _enqueuePosition;
+        // only accessed by the consumer
+        private int _dequeuePosition;
+
+        /// <param name="capacity">Maximum number of messages in the queue, must be a power of two.</param>
+        public LogQueue(int capacity)
+        {
+            if ((capacity < 2) || ((capacity & (capacity - 1)) != 0))
+            {
+                throw new ArgumentException("Capacity must be a power of two.", "capacity");
+            }
+            _mask = capacity - 1;
+            _sequences = new int[capacity];
+            _verbosities = new LogVerbosity[capacity];
+            _messages = new string[capacity];
+            for (int i = 0; i < capacity; ++i)
+            {
+                _sequences[i] = i;
+            }
+        }
+
+        /// <summary>
+        /// Add a message to the end of the queue, can be called from any thread.
+        /// </summary>
+        /// <returns>false if the queue is full, true otherwise</returns>
+        public bool TryEnqueue(LogVerbosity verbosity, string message)
+        {
+            int position = Volatile.Read(ref _enqueuePosition);
+            while (true)
+            {
+                int slot = position & _mask;
+                int difference = Volatile.Read(ref _sequences[slot]) - position;
+                if (difference == 0)
+                {
+                    // the slot is free, try to claim it
+                    int current = Interlocked.CompareExchange(
+                        ref _enqueuePosition, position + 1, position
+                    );
+                    if (current == position)
+                    {
+                        _verbosities[slot] = verbosity;
+                        _messages[slot] = message;
+                        // hand the slot over to the consumer
+                        Volatile.Write(ref _sequences[slot], position + 1);
+                        return true;
+                    }
+                    position = current;
+                }
+                else if (difference < 0)
+                {
+                    // the consumer hasn't freed up the slot yet
+                    return false;
+                }
+                else
+                {
+                    // another producer claimed the slot first
+                    position = Volatile.Read(ref _enqueuePosition);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Remove a message from the front of the queue, must only be called by one thread at a time.
+        /// </summary>
+        /// <returns>false if the queue is empty, true otherwise</returns>
+        public bool TryDequeue(out LogVerbosity verbosity, out string message)
+        {
+            int position = _dequeuePosition;
+            int slot = position & _mask;
+            if (Volatile.Read(ref _sequences[slot]) != (position + 1))
+            {
+                // empty, or a producer claimed the slot but hasn't finished writing to it
+                verbosity = LogVerbosity.NoLogging;
+                message = null;
+                return false;
+            }
+            verbosity = _verbosities[slot];
+            message = _messages[slot];
+            _messages[slot] = null;
+            _dequeuePosition = position + 1;
+            // hand the slot back to the producers for the next lap around the queue
+            Volatile.Write(ref _sequences[slot], position + _mask + 1);
+            return true;
+        }
+    }
+}
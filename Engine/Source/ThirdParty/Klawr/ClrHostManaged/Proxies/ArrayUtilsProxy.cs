@@ -22,6 +22,7 @@
 // SOFTWARE.
 //
 
+using Klawr.ClrHost.Managed.Collections;
 using Klawr.ClrHost.Managed.SafeHandles;
 using Klawr.UnrealEngine;
 using System;
@@ -45,8 +46,8 @@ namespace Klawr.ClrHost.Managed
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public delegate IntPtr GetRawPtrFunc(ArrayHandle arrayHandle, Int32 index);
 
-        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
-        public delegate string GetStringFunc(ArrayHandle arrayHandle, Int32 index);
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate StringRef GetStringFunc(ArrayHandle arrayHandle, Int32 index);
 
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public delegate FScriptName GetNameFunc(ArrayHandle arrayHandle, Int32 index);
@@ -113,6 +114,91 @@ namespace Klawr.ClrHost.Managed
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public delegate void RemoveAtAction(ArrayHandle arrayHandle, Int32 index);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 AddDefaultedFunc(ArrayHandle arrayHandle, Int32 count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void InsertDefaultedAction(ArrayHandle arrayHandle, Int32 index, Int32 count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 AppendRawFunc(ArrayHandle arrayHandle, IntPtr items, Int32 count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void InsertRawAction(
+            ArrayHandle arrayHandle, Int32 index, IntPtr items, Int32 count
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void RemoveRangeAction(ArrayHandle arrayHandle, Int32 index, Int32 count);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void ReserveAction(ArrayHandle arrayHandle, Int32 capacity);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SetFloatAtAction(ArrayHandle arrayHandle, Int32 index, float item);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SetVectorAtAction(ArrayHandle arrayHandle, Int32 index, FVector item);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 FindFloatFunc(ArrayHandle arrayHandle, float item);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 FindVectorFunc(ArrayHandle arrayHandle, FVector item);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int64 SumInt32Func(ArrayHandle arrayHandle);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate float SumFloatFunc(ArrayHandle arrayHandle);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate FVector SumVectorFunc(ArrayHandle arrayHandle);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public delegate bool MinMaxInt32Func(ArrayHandle arrayHandle, out Int32 min, out Int32 max);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public delegate bool MinMaxFloatFunc(
+            ArrayHandle arrayHandle, out float min, out float max
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public delegate bool MinMaxVectorFunc(
+            ArrayHandle arrayHandle, out FVector min, out FVector max
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SortInt32Action(ArrayHandle arrayHandle);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SortFloatAction(ArrayHandle arrayHandle);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 CountInt32Func(
+            ArrayHandle arrayHandle, ArrayComparison comparison, Int32 value
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 CountFloatFunc(
+            ArrayHandle arrayHandle, ArrayComparison comparison, float value
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 FindNearestVectorFunc(ArrayHandle arrayHandle, FVector point);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public delegate bool SetLookupIndexEnabledFunc(
+            ArrayHandle arrayHandle, [MarshalAs(UnmanagedType.U1)] bool enabled
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void InvalidateLookupIndexAction(ArrayHandle arrayHandle);
+
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public delegate void DestroyAction(IntPtr arrayHandle);
 
@@ -188,6 +274,75 @@ namespace Klawr.ClrHost.Managed
         [MarshalAs(UnmanagedType.FunctionPtr)]
         public RemoveAtAction RemoveAt;
 
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public AddDefaultedFunc AddDefaulted;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public InsertDefaultedAction InsertDefaulted;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public AppendRawFunc AppendRaw;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public InsertRawAction InsertRaw;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public RemoveRangeAction RemoveRange;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public ReserveAction Reserve;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SetFloatAtAction SetFloatAt;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SetVectorAtAction SetVectorAt;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public FindFloatFunc FindFloat;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public FindVectorFunc FindVector;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SumInt32Func SumInt32;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SumFloatFunc SumFloat;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SumVectorFunc SumVector;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public MinMaxInt32Func MinMaxInt32;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public MinMaxFloatFunc MinMaxFloat;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public MinMaxVectorFunc MinMaxVector;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SortInt32Action SortInt32;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SortFloatAction SortFloat;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public CountInt32Func CountInt32;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public CountFloatFunc CountFloat;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public FindNearestVectorFunc FindNearestVector;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SetLookupIndexEnabledFunc SetLookupIndexEnabled;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public InvalidateLookupIndexAction InvalidateLookupIndex;
+
         [MarshalAs(UnmanagedType.FunctionPtr)]
         public DestroyAction Destroy;
     }
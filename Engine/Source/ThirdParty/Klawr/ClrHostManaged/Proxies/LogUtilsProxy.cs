@@ -38,6 +38,12 @@ namespace Klawr.ClrHost.Managed
         [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
         public delegate void LogAction(string text);
 
+        /// <param name="records">Array of (verbosity, length) pairs, one pair per message.</param>
+        /// <param name="numRecords">Number of messages in the batch.</param>
+        /// <param name="text">Null-terminated text of each message, one after another.</param>
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void LogBatchAction(IntPtr records, Int32 numRecords, IntPtr text);
+
         /// <summary>
         /// Print an error to the UE4 console and log file, then crash (even if logging is disabled).
         /// </summary>
@@ -79,5 +85,16 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         [MarshalAs(UnmanagedType.FunctionPtr)]
         public LogAction LogVeryVerbose;
+
+        /// <summary>
+        /// Print a batch of messages.
+        /// </summary>
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public LogBatchAction LogBatch;
+
+        /// <summary>
+        /// Pointer to the current verbosity of the native log category (as a LogVerbosity value).
+        /// </summary>
+        public IntPtr Verbosity;
     }
 }
@@ -0,0 +1,55 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using Klawr.UnrealEngine;
+using System;
+using System.Runtime.InteropServices;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Contains delegates encapsulating native FName utility functions.
+    /// </summary>
+    /// <remarks>This struct has a native counterpart by the same name defined in the
+    /// Klawr.ClrHost.Native project, and it is also exposed to native code via COM.</remarks>
+    [ComVisible(true)]
+    [Guid("5C3E41B7-2D8A-4F6B-9E15-7A0C84D2B913")]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct NameUtilsProxy
+    {
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate Int32 GetNameEntriesFunc(
+            Int32 firstIndex, Int32 count, IntPtr buffer, Int32 bufferLength, IntPtr outLengths
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
+        public delegate FScriptName MakeNameFunc(string name);
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public GetNameEntriesFunc GetNameEntries;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public MakeNameFunc MakeName;
+    }
+}
@@ -57,6 +57,14 @@ namespace Klawr.ClrHost.Managed
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public delegate void TickComponentAction(float deltaTime);
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate TickLod SelectTickLodFunc(
+            float viewDistance, [MarshalAs(UnmanagedType.U1)] bool wasRecentlyRendered, TickLod defaultLod
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void FlushProfilerScopesAction();
+
         /// <summary>
         /// ID of the script component instance this proxy represents.
         /// </summary>
@@ -97,5 +105,72 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         [MarshalAs(UnmanagedType.FunctionPtr)]
         public TickComponentAction TickComponent;
+
+        /// <summary>
+        /// Non-zero if the script component type is marked with ConcurrentTickAttribute, in which
+        /// case TickComponent will not be called directly from native code, instead the component
+        /// will be ticked via IEngineAppDomainManager.GetTickScriptComponentsFunction().
+        /// </summary>
+        public int CanTickConcurrently;
+
+        /// <summary>
+        /// Seconds between ticks specified by TickSettingsAttribute (zero for every frame).
+        /// </summary>
+        public float TickInterval;
+
+        /// <summary>
+        /// One of the ScriptTickGroup values, specified by TickSettingsAttribute.
+        /// </summary>
+        public int TickGroup;
+
+        /// <summary>
+        /// Non-zero if ticks of components with a tick interval should be spread across frames.
+        /// </summary>
+        public int StaggerTicks;
+
+        /// <summary>
+        /// Non-zero if the script component type is marked with TickLodAttribute.
+        /// </summary>
+        public int UseTickLod;
+
+        /// <summary>
+        /// TickLodAttribute.NearDistance
+        /// </summary>
+        public float TickLodNearDistance;
+
+        /// <summary>
+        /// TickLodAttribute.FarDistance
+        /// </summary>
+        public float TickLodFarDistance;
+
+        /// <summary>
+        /// TickLodAttribute.ReducedInterval
+        /// </summary>
+        public float TickLodReducedInterval;
+
+        /// <summary>
+        /// TickLodAttribute.MinimalInterval
+        /// </summary>
+        public float TickLodMinimalInterval;
+
+        /// <summary>
+        /// Non-zero if TickLodAttribute.SuspendWhenNotRendered is set.
+        /// </summary>
+        public int SuspendTickWhenNotRendered;
+
+        /// <summary>
+        /// Delegate instance encapsulating UKlawrScriptComponent.SelectTickLod() override (may be null).
+        /// This isn't called directly from native code, native code calls 
+        /// IEngineAppDomainManager.GetUpdateTickLodsFunction() instead.
+        /// </summary>
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SelectTickLodFunc SelectTickLod;
+
+        /// <summary>
+        /// Delegate instance that hands any profiling scopes recorded on the calling thread to the
+        /// engine, native code calls this after TickComponent while the engine is collecting stats.
+        /// </summary>
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public FlushProfilerScopesAction FlushProfilerScopes;
     };
 }
@@ -0,0 +1,80 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using Klawr.ClrHost.Managed.SafeHandles;
+using System;
+using System.Runtime.InteropServices;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Contains delegates encapsulating native functions that control how script components tick.
+    /// </summary>
+    /// <remarks>This struct has a native counterpart by the same name defined in the
+    /// Klawr.ClrHost.Native project, and it is also exposed to native code via COM.</remarks>
+    [ComVisible(true)]
+    [Guid("35506178-1E8C-4272-930D-5DAC20D0CDD3")]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ScriptComponentUtilsProxy
+    {
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SetTickIntervalAction(
+            UObjectHandle component, float interval, [MarshalAs(UnmanagedType.U1)] bool stagger
+        );
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SetTickGroupAction(UObjectHandle component, int tickGroup);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void SleepAction(UObjectHandle component);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void WakeAction(UObjectHandle component);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.U1)]
+        public delegate bool IsSleepingFunc(UObjectHandle component);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate IntPtr GetTickLodAddressFunc(UObjectHandle component);
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SetTickIntervalAction SetTickInterval;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SetTickGroupAction SetTickGroup;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public SleepAction Sleep;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public WakeAction Wake;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public IsSleepingFunc IsSleeping;
+
+        [MarshalAs(UnmanagedType.FunctionPtr)]
+        public GetTickLodAddressFunc GetTickLodAddress;
+    }
+}
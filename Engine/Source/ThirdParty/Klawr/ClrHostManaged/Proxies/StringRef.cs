@@ -0,0 +1,116 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// A length-prefixed UTF-16 string returned by native code.
+    /// </summary>
+    /// <remarks>This struct has a native counterpart by the same name defined in the
+    /// Klawr.ClrHost.Native project. The characters are owned by native code and may be
+    /// modified or freed at any point after the native function that returned the StringRef
+    /// returns, so the StringRef should be converted to a string immediately.</remarks>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct StringRef
+    {
+        public IntPtr Chars;
+        public int Length;
+
+        /// <summary>
+        /// Build a string from the referenced characters.
+        /// </summary>
+        /// <remarks>Strings are cached per thread, so reading the same unchanged native string 
+        /// repeatedly (e.g. polling a property every tick) doesn't allocate a new string every
+        /// time.</remarks>
+        public override string ToString()
+        {
+            return StringRefCache.GetString(Chars, Length);
+        }
+    }
+
+    /// <summary>
+    /// Small per-thread cache of strings built from native characters.
+    /// </summary>
+    internal static class StringRefCache
+    {
+        private struct Entry
+        {
+            public IntPtr Chars;
+            public string Value;
+        }
+
+        // must be a power of two
+        private const int NumEntries = 256;
+        // strings longer than this are cheaper to build than to compare
+        private const int MaxCachedLength = 256;
+
+        [ThreadStatic]
+        private static Entry[] _entries;
+
+        public static unsafe string GetString(IntPtr chars, int length)
+        {
+            if ((chars == IntPtr.Zero) || (length <= 0))
+            {
+                return string.Empty;
+            }
+            if (length > MaxCachedLength)
+            {
+                return new string((char*)chars, 0, length);
+            }
+            if (_entries == null)
+            {
+                _entries = new Entry[NumEntries];
+            }
+            long address = chars.ToInt64();
+            int slot = (int)((address >> 1) ^ (address >> 9) ^ length) & (NumEntries - 1);
+            // Native code reuses the memory of a string when it's assigned another string of the 
+            // same length, so a matching pointer and length aren't enough for a hit, the 
+            // characters must match too. Comparing is still much cheaper than allocating.
+            Entry entry = _entries[slot];
+            if ((entry.Chars == chars) && (entry.Value.Length == length))
+            {
+                fixed (char* cached = entry.Value)
+                {
+                    char* native = (char*)chars;
+                    int i = 0;
+                    while ((i < length) && (cached[i] == native[i]))
+                    {
+                        ++i;
+                    }
+                    if (i == length)
+                    {
+                        return entry.Value;
+                    }
+                }
+            }
+            string value = new string((char*)chars, 0, length);
+            _entries[slot].Chars = chars;
+            _entries[slot].Value = value;
+            return value;
+        }
+    }
+}
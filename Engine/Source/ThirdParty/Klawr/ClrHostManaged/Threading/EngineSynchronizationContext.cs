@@ -0,0 +1,101 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Synchronization context that runs callbacks on engine worker threads via an 
+    /// EngineTaskScheduler.
+    /// </summary>
+    /// <remarks>
+    /// Code that awaits a task while this context is current will resume on an engine worker 
+    /// thread (rather than a CLR thread pool thread).
+    /// </remarks>
+    public sealed class EngineSynchronizationContext : SynchronizationContext
+    {
+        private readonly EngineTaskScheduler _scheduler;
+
+        /// <summary>
+        /// Create a synchronization context that posts callbacks to the given scheduler.
+        /// </summary>
+        public EngineSynchronizationContext(EngineTaskScheduler scheduler)
+        {
+            if (scheduler == null)
+            {
+                throw new ArgumentNullException("scheduler");
+            }
+            _scheduler = scheduler;
+        }
+
+        /// <summary>
+        /// The scheduler callbacks are posted to.
+        /// </summary>
+        public EngineTaskScheduler Scheduler
+        {
+            get { return _scheduler; }
+        }
+
+        public override void Post(SendOrPostCallback d, object state)
+        {
+            if (d == null)
+            {
+                throw new ArgumentNullException("d");
+            }
+            Task.Factory.StartNew(
+                () => d(state), CancellationToken.None, TaskCreationOptions.DenyChildAttach,
+                _scheduler
+            );
+        }
+
+        public override void Send(SendOrPostCallback d, object state)
+        {
+            if (d == null)
+            {
+                throw new ArgumentNullException("d");
+            }
+            if (Current == this)
+            {
+                d(state);
+            }
+            else
+            {
+                var task = Task.Factory.StartNew(
+                    () => d(state), CancellationToken.None, TaskCreationOptions.DenyChildAttach,
+                    _scheduler
+                );
+                task.Wait();
+            }
+        }
+
+        public override SynchronizationContext CreateCopy()
+        {
+            // the context has no mutable state, so there's no need to actually copy it
+            return this;
+        }
+    }
+}
@@ -0,0 +1,275 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Runs tasks on engine worker threads, while limiting the number of tasks that run at the 
+    /// same time to the number of worker threads.
+    /// </summary>
+    /// <remarks>
+    /// Work items queued by this scheduler are dispatched to the engine's task graph, while
+    /// TaskScheduler.Default (and therefore Task.Run, ThreadPool.QueueUserWorkItem, timers and
+    /// async I/O completions) keeps running on the CLR's own thread pool. This scheduler only 
+    /// keeps as many work items in flight as there are worker threads, each work item runs 
+    /// queued tasks until the queue is empty. If the task graph isn't available (e.g. because 
+    /// the engine is shutting down) tasks fall back to the CLR thread pool.
+    /// 
+    /// Engine worker threads are shared with the rest of the engine, and the task graph won't 
+    /// spin up additional threads when they're all blocked, so tasks scheduled here should not
+    /// block for any significant amount of time (e.g. waiting on I/O, locks, or other tasks
+    /// scheduled here), otherwise engine work can be stalled or deadlocked. Use 
+    /// TaskScheduler.Default for anything that may block.
+    /// 
+    /// When the app domain is unloaded work items that are still queued in the task graph are
+    /// cancelled, the unload waits for running work items to finish their current task, and
+    /// any tasks still queued in the scheduler never run.
+    /// </remarks>
+    public sealed class EngineTaskScheduler : TaskScheduler
+    {
+        private static readonly Lazy<EngineTaskScheduler> _default =
+            new Lazy<EngineTaskScheduler>(() => new EngineTaskScheduler());
+
+        // kept alive for as long as the app domain, since native code may call it at any time
+        private static readonly TaskUtils.WorkCallback _workCallback = OnWorkItem;
+        private static readonly IntPtr _workCallbackPtr =
+            Marshal.GetFunctionPointerForDelegate(_workCallback);
+
+        // set once the app domain starts unloading, no more work items are queued after that
+        private static volatile bool _isUnloading;
+
+        // scheduler instance the current thread is running tasks for (if any)
+        [ThreadStatic]
+        private static EngineTaskScheduler _currentScheduler;
+
+        private readonly LinkedList<Task> _tasks = new LinkedList<Task>();
+        private readonly int _maxConcurrencyLevel;
+        private readonly EngineSynchronizationContext _synchronizationContext;
+        private readonly WaitCallback _processTasks;
+        // number of work items that are queued or running, protected by _tasks
+        private int _numWorkItems;
+
+        static EngineTaskScheduler()
+        {
+            // work items queued in the task graph call back into this app domain, so they must
+            // be cancelled (or finish running) before it goes away
+            AppDomain.CurrentDomain.DomainUnload += (sender, args) => CancelWorkItems();
+        }
+
+        /// <summary>
+        /// Scheduler that uses all the engine worker threads.
+        /// </summary>
+        public static EngineTaskScheduler Instance
+        {
+            get { return _default.Value; }
+        }
+
+        /// <summary>
+        /// Options that should be passed to the methods of System.Threading.Tasks.Parallel to
+        /// run parallel loops on engine worker threads.
+        /// </summary>
+        public static ParallelOptions ParallelOptions
+        {
+            get
+            {
+                return new ParallelOptions()
+                {
+                    TaskScheduler = Instance,
+                    MaxDegreeOfParallelism = Instance.MaximumConcurrencyLevel
+                };
+            }
+        }
+
+        /// <summary>
+        /// Create a scheduler that uses all the engine worker threads.
+        /// </summary>
+        public EngineTaskScheduler()
+            : this(GetNumWorkerThreads())
+        {
+        }
+
+        /// <summary>
+        /// Create a scheduler that uses at most the given number of engine worker threads.
+        /// </summary>
+        /// <param name="maxConcurrencyLevel">Maximum number of tasks that can run at the same 
+        /// time.</param>
+        public EngineTaskScheduler(int maxConcurrencyLevel)
+        {
+            if (maxConcurrencyLevel < 1)
+            {
+                throw new ArgumentOutOfRangeException("maxConcurrencyLevel");
+            }
+            _maxConcurrencyLevel = maxConcurrencyLevel;
+            _synchronizationContext = new EngineSynchronizationContext(this);
+            _processTasks = ProcessTasks;
+        }
+
+        /// <summary>
+        /// Synchronization context that posts callbacks to this scheduler, it's installed on the
+        /// worker threads while tasks are running.
+        /// </summary>
+        public SynchronizationContext SynchronizationContext
+        {
+            get { return _synchronizationContext; }
+        }
+
+        public override int MaximumConcurrencyLevel
+        {
+            get { return _maxConcurrencyLevel; }
+        }
+
+        protected override void QueueTask(Task task)
+        {
+            lock (_tasks)
+            {
+                _tasks.AddLast(task);
+                if ((_numWorkItems < _maxConcurrencyLevel) && !_isUnloading)
+                {
+                    ++_numWorkItems;
+                    QueueWorkItem();
+                }
+            }
+        }
+
+        protected override bool TryExecuteTaskInline(Task task, bool taskWasPreviouslyQueued)
+        {
+            // only tasks that are already running on behalf of this scheduler can be inlined, 
+            // otherwise the concurrency limit could be exceeded
+            if (_currentScheduler != this)
+            {
+                return false;
+            }
+            if (taskWasPreviouslyQueued && !TryDequeue(task))
+            {
+                return false;
+            }
+            return TryExecuteTask(task);
+        }
+
+        protected override bool TryDequeue(Task task)
+        {
+            lock (_tasks)
+            {
+                return _tasks.Remove(task);
+            }
+        }
+
+        protected override IEnumerable<Task> GetScheduledTasks()
+        {
+            bool lockTaken = false;
+            try
+            {
+                Monitor.TryEnter(_tasks, ref lockTaken);
+                if (lockTaken)
+                {
+                    return new List<Task>(_tasks);
+                }
+                // only the debugger calls this, and it freezes all threads while doing so
+                throw new NotSupportedException();
+            }
+            finally
+            {
+                if (lockTaken)
+                {
+                    Monitor.Exit(_tasks);
+                }
+            }
+        }
+
+        private void QueueWorkItem()
+        {
+            var handle = GCHandle.Alloc(this);
+            if (!TaskUtils.QueueWork(_workCallbackPtr, GCHandle.ToIntPtr(handle)))
+            {
+                handle.Free();
+                ThreadPool.UnsafeQueueUserWorkItem(_processTasks, null);
+            }
+        }
+
+        private static void OnWorkItem(IntPtr context)
+        {
+            var handle = GCHandle.FromIntPtr(context);
+            var scheduler = (EngineTaskScheduler)handle.Target;
+            handle.Free();
+            try
+            {
+                scheduler.ProcessTasks(null);
+            }
+            catch (Exception except)
+            {
+                // an exception escaping into a task graph worker would take down the whole 
+                // process, task exceptions are captured by the tasks so this shouldn't happen
+                LogUtils.LogError(except.ToString());
+            }
+        }
+
+        private void ProcessTasks(object state)
+        {
+            var previousContext = SynchronizationContext.Current;
+            var previousScheduler = _currentScheduler;
+            SynchronizationContext.SetSynchronizationContext(_synchronizationContext);
+            _currentScheduler = this;
+            try
+            {
+                while (true)
+                {
+                    Task task;
+                    lock (_tasks)
+                    {
+                        if ((_tasks.Count == 0) || _isUnloading)
+                        {
+                            --_numWorkItems;
+                            break;
+                        }
+                        task = _tasks.First.Value;
+                        _tasks.RemoveFirst();
+                    }
+                    TryExecuteTask(task);
+                }
+            }
+            finally
+            {
+                _currentScheduler = previousScheduler;
+                SynchronizationContext.SetSynchronizationContext(previousContext);
+            }
+        }
+
+        private static void CancelWorkItems()
+        {
+            _isUnloading = true;
+            TaskUtils.CancelWork(_workCallbackPtr);
+        }
+
+        private static int GetNumWorkerThreads()
+        {
+            return Math.Max(1, TaskUtils.GetNumWorkerThreads());
+        }
+    }
+}
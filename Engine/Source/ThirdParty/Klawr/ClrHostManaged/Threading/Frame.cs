@@ -0,0 +1,191 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Awaitables that resume async methods on the game thread in a later frame.
+    /// </summary>
+    /// <example>
+    /// public override void InitializeComponent()
+    /// {
+    ///     Blink();
+    /// }
+    /// 
+    /// private async void Blink()
+    /// {
+    ///     while (!_isDestroyed)
+    ///     {
+    ///         ToggleVisibility();
+    ///         await Frame.Delay(0.5f);
+    ///     }
+    /// }
+    /// </example>
+    /// <remarks>
+    /// Continuations are queued in managed code and run by FrameSynchronizationContext.RunFrame(),
+    /// so a script component that only awaits these doesn't need to implement TickComponent() (and
+    /// won't be ticked by the engine). Awaiting with a cancellation token that has been cancelled
+    /// throws an OperationCanceledException once the wait is over (a cancelled Delay() is over in
+    /// the next frame), cancel the token when the script component is destroyed to stop async 
+    /// methods from touching a destroyed component.
+    /// </remarks>
+    public static class Frame
+    {
+        /// <summary>
+        /// Number of seconds elapsed since the engine app domain was created.
+        /// </summary>
+        public static double Time
+        {
+            get { return FrameSynchronizationContext.Instance.Time; }
+        }
+
+        /// <summary>
+        /// Number of frames run since the engine app domain was created.
+        /// </summary>
+        public static long Count
+        {
+            get { return FrameSynchronizationContext.Instance.FrameCount; }
+        }
+
+        /// <summary>
+        /// Resume on the game thread in the next frame.
+        /// </summary>
+        public static FrameAwaitable Next(CancellationToken cancellationToken = default(CancellationToken))
+        {
+            return new FrameAwaitable(FrameAwaitable.WaitKind.NextFrame, 0, null, cancellationToken);
+        }
+
+        /// <summary>
+        /// Resume on the game thread once the given number of seconds have elapsed.
+        /// </summary>
+        public static FrameAwaitable Delay(
+            float seconds, CancellationToken cancellationToken = default(CancellationToken)
+        )
+        {
+            return new FrameAwaitable(FrameAwaitable.WaitKind.Delay, seconds, null, cancellationToken);
+        }
+
+        /// <summary>
+        /// Resume on the game thread in the first frame in which the predicate returns true, the
+        /// predicate is checked once per frame (on the game thread).
+        /// </summary>
+        public static FrameAwaitable WaitUntil(
+            Func<bool> predicate, CancellationToken cancellationToken = default(CancellationToken)
+        )
+        {
+            if (predicate == null)
+            {
+                throw new ArgumentNullException("predicate");
+            }
+            return new FrameAwaitable(
+                FrameAwaitable.WaitKind.Condition, 0, predicate, cancellationToken
+            );
+        }
+    }
+
+    /// <summary>
+    /// Returned by the methods of the Frame class, not meant to be used directly.
+    /// </summary>
+    public struct FrameAwaitable : INotifyCompletion
+    {
+        internal enum WaitKind
+        {
+            NextFrame,
+            Delay,
+            Condition
+        }
+
+        private readonly WaitKind _kind;
+        private readonly float _seconds;
+        private readonly Func<bool> _predicate;
+        private readonly CancellationToken _cancellationToken;
+
+        internal FrameAwaitable(
+            WaitKind kind, float seconds, Func<bool> predicate, CancellationToken cancellationToken
+        )
+        {
+            _kind = kind;
+            _seconds = seconds;
+            _predicate = predicate;
+            _cancellationToken = cancellationToken;
+        }
+
+        public FrameAwaitable GetAwaiter()
+        {
+            return this;
+        }
+
+        public bool IsCompleted
+        {
+            get
+            {
+                if (_cancellationToken.IsCancellationRequested)
+                {
+                    return true;
+                }
+                switch (_kind)
+                {
+                    case WaitKind.Delay:
+                        return _seconds <= 0;
+                    case WaitKind.Condition:
+                        // only check the predicate right away if it's safe to do so
+                        return FrameSynchronizationContext.Instance.IsGameThread && _predicate();
+                    default:
+                        return false;
+                }
+            }
+        }
+
+        public void OnCompleted(Action continuation)
+        {
+            var context = FrameSynchronizationContext.Instance;
+            switch (_kind)
+            {
+                case WaitKind.NextFrame:
+                    context.QueueNextFrame(continuation);
+                    break;
+                case WaitKind.Delay:
+                    context.QueueTimer(_seconds, continuation, _cancellationToken);
+                    break;
+                case WaitKind.Condition:
+                    var predicate = _predicate;
+                    var cancellationToken = _cancellationToken;
+                    context.QueueCondition(
+                        () => cancellationToken.IsCancellationRequested || predicate(), 
+                        continuation
+                    );
+                    break;
+            }
+        }
+
+        public void GetResult()
+        {
+            _cancellationToken.ThrowIfCancellationRequested();
+        }
+    }
+}
@@ -0,0 +1,411 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Synchronization context that runs callbacks on the game thread once per frame.
+    /// </summary>
+    /// <remarks>
+    /// Each engine app domain has one instance of this context, it's installed on the game thread
+    /// so code that awaits a task on the game thread resumes on the game thread. Continuations 
+    /// of the awaitables in the Frame class are queued here as well. Everything queued here is run
+    /// by RunFrame(), which the native side calls once per frame, so scripts that only wait for 
+    /// time to pass or for something to happen don't need to tick.
+    /// 
+    /// Send() can only be called on the game thread, blocking another thread until the game 
+    /// thread gets around to running the callback would deadlock whenever the game thread is
+    /// waiting for that thread, use Post() instead.
+    /// </remarks>
+    public sealed class FrameSynchronizationContext : SynchronizationContext
+    {
+        private struct PostedCallback
+        {
+            public SendOrPostCallback Callback;
+            public object State;
+        }
+
+        private sealed class PendingTimer
+        {
+            // cleared by whichever comes first, the timer running out or the wait being cancelled
+            public Action Continuation;
+            public CancellationTokenRegistration Registration;
+        }
+
+        private struct Timer
+        {
+            public double DueTime;
+            // breaks ties so timers that are due at the same time run in the order they were added
+            public long Sequence;
+            public PendingTimer Pending;
+
+            public bool IsDueBefore(ref Timer other)
+            {
+                return (DueTime < other.DueTime) || 
+                    ((DueTime == other.DueTime) && (Sequence < other.Sequence));
+            }
+        }
+
+        private struct Condition
+        {
+            public Func<bool> Predicate;
+            public Action Continuation;
+        }
+
+        private static FrameSynchronizationContext _instance;
+
+        private readonly int _gameThreadID;
+        // callbacks posted from any thread, protected by _postedLock
+        private readonly object _postedLock = new object();
+        private List<PostedCallback> _posted = new List<PostedCallback>();
+        private List<PostedCallback> _runningPosted = new List<PostedCallback>();
+        // the rest of the queues are only accessed on the game thread
+        private List<Action> _nextFrame = new List<Action>();
+        private List<Action> _runningNextFrame = new List<Action>();
+        // binary min-heap ordered by due time
+        private readonly List<Timer> _timers = new List<Timer>();
+        private long _timerSequence;
+        private readonly List<Condition> _conditions = new List<Condition>();
+        private double _time;
+        private long _frameCount;
+
+        private FrameSynchronizationContext(int gameThreadID)
+        {
+            _gameThreadID = gameThreadID;
+        }
+
+        /// <summary>
+        /// The context for the current engine app domain.
+        /// </summary>
+        public static FrameSynchronizationContext Instance
+        {
+            get { return _instance; }
+        }
+
+        /// <summary>
+        /// Number of seconds that elapsed while frames were being run.
+        /// </summary>
+        public double Time
+        {
+            get { return _time; }
+        }
+
+        /// <summary>
+        /// Number of frames that have been run.
+        /// </summary>
+        public long FrameCount
+        {
+            get { return _frameCount; }
+        }
+
+        /// <summary>
+        /// Check if the calling thread is the game thread.
+        /// </summary>
+        public bool IsGameThread
+        {
+            get { return Thread.CurrentThread.ManagedThreadId == _gameThreadID; }
+        }
+
+        /// <summary>
+        /// Create the context for the current engine app domain and install it on the calling 
+        /// thread, which must be the game thread.
+        /// </summary>
+        internal static void Initialize()
+        {
+            _instance = new FrameSynchronizationContext(Thread.CurrentThread.ManagedThreadId);
+            SetSynchronizationContext(_instance);
+        }
+
+        public override void Post(SendOrPostCallback d, object state)
+        {
+            if (d == null)
+            {
+                throw new ArgumentNullException("d");
+            }
+            lock (_postedLock)
+            {
+                _posted.Add(new PostedCallback() { Callback = d, State = state });
+            }
+        }
+
+        public override void Send(SendOrPostCallback d, object state)
+        {
+            if (d == null)
+            {
+                throw new ArgumentNullException("d");
+            }
+            if (!IsGameThread)
+            {
+                throw new InvalidOperationException(
+                    "FrameSynchronizationContext.Send() can only be called on the game thread, " +
+                    "use Post() instead."
+                );
+            }
+            d(state);
+        }
+
+        public override SynchronizationContext CreateCopy()
+        {
+            // there's only one game thread, so there's no point in having more than one context
+            return this;
+        }
+
+        /// <summary>
+        /// Run the continuation at the start of the next frame.
+        /// </summary>
+        internal void QueueNextFrame(Action continuation)
+        {
+            if (IsGameThread)
+            {
+                _nextFrame.Add(continuation);
+            }
+            else
+            {
+                Post(_ => _nextFrame.Add(continuation), null);
+            }
+        }
+
+        /// <summary>
+        /// Run the continuation once the given number of seconds have elapsed, or in the next 
+        /// frame if the cancellation token is cancelled before then.
+        /// </summary>
+        internal void QueueTimer(
+            double seconds, Action continuation, CancellationToken cancellationToken
+        )
+        {
+            var pending = new PendingTimer() { Continuation = continuation };
+            if (cancellationToken.CanBeCanceled)
+            {
+                // the timer stays queued until it's due, but it shouldn't keep the continuation
+                // (and everything it references) alive for that long
+                pending.Registration = cancellationToken.Register(() => CancelTimer(pending));
+            }
+            if (IsGameThread)
+            {
+                AddTimer(_time + seconds, pending);
+            }
+            else
+            {
+                Post(_ => AddTimer(_time + seconds, pending), null);
+            }
+        }
+
+        /// <summary>
+        /// Run the continuation at the end of the first frame in which the predicate is true.
+        /// </summary>
+        internal void QueueCondition(Func<bool> predicate, Action continuation)
+        {
+            var condition = new Condition() { Predicate = predicate, Continuation = continuation };
+            if (IsGameThread)
+            {
+                _conditions.Add(condition);
+            }
+            else
+            {
+                Post(_ => _conditions.Add(condition), null);
+            }
+        }
+
+        /// <summary>
+        /// Run everything that's due this frame, called by the native side once per frame.
+        /// </summary>
+        /// <param name="deltaTime">Number of seconds since the previous frame.</param>
+        internal void RunFrame(float deltaTime)
+        {
+            // something may have replaced the context on the game thread since the last frame
+            if (Current != this)
+            {
+                SetSynchronizationContext(this);
+            }
+
+            _time += deltaTime;
+            ++_frameCount;
+
+            // continuations that await the next frame again will be queued for the frame after
+            var nextFrame = _nextFrame;
+            _nextFrame = _runningNextFrame;
+            _runningNextFrame = nextFrame;
+            for (int i = 0; i < nextFrame.Count; ++i)
+            {
+                Run(nextFrame[i]);
+            }
+            nextFrame.Clear();
+
+            while ((_timers.Count > 0) && (_timers[0].DueTime <= _time))
+            {
+                var pending = PopTimer().Pending;
+                var continuation = Interlocked.Exchange(ref pending.Continuation, null);
+                pending.Registration.Dispose();
+                if (continuation != null)
+                {
+                    Run(continuation);
+                }
+            }
+
+            for (int i = 0; i < _conditions.Count; )
+            {
+                var condition = _conditions[i];
+                bool isSatisfied;
+                try
+                {
+                    isSatisfied = condition.Predicate();
+                }
+                catch (Exception except)
+                {
+                    // a predicate that throws will never be satisfied, so drop it
+                    LogUtils.LogError(except.ToString());
+                    isSatisfied = false;
+                    RemoveConditionAt(i);
+                    continue;
+                }
+                if (isSatisfied)
+                {
+                    RemoveConditionAt(i);
+                    Run(condition.Continuation);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            // callbacks posted while running these will be run next frame
+            List<PostedCallback> posted;
+            lock (_postedLock)
+            {
+                posted = _posted;
+                _posted = _runningPosted;
+                _runningPosted = posted;
+            }
+            for (int i = 0; i < posted.Count; ++i)
+            {
+                try
+                {
+                    posted[i].Callback(posted[i].State);
+                }
+                catch (Exception except)
+                {
+                    LogUtils.LogError(except.ToString());
+                }
+            }
+            posted.Clear();
+        }
+
+        private static void Run(Action continuation)
+        {
+            try
+            {
+                continuation();
+            }
+            catch (Exception except)
+            {
+                // exceptions thrown by async methods end up in the task they return, so this is 
+                // only reached by async void methods, there's no one else to report them to
+                LogUtils.LogError(except.ToString());
+            }
+        }
+
+        private void RemoveConditionAt(int index)
+        {
+            // order doesn't matter
+            int last = _conditions.Count - 1;
+            _conditions[index] = _conditions[last];
+            _conditions.RemoveAt(last);
+        }
+
+        private void CancelTimer(PendingTimer pending)
+        {
+            // may be called on any thread, the awaiter throws once the continuation runs
+            var continuation = Interlocked.Exchange(ref pending.Continuation, null);
+            if (continuation != null)
+            {
+                QueueNextFrame(continuation);
+            }
+        }
+
+        private void AddTimer(double dueTime, PendingTimer pending)
+        {
+            var timer = new Timer()
+            {
+                DueTime = dueTime, Sequence = _timerSequence++, Pending = pending
+            };
+            int index = _timers.Count;
+            _timers.Add(timer);
+            while (index > 0)
+            {
+                int parent = (index - 1) / 2;
+                var parentTimer = _timers[parent];
+                if (!timer.IsDueBefore(ref parentTimer))
+                {
+                    break;
+                }
+                _timers[index] = parentTimer;
+                index = parent;
+            }
+            _timers[index] = timer;
+        }
+
+        private Timer PopTimer()
+        {
+            var top = _timers[0];
+            int last = _timers.Count - 1;
+            var timer = _timers[last];
+            _timers.RemoveAt(last);
+            if (last > 0)
+            {
+                int index = 0;
+                while (true)
+                {
+                    int child = index * 2 + 1;
+                    if (child >= last)
+                    {
+                        break;
+                    }
+                    var childTimer = _timers[child];
+                    if (child + 1 < last)
+                    {
+                        var rightTimer = _timers[child + 1];
+                        if (rightTimer.IsDueBefore(ref childTimer))
+                        {
+                            ++child;
+                            childTimer = rightTimer;
+                        }
+                    }
+                    if (!childTimer.IsDueBefore(ref timer))
+                    {
+                        break;
+                    }
+                    _timers[index] = childTimer;
+                    index = child;
+                }
+                _timers[index] = timer;
+            }
+            return top;
+        }
+    }
+}
@@ -0,0 +1,383 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Text;
+using System.Threading;
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Queue of deferrable work that runs on the game thread within a fixed time budget per frame.
+    /// </summary>
+    /// <remarks>
+    /// Once per frame the native side hands the queue a time budget (klawr.WorkQueue.BudgetMs), 
+    /// queued work items are run in priority order (and in the order they were queued within 
+    /// the same priority) until the budget runs out, whatever is left over is carried over to 
+    /// the next frame. At least one work item is run every frame so that the queue always makes 
+    /// progress, a work item can't be interrupted though, so expensive work should be split 
+    /// into steps with EnqueueIncremental(), each step should take a fraction of the budget.
+    /// 
+    /// Work items can be queued from any thread, statistics on queue depth and latency are 
+    /// gathered for each category of work item, the category defaults to the type that 
+    /// declares the method or lambda that's queued.
+    /// </remarks>
+    /// <example>
+    /// WorkQueue.Enqueue(() => RecomputeInventory(), priority: 10);
+    /// WorkQueue.EnqueueIncremental(pathfinder.Step, category: "Pathing");
+    /// </example>
+    public static class WorkQueue
+    {
+        private sealed class WorkItem
+        {
+            public Action Work;
+            // returns true when there's no more work to do
+            public Func<bool> Step;
+            public int Priority;
+            // breaks ties so work items with the same priority run in the order they were queued
+            public long Sequence;
+            public long EnqueueTimestamp;
+            public bool HasStarted;
+            public CancellationToken CancellationToken;
+            public WorkQueueStats Stats;
+
+            public bool RunsBefore(WorkItem other)
+            {
+                return (Priority > other.Priority) ||
+                    ((Priority == other.Priority) && (Sequence < other.Sequence));
+            }
+        }
+
+        private static readonly object _lock = new object();
+        // binary max-heap ordered by priority, protected by _lock
+        private static readonly List<WorkItem> _queue = new List<WorkItem>();
+        private static long _sequence;
+        private static readonly Dictionary<string, WorkQueueStats> _stats = 
+            new Dictionary<string, WorkQueueStats>();
+
+        /// <summary>
+        /// Number of work items currently waiting to run (or to continue).
+        /// </summary>
+        public static int Count
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _queue.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Queue a work item that runs in one go.
+        /// </summary>
+        /// <param name="work">The work to do.</param>
+        /// <param name="priority">Work items with a higher priority run first.</param>
+        /// <param name="category">Category the statistics of the work item are gathered under,
+        /// defaults to the name of the type that declares the work method or lambda.</param>
+        /// <param name="cancellationToken">Work items that are cancelled before they run are 
+        /// dropped from the queue.</param>
+        public static void Enqueue(
+            Action work, int priority = 0, string category = null,
+            CancellationToken cancellationToken = default(CancellationToken)
+        )
+        {
+            if (work == null)
+            {
+                throw new ArgumentNullException("work");
+            }
+            Add(new WorkItem() 
+            { 
+                Work = work, Priority = priority, CancellationToken = cancellationToken 
+            }, category ?? GetDefaultCategory(work));
+        }
+
+        /// <summary>
+        /// Queue a work item that's split into steps, one step is run at a time and the work item
+        /// keeps its place in the queue until a step returns true.
+        /// </summary>
+        /// <param name="step">Does the next bit of work, returns true when all the work is done.</param>
+        /// <param name="priority">Work items with a higher priority run first.</param>
+        /// <param name="category">Category the statistics of the work item are gathered under,
+        /// defaults to the name of the type that declares the step method or lambda.</param>
+        /// <param name="cancellationToken">Work items that are cancelled are dropped from the 
+        /// queue before their next step.</param>
+        public static void EnqueueIncremental(
+            Func<bool> step, int priority = 0, string category = null,
+            CancellationToken cancellationToken = default(CancellationToken)
+        )
+        {
+            if (step == null)
+            {
+                throw new ArgumentNullException("step");
+            }
+            Add(new WorkItem() 
+            { 
+                Step = step, Priority = priority, CancellationToken = cancellationToken 
+            }, category ?? GetDefaultCategory(step));
+        }
+
+        /// <summary>
+        /// Get a snapshot of the statistics gathered for each category of work item.
+        /// </summary>
+        public static WorkQueueStats[] GetStats()
+        {
+            lock (_lock)
+            {
+                var stats = new WorkQueueStats[_stats.Count];
+                int i = 0;
+                foreach (var categoryStats in _stats.Values)
+                {
+                    stats[i++] = categoryStats.Clone();
+                }
+                return stats;
+            }
+        }
+
+        /// <summary>
+        /// Run queued work items until the budget runs out, called by the native side on the game
+        /// thread once per frame.
+        /// </summary>
+        /// <param name="budgetSeconds">Number of seconds the work items can run for.</param>
+        /// <returns>Number of work items left in the queue.</returns>
+        internal static int Run(double budgetSeconds)
+        {
+            long startTimestamp = Stopwatch.GetTimestamp();
+            long budgetTicks = (long)(budgetSeconds * Stopwatch.Frequency);
+            long nowTimestamp = startTimestamp;
+            bool isFirst = true;
+            while (isFirst || ((nowTimestamp - startTimestamp) < budgetTicks))
+            {
+                WorkItem item;
+                lock (_lock)
+                {
+                    if (_queue.Count == 0)
+                    {
+                        return 0;
+                    }
+                    item = _queue[0];
+                    if (item.CancellationToken.IsCancellationRequested)
+                    {
+                        Pop();
+                        --item.Stats.QueueDepth;
+                        ++item.Stats.Cancelled;
+                        continue;
+                    }
+                    if (!item.HasStarted)
+                    {
+                        item.HasStarted = true;
+                        double latency = 
+                            (double)(nowTimestamp - item.EnqueueTimestamp) / Stopwatch.Frequency;
+                        item.Stats.TotalLatency += latency;
+                        item.Stats.MaxLatency = Math.Max(item.Stats.MaxLatency, latency);
+                        ++item.Stats.Started;
+                    }
+                }
+
+                // work items queued while this one runs may have a higher priority, so the
+                // item stays at the top of the heap until it's done and is removed by sequence
+                bool isDone = true;
+                try
+                {
+                    if (item.Work != null)
+                    {
+                        item.Work();
+                    }
+                    else
+                    {
+                        isDone = item.Step();
+                    }
+                }
+                catch (Exception except)
+                {
+                    LogUtils.LogError(except.ToString());
+                }
+                isFirst = false;
+                long endTimestamp = Stopwatch.GetTimestamp();
+
+                lock (_lock)
+                {
+                    item.Stats.TotalRunTime += 
+                        (double)(endTimestamp - nowTimestamp) / Stopwatch.Frequency;
+                    if (isDone)
+                    {
+                        Remove(item);
+                        --item.Stats.QueueDepth;
+                        ++item.Stats.Completed;
+                    }
+                }
+                nowTimestamp = endTimestamp;
+            }
+            return Count;
+        }
+
+        /// <summary>
+        /// Log the statistics gathered for each category of work item.
+        /// </summary>
+        internal static void LogStats()
+        {
+            var stats = GetStats();
+            Array.Sort(stats, (a, b) => string.CompareOrdinal(a.Category, b.Category));
+            var text = new StringBuilder();
+            text.AppendFormat("Work queue: {0} queued", Count);
+            foreach (var categoryStats in stats)
+            {
+                text.AppendLine();
+                text.AppendFormat(
+                    "  {0}: depth {1} (max {2}), queued {3}, completed {4}, cancelled {5}, " +
+                    "latency {6:F2} ms avg / {7:F2} ms max, run time {8:F2} ms",
+                    categoryStats.Category, categoryStats.QueueDepth, categoryStats.MaxQueueDepth,
+                    categoryStats.Enqueued, categoryStats.Completed, categoryStats.Cancelled,
+                    categoryStats.AverageLatency * 1000.0, categoryStats.MaxLatency * 1000.0,
+                    categoryStats.TotalRunTime * 1000.0
+                );
+            }
+            LogUtils.Log(text.ToString());
+        }
+
+        private static string GetDefaultCategory(Delegate work)
+        {
+            // lambdas are compiled into methods of nested compiler generated types, those aren't 
+            // very useful as categories so use the type they're nested in instead
+            var type = work.Method.DeclaringType;
+            while ((type != null) && (type.DeclaringType != null) && 
+                type.IsDefined(typeof(CompilerGeneratedAttribute), false))
+            {
+                type = type.DeclaringType;
+            }
+            return (type != null) ? type.FullName : work.Method.Name;
+        }
+
+        private static void Add(WorkItem item, string category)
+        {
+            item.EnqueueTimestamp = Stopwatch.GetTimestamp();
+            lock (_lock)
+            {
+                WorkQueueStats stats;
+                if (!_stats.TryGetValue(category, out stats))
+                {
+                    stats = new WorkQueueStats(category);
+                    _stats.Add(category, stats);
+                }
+                item.Stats = stats;
+                item.Sequence = _sequence++;
+                ++stats.Enqueued;
+                ++stats.QueueDepth;
+                stats.MaxQueueDepth = Math.Max(stats.MaxQueueDepth, stats.QueueDepth);
+                Push(item);
+            }
+        }
+
+        private static void Push(WorkItem item)
+        {
+            int index = _queue.Count;
+            _queue.Add(item);
+            SiftUp(index, item);
+        }
+
+        private static void Pop()
+        {
+            RemoveAt(0);
+        }
+
+        private static void Remove(WorkItem item)
+        {
+            // the item is usually still at the top, unless something with a higher priority was
+            // queued while it was running
+            int index = (_queue[0] == item) ? 0 : _queue.IndexOf(item);
+            if (index >= 0)
+            {
+                RemoveAt(index);
+            }
+        }
+
+        private static void RemoveAt(int index)
+        {
+            int last = _queue.Count - 1;
+            var item = _queue[last];
+            _queue.RemoveAt(last);
+            if (index < last)
+            {
+                if ((index > 0) && item.RunsBefore(_queue[(index - 1) / 2]))
+                {
+                    SiftUp(index, item);
+                }
+                else
+                {
+                    SiftDown(index, item);
+                }
+            }
+        }
+
+        private static void SiftUp(int index, WorkItem item)
+        {
+            while (index > 0)
+            {
+                int parent = (index - 1) / 2;
+                var parentItem = _queue[parent];
+                if (!item.RunsBefore(parentItem))
+                {
+                    break;
+                }
+                _queue[index] = parentItem;
+                index = parent;
+            }
+            _queue[index] = item;
+        }
+
+        private static void SiftDown(int index, WorkItem item)
+        {
+            int count = _queue.Count;
+            while (true)
+            {
+                int child = index * 2 + 1;
+                if (child >= count)
+                {
+                    break;
+                }
+                var childItem = _queue[child];
+                if (child + 1 < count)
+                {
+                    var rightItem = _queue[child + 1];
+                    if (rightItem.RunsBefore(childItem))
+                    {
+                        ++child;
+                        childItem = rightItem;
+                    }
+                }
+                if (!childItem.RunsBefore(item))
+                {
+                    break;
+                }
+                _queue[index] = childItem;
+                index = child;
+            }
+            _queue[index] = item;
+        }
+    }
+}
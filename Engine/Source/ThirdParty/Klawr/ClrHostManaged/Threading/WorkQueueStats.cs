@@ -0,0 +1,100 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+namespace Klawr.ClrHost.Managed.Threading
+{
+    /// <summary>
+    /// Statistics for one category of work items queued in the WorkQueue.
+    /// </summary>
+    public sealed class WorkQueueStats
+    {
+        internal WorkQueueStats(string category)
+        {
+            Category = category;
+        }
+
+        /// <summary>
+        /// Category the work items were queued under.
+        /// </summary>
+        public string Category { get; private set; }
+
+        /// <summary>
+        /// Number of work items of this category currently waiting to run (or to continue).
+        /// </summary>
+        public int QueueDepth { get; internal set; }
+
+        /// <summary>
+        /// Largest number of work items of this category that were waiting at the same time.
+        /// </summary>
+        public int MaxQueueDepth { get; internal set; }
+
+        /// <summary>
+        /// Total number of work items of this category that have been queued.
+        /// </summary>
+        public long Enqueued { get; internal set; }
+
+        /// <summary>
+        /// Total number of work items of this category that ran to completion.
+        /// </summary>
+        public long Completed { get; internal set; }
+
+        /// <summary>
+        /// Total number of work items of this category that were cancelled before they completed.
+        /// </summary>
+        public long Cancelled { get; internal set; }
+
+        /// <summary>
+        /// Sum of the seconds work items of this category waited before they first ran.
+        /// </summary>
+        public double TotalLatency { get; internal set; }
+
+        /// <summary>
+        /// Longest number of seconds a work item of this category waited before it first ran.
+        /// </summary>
+        public double MaxLatency { get; internal set; }
+
+        /// <summary>
+        /// Sum of the seconds spent running work items of this category.
+        /// </summary>
+        public double TotalRunTime { get; internal set; }
+
+        /// <summary>
+        /// Number of work items of this category that have started running.
+        /// </summary>
+        public long Started { get; internal set; }
+
+        /// <summary>
+        /// Average number of seconds work items of this category waited before they first ran.
+        /// </summary>
+        public double AverageLatency
+        {
+            get { return (Started > 0) ? (TotalLatency / Started) : 0.0; }
+        }
+
+        internal WorkQueueStats Clone()
+        {
+            return (WorkQueueStats)MemberwiseClone();
+        }
+    }
+}
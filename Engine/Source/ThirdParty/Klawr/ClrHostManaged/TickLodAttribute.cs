@@ -0,0 +1,81 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Reduces how often instances of a script component type tick based on their significance.
+    /// </summary>
+    /// <remarks>
+    /// Once per frame the distance from each instance's owner to the nearest player view, and
+    /// whether the owner was recently rendered, are used to select one of the TickLod values for
+    /// every instance in bulk. Script components can override SelectTickLod() to customize that
+    /// selection, and can check their current TickLod property at any time, which is just a
+    /// memory read.
+    /// 
+    /// TickLod.Full is used for instances within NearDistance, TickLod.Reduced for instances 
+    /// within FarDistance, and TickLod.Minimal for the rest. Instances whose owner wasn't 
+    /// recently rendered drop one more level, or are suspended if SuspendWhenNotRendered is set.
+    /// The delta time passed to TickComponent() is always the time elapsed since the previous 
+    /// tick, excluding any time spent suspended.
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+    public sealed class TickLodAttribute : Attribute
+    {
+        /// <summary>
+        /// View distance (in world units) up to which instances tick at full rate.
+        /// </summary>
+        public float NearDistance { get; set; }
+
+        /// <summary>
+        /// View distance (in world units) up to which instances tick at the reduced rate.
+        /// </summary>
+        public float FarDistance { get; set; }
+
+        /// <summary>
+        /// Seconds between ticks at TickLod.Reduced.
+        /// </summary>
+        public float ReducedInterval { get; set; }
+
+        /// <summary>
+        /// Seconds between ticks at TickLod.Minimal.
+        /// </summary>
+        public float MinimalInterval { get; set; }
+
+        /// <summary>
+        /// If true instances stop ticking while their owner isn't rendered.
+        /// </summary>
+        public bool SuspendWhenNotRendered { get; set; }
+
+        public TickLodAttribute()
+        {
+            NearDistance = 2000.0f;
+            FarDistance = 8000.0f;
+            ReducedInterval = 0.1f;
+            MinimalInterval = 0.5f;
+        }
+    }
+}
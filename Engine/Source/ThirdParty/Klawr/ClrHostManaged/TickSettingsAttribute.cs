@@ -0,0 +1,68 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Specifies how instances of a script component type tick by default.
+    /// </summary>
+    /// <example>
+    /// // tick 5 times per second after physics, spread across frames
+    /// [TickSettings(Interval = 0.2f, Group = ScriptTickGroup.PostPhysics)]
+    /// public class Patrol : UKlawrScriptComponent
+    /// </example>
+    /// <remarks>
+    /// The settings can be changed for individual instances at runtime with 
+    /// UKlawrScriptComponent.SetTickInterval() and UKlawrScriptComponent.SetTickGroup().
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Class, Inherited = true, AllowMultiple = false)]
+    public sealed class TickSettingsAttribute : Attribute
+    {
+        /// <summary>
+        /// Seconds between ticks, zero (the default) to tick every frame. The delta time passed
+        /// to TickComponent() is the time elapsed since the previous tick.
+        /// </summary>
+        public float Interval { get; set; }
+
+        /// <summary>
+        /// Tick group to tick in, components that tick concurrently are ticked in batches during
+        /// this tick group.
+        /// </summary>
+        public ScriptTickGroup Group { get; set; }
+
+        /// <summary>
+        /// If true (the default) the first tick of each instance is delayed by a different 
+        /// fraction of the interval, so instances created in the same frame don't all tick in 
+        /// the same frame.
+        /// </summary>
+        public bool Stagger { get; set; }
+
+        public TickSettingsAttribute()
+        {
+            Stagger = true;
+        }
+    }
+}
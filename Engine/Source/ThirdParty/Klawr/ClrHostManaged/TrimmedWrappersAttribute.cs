@@ -0,0 +1,52 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Marks the core Klawr.UnrealEngine assembly of a packaged game whose wrappers were trimmed
+    /// down to the types and members referenced by the game scripts (see WrapperUsageAnalyzer).
+    /// </summary>
+    /// <remarks>
+    /// Looking up a wrapper type by name fails with an exception instead of returning nothing
+    /// when this attribute is present, so the cause of the failure is obvious.
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Assembly, AllowMultiple = false)]
+    public sealed class TrimmedWrappersAttribute : Attribute
+    {
+        /// <summary>
+        /// Name (without the directory) of the file listing the types and members the wrappers 
+        /// were trimmed down to, the path isn't baked in since it's only meaningful on the 
+        /// machine the game was packaged on.
+        /// </summary>
+        public string UsageFilename { get; private set; }
+
+        public TrimmedWrappersAttribute(string usageFilename)
+        {
+            UsageFilename = usageFilename;
+        }
+    }
+}
@@ -32,6 +32,9 @@ namespace Klawr.ClrHost.Managed
     /// <summary>
     /// Writes text to the UE console and log file.
     /// </summary>
+    /// <remarks>Text is buffered until a line feed is written, then the buffered line is queued up
+    /// with LogUtils.Display() (which appends its own line terminator). Console.SetOut() wraps the 
+    /// writer in a synchronized writer, so this class doesn't need to be thread-safe.</remarks>
     internal class UELogWriter : TextWriter
     {
         private StringBuilder _stringBuilder = new StringBuilder();
@@ -64,52 +67,106 @@ namespace Klawr.ClrHost.Managed
         }
 
         /// <summary>
-        /// Output any buffered text if it ends with a line terminator.
+        /// Output the buffered text followed by the given characters (which must not contain a 
+        /// line feed).
         /// </summary>
-        private void FlushOnNewLine()
+        private void EmitLine(string value, int index, int count)
         {
-            // look for the line terminator at the end of the buffered text
-            var terminatorChars = base.NewLine.ToCharArray();
-            int terminatorStart = _stringBuilder.Length - terminatorChars.Length;
-            if (terminatorStart >= 0)
+            // strip away the carriage return of a CRLF line terminator
+            if ((count > 0) && (value[index + count - 1] == '\r'))
             {
-                int terminatorIndex = terminatorChars.Length - 1;
-                for (int i = _stringBuilder.Length - 1; i >= terminatorStart; --i, --terminatorIndex)
-                {
-                    if (_stringBuilder[i] != terminatorChars[terminatorIndex])
-                    {
-                        break;
-                    }
-                    else if (terminatorIndex == 0)
-                    {
-                        // LogUtils.Display() will automatically append a line terminator, 
-                        // so strip away the line terminator that's already there to avoid a blank
-                        // line the user didn't expect
-                        LogUtils.Display(_stringBuilder.ToString(0, terminatorStart));
-                        _stringBuilder.Clear();
-                    }
-                }
+                --count;
+            }
+            if (_stringBuilder.Length == 0)
+            {
+                LogUtils.Display(((index == 0) && (count == value.Length)) ? 
+                    value : value.Substring(index, count)
+                );
+            }
+            else
+            {
+                _stringBuilder.Append(value, index, count);
+                TrimTrailingCarriageReturn();
+                LogUtils.Display(_stringBuilder.ToString());
+                _stringBuilder.Clear();
+            }
+        }
+
+        private void TrimTrailingCarriageReturn()
+        {
+            int length = _stringBuilder.Length;
+            if ((length > 0) && (_stringBuilder[length - 1] == '\r'))
+            {
+                _stringBuilder.Length = length - 1;
             }
         }
 
         /// <summary>
         /// Write out a single character.
         /// </summary>
-        /// <remarks>Output is buffered until a line terminator is encountered.</remarks>
+        /// <remarks>Output is buffered until a line feed is encountered.</remarks>
         public override void Write(char value)
         {
-            _stringBuilder.Append(value);
-            FlushOnNewLine();
+            if (value == '\n')
+            {
+                TrimTrailingCarriageReturn();
+                LogUtils.Display(_stringBuilder.ToString());
+                _stringBuilder.Clear();
+            }
+            else
+            {
+                _stringBuilder.Append(value);
+            }
+        }
+
+        /// <summary>
+        /// Write out a string.
+        /// </summary>
+        /// <remarks>Every complete line is output, any text after the last line feed is buffered.
+        /// </remarks>
+        public override void Write(string value)
+        {
+            if (value == null)
+            {
+                return;
+            }
+            // only the new text needs to be scanned for line feeds
+            int lineStart = 0;
+            int lineEnd;
+            while ((lineEnd = value.IndexOf('\n', lineStart)) >= 0)
+            {
+                EmitLine(value, lineStart, lineEnd - lineStart);
+                lineStart = lineEnd + 1;
+            }
+            if (lineStart < value.Length)
+            {
+                _stringBuilder.Append(value, lineStart, value.Length - lineStart);
+            }
         }
 
         /// <summary>
         /// Write out a range of characters.
         /// </summary>
-        /// <remarks>Output is buffered unless it ends with a line terminator.</remarks>
+        /// <remarks>Every complete line is output, any text after the last line feed is buffered.
+        /// </remarks>
         public override void Write(char[] buffer, int index, int count)
         {
-            _stringBuilder.Append(buffer, index, count);
-            FlushOnNewLine();
+            int lineStart = index;
+            int end = index + count;
+            int lineEnd;
+            while ((lineStart < end) && 
+                ((lineEnd = Array.IndexOf(buffer, '\n', lineStart, end - lineStart)) >= 0))
+            {
+                _stringBuilder.Append(buffer, lineStart, lineEnd - lineStart);
+                TrimTrailingCarriageReturn();
+                LogUtils.Display(_stringBuilder.ToString());
+                _stringBuilder.Clear();
+                lineStart = lineEnd + 1;
+            }
+            if (lineStart < end)
+            {
+                _stringBuilder.Append(buffer, lineStart, end - lineStart);
+            }
         }
 
         /// <summary>
@@ -129,6 +186,12 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public override void WriteLine(string value)
         {
+            // the common case of a single line can be output without copying it
+            if ((_stringBuilder.Length == 0) && (value != null) && (value.IndexOf('\n') < 0))
+            {
+                EmitLine(value, 0, value.Length);
+                return;
+            }
             Write(value);
             WriteLine();
         }
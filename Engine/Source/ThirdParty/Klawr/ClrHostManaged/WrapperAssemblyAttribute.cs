@@ -0,0 +1,52 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Names an assembly containing the wrappers of one or more UE4 modules.
+    /// </summary>
+    /// <remarks>
+    /// The code generator splits the wrappers between one assembly per module (modules that 
+    /// depend on each other share an assembly), only the core Klawr.UnrealEngine assembly is 
+    /// loaded when an engine app domain is created, and it lists all the other wrapper assemblies 
+    /// with this attribute. The rest are loaded by the CLR when a type in them is first used, or 
+    /// by the app domain manager when a type can't be found by name in any loaded assembly.
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Assembly, AllowMultiple = true)]
+    public sealed class WrapperAssemblyAttribute : Attribute
+    {
+        /// <summary>
+        /// Name of the wrapper assembly (without a file extension).
+        /// </summary>
+        public string AssemblyName { get; private set; }
+
+        public WrapperAssemblyAttribute(string assemblyName)
+        {
+            AssemblyName = assemblyName;
+        }
+    }
+}
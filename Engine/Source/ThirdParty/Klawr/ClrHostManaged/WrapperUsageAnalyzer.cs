@@ -0,0 +1,407 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.CodeDom.Compiler;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Reflection.Emit;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Finds the wrapper types and members referenced by script assemblies.
+    /// </summary>
+    /// <remarks>
+    /// The IL of every method in the script assemblies is scanned for references to members of
+    /// types in the Klawr.UnrealEngine wrapper assemblies, along with the signatures, fields, 
+    /// properties, local variables, base types and implemented interfaces of the script types, the
+    /// types and arguments of the custom attributes applied to the script types and their members,
+    /// and the wrapper methods overridden by script methods. The result is written out as a list of
+    /// names, one per line: "AActor" for a type, "AActor.K2_DestroyActor" for a method, and 
+    /// "AActor.bHidden" for a property (property accessors are recorded under the property name).
+    /// The base types of every referenced wrapper type are always included.
+    /// 
+    /// The code generator uses this list to trim the wrappers when a game is packaged, since the
+    /// classes copied from the wrapper project template are compiled along with the trimmed 
+    /// wrappers whatever they reference must be included too (see AnalyzeTemplateTypes()).
+    /// </remarks>
+    public sealed class WrapperUsageAnalyzer
+    {
+        private const string WrapperAssemblyName = "Klawr.UnrealEngine";
+        private const BindingFlags DeclaredMembers = 
+            BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | 
+            BindingFlags.Static | BindingFlags.DeclaredOnly;
+
+        // all single and double byte IL opcodes, indexed by their value
+        private static readonly OpCode[] _singleByteOpCodes = new OpCode[0x100];
+        private static readonly OpCode[] _doubleByteOpCodes = new OpCode[0x100];
+
+        private readonly SortedSet<string> _usedNames = new SortedSet<string>(StringComparer.Ordinal);
+        private readonly HashSet<Type> _visitedTypes = new HashSet<Type>();
+
+        static WrapperUsageAnalyzer()
+        {
+            foreach (var field in typeof(OpCodes).GetFields(BindingFlags.Public | BindingFlags.Static))
+            {
+                var opCode = (OpCode)field.GetValue(null);
+                var value = (ushort)opCode.Value;
+                if (opCode.Size == 1)
+                {
+                    _singleByteOpCodes[value] = opCode;
+                }
+                else
+                {
+                    _doubleByteOpCodes[value & 0xFF] = opCode;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Names of all the wrapper types and members referenced so far.
+        /// </summary>
+        public IEnumerable<string> UsedNames
+        {
+            get { return _usedNames; }
+        }
+
+        /// <summary>
+        /// Check if an assembly is one of the generated wrapper assemblies.
+        /// </summary>
+        public static bool IsWrapperAssembly(Assembly assembly)
+        {
+            var name = assembly.GetName().Name;
+            return name.Equals(WrapperAssemblyName) || name.StartsWith(WrapperAssemblyName + ".");
+        }
+
+        /// <summary>
+        /// Find the wrapper types and members referenced by all the types in an assembly.
+        /// </summary>
+        public void AnalyzeAssembly(Assembly assembly)
+        {
+            AddAttributes(assembly.GetCustomAttributesData());
+            foreach (var type in assembly.GetTypes())
+            {
+                AnalyzeType(type);
+            }
+        }
+
+        /// <summary>
+        /// Find the wrapper types and members referenced by the hand-written types in a wrapper
+        /// assembly (i.e. the ones copied from the wrapper project template), the code generator
+        /// marks all the types it generates with GeneratedCodeAttribute.
+        /// </summary>
+        public void AnalyzeTemplateTypes(Assembly wrapperAssembly)
+        {
+            foreach (var type in wrapperAssembly.GetTypes())
+            {
+                if (!IsGeneratedType(type))
+                {
+                    AnalyzeType(type);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Write out the names of the referenced wrapper types and members, one per line.
+        /// </summary>
+        public void Write(TextWriter writer)
+        {
+            foreach (var name in _usedNames)
+            {
+                writer.WriteLine(name);
+            }
+        }
+
+        private static bool IsGeneratedType(Type type)
+        {
+            // nested types (e.g. delegates and compiler generated closures) belong to whatever
+            // type they're nested in
+            for (; type != null; type = type.DeclaringType)
+            {
+                if (type.IsDefined(typeof(GeneratedCodeAttribute), false))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        private void AnalyzeType(Type type)
+        {
+            AddType(type.BaseType);
+            foreach (var implementedInterface in type.GetInterfaces())
+            {
+                AddInterface(implementedInterface);
+            }
+            AddAttributes(type.GetCustomAttributesData());
+            foreach (var field in type.GetFields(DeclaredMembers))
+            {
+                AddType(field.FieldType);
+                AddAttributes(field.GetCustomAttributesData());
+            }
+            foreach (var property in type.GetProperties(DeclaredMembers))
+            {
+                // the accessors are analyzed along with the rest of the methods
+                AddType(property.PropertyType);
+                AddAttributes(property.GetCustomAttributesData());
+            }
+            foreach (var evt in type.GetEvents(DeclaredMembers))
+            {
+                AddType(evt.EventHandlerType);
+                AddAttributes(evt.GetCustomAttributesData());
+            }
+            foreach (var method in type.GetMethods(DeclaredMembers))
+            {
+                AddType(method.ReturnType);
+                AddAttributes(method.ReturnParameter.GetCustomAttributesData());
+                AddOverriddenMethods(method);
+                AnalyzeMethod(method);
+            }
+            foreach (var constructor in type.GetConstructors(DeclaredMembers))
+            {
+                AnalyzeMethod(constructor);
+            }
+        }
+
+        private void AnalyzeMethod(MethodBase method)
+        {
+            AddAttributes(method.GetCustomAttributesData());
+            foreach (var param in method.GetParameters())
+            {
+                AddType(param.ParameterType);
+                AddAttributes(param.GetCustomAttributesData());
+            }
+
+            var body = method.GetMethodBody();
+            if (body == null)
+            {
+                return;
+            }
+            foreach (var local in body.LocalVariables)
+            {
+                AddType(local.LocalType);
+            }
+
+            var il = body.GetILAsByteArray();
+            var typeArgs = method.DeclaringType.IsGenericType ? 
+                method.DeclaringType.GetGenericArguments() : null;
+            var methodArgs = method.IsGenericMethod ? method.GetGenericArguments() : null;
+
+            int offset = 0;
+            while (offset < il.Length)
+            {
+                OpCode opCode;
+                if (il[offset] == 0xFE)
+                {
+                    opCode = _doubleByteOpCodes[il[offset + 1]];
+                    offset += 2;
+                }
+                else
+                {
+                    opCode = _singleByteOpCodes[il[offset]];
+                    offset += 1;
+                }
+
+                switch (opCode.OperandType)
+                {
+                    case OperandType.InlineField:
+                    case OperandType.InlineMethod:
+                    case OperandType.InlineTok:
+                    case OperandType.InlineType:
+                        var token = BitConverter.ToInt32(il, offset);
+                        AddMember(method.Module.ResolveMember(token, typeArgs, methodArgs));
+                        offset += 4;
+                        break;
+                    case OperandType.InlineNone:
+                        break;
+                    case OperandType.ShortInlineBrTarget:
+                    case OperandType.ShortInlineI:
+                    case OperandType.ShortInlineVar:
+                        offset += 1;
+                        break;
+                    case OperandType.InlineVar:
+                        offset += 2;
+                        break;
+                    case OperandType.InlineI8:
+                    case OperandType.InlineR:
+                        offset += 8;
+                        break;
+                    case OperandType.InlineSwitch:
+                        var numTargets = BitConverter.ToInt32(il, offset);
+                        offset += 4 + (numTargets * 4);
+                        break;
+                    default:
+                        offset += 4;
+                        break;
+                }
+            }
+        }
+
+        private void AddInterface(Type implementedInterface)
+        {
+            AddType(implementedInterface);
+            if (!IsWrapperAssembly(implementedInterface.Assembly))
+            {
+                return;
+            }
+            // a script type has to implement every member of the interface, so they must all be
+            // kept even if the scripts never call them
+            foreach (var member in implementedInterface.GetMembers())
+            {
+                AddMember(member);
+            }
+        }
+
+        /// <summary>
+        /// Add the wrapper methods a script method overrides, an override only compiles if the 
+        /// overridden method still exists.
+        /// </summary>
+        private void AddOverriddenMethods(MethodInfo method)
+        {
+            var baseDefinition = method.GetBaseDefinition();
+            if (!method.IsVirtual || (baseDefinition.DeclaringType == method.DeclaringType))
+            {
+                return;
+            }
+            AddMember(baseDefinition);
+
+            // any wrapper types in between may override the method too
+            var paramTypes = method.GetParameters().Select(param => param.ParameterType).ToArray();
+            var baseType = method.DeclaringType.BaseType;
+            for (; baseType != null; baseType = baseType.BaseType)
+            {
+                if (IsWrapperAssembly(baseType.Assembly))
+                {
+                    var baseMethod = baseType.GetMethod(
+                        method.Name, DeclaredMembers, null, paramTypes, null
+                    );
+                    if ((baseMethod != null) && baseMethod.IsVirtual)
+                    {
+                        AddMember(baseMethod);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Add the types of custom attributes, and any types or wrapper members their arguments 
+        /// refer to (e.g. typeof(AActor) or an enum value of a wrapper enum).
+        /// </summary>
+        private void AddAttributes(IEnumerable<CustomAttributeData> attributes)
+        {
+            foreach (var attribute in attributes)
+            {
+                AddMember(attribute.Constructor);
+                foreach (var arg in attribute.ConstructorArguments)
+                {
+                    AddAttributeArgument(arg);
+                }
+                foreach (var namedArg in attribute.NamedArguments)
+                {
+                    AddMember(namedArg.MemberInfo);
+                    AddAttributeArgument(namedArg.TypedValue);
+                }
+            }
+        }
+
+        private void AddAttributeArgument(CustomAttributeTypedArgument arg)
+        {
+            AddType(arg.ArgumentType);
+            var typeValue = arg.Value as Type;
+            if (typeValue != null)
+            {
+                AddType(typeValue);
+                return;
+            }
+            // array arguments are stored as a collection of typed arguments
+            var elements = arg.Value as IEnumerable<CustomAttributeTypedArgument>;
+            if (elements != null)
+            {
+                foreach (var element in elements)
+                {
+                    AddAttributeArgument(element);
+                }
+            }
+        }
+
+        private void AddMember(MemberInfo member)
+        {
+            var type = member as Type;
+            if (type != null)
+            {
+                AddType(type);
+                return;
+            }
+
+            var declaringType = member.DeclaringType;
+            AddType(declaringType);
+            if ((declaringType == null) || !IsWrapperAssembly(declaringType.Assembly))
+            {
+                return;
+            }
+
+            var memberName = member.Name;
+            var method = member as MethodInfo;
+            if ((method != null) && method.IsSpecialName && 
+                (memberName.StartsWith("get_") || memberName.StartsWith("set_")))
+            {
+                // the wrappers expose properties, the accessors are an implementation detail
+                memberName = memberName.Substring(4);
+            }
+            _usedNames.Add(declaringType.Name + "." + memberName);
+        }
+
+        private void AddType(Type type)
+        {
+            if ((type == null) || !_visitedTypes.Add(type))
+            {
+                return;
+            }
+
+            if (type.HasElementType)
+            {
+                // arrays, pointers, and by-ref parameters
+                AddType(type.GetElementType());
+            }
+            else if (type.IsGenericType)
+            {
+                // e.g. ArrayList<AActor>
+                foreach (var typeArg in type.GetGenericArguments())
+                {
+                    AddType(typeArg);
+                }
+            }
+            else if (!type.IsGenericParameter && IsWrapperAssembly(type.Assembly))
+            {
+                _usedNames.Add(type.Name);
+                // the wrapper class hierarchy mirrors the native one, so the base types must be
+                // kept too
+                AddType(type.BaseType);
+            }
+        }
+    }
+}
@@ -22,6 +22,7 @@
 // SOFTWARE.
 //
 
+using Klawr.ClrHost.Managed.Collections;
 using Klawr.ClrHost.Managed.SafeHandles;
 using Klawr.UnrealEngine;
 using System;
@@ -49,7 +50,7 @@ namespace Klawr.ClrHost.Managed
 
         public static string GetString(ArrayHandle arrayHandle, Int32 index)
         {
-            return _proxy.GetString(arrayHandle, index);
+            return _proxy.GetString(arrayHandle, index).ToString();
         }
 
         public static FScriptName GetName(ArrayHandle arrayHandle, Int32 index)
@@ -157,6 +158,125 @@ namespace Klawr.ClrHost.Managed
             _proxy.RemoveAt(arrayHandle, index);
         }
 
+        public static Int32 AddDefaulted(ArrayHandle arrayHandle, Int32 count)
+        {
+            return _proxy.AddDefaulted(arrayHandle, count);
+        }
+
+        public static void InsertDefaulted(ArrayHandle arrayHandle, Int32 index, Int32 count)
+        {
+            _proxy.InsertDefaulted(arrayHandle, index, count);
+        }
+
+        public static Int32 AppendRaw(ArrayHandle arrayHandle, IntPtr items, Int32 count)
+        {
+            return _proxy.AppendRaw(arrayHandle, items, count);
+        }
+
+        public static void InsertRaw(ArrayHandle arrayHandle, Int32 index, IntPtr items, Int32 count)
+        {
+            _proxy.InsertRaw(arrayHandle, index, items, count);
+        }
+
+        public static void RemoveRange(ArrayHandle arrayHandle, Int32 index, Int32 count)
+        {
+            _proxy.RemoveRange(arrayHandle, index, count);
+        }
+
+        public static void Reserve(ArrayHandle arrayHandle, Int32 capacity)
+        {
+            _proxy.Reserve(arrayHandle, capacity);
+        }
+
+        public static void SetFloatAt(ArrayHandle arrayHandle, Int32 index, float item)
+        {
+            _proxy.SetFloatAt(arrayHandle, index, item);
+        }
+
+        public static void SetVectorAt(ArrayHandle arrayHandle, Int32 index, FVector item)
+        {
+            _proxy.SetVectorAt(arrayHandle, index, item);
+        }
+
+        public static Int32 FindFloat(ArrayHandle arrayHandle, float item)
+        {
+            return _proxy.FindFloat(arrayHandle, item);
+        }
+
+        public static Int32 FindVector(ArrayHandle arrayHandle, FVector item)
+        {
+            return _proxy.FindVector(arrayHandle, item);
+        }
+
+        public static Int64 SumInt32(ArrayHandle arrayHandle)
+        {
+            return _proxy.SumInt32(arrayHandle);
+        }
+
+        public static float SumFloat(ArrayHandle arrayHandle)
+        {
+            return _proxy.SumFloat(arrayHandle);
+        }
+
+        public static FVector SumVector(ArrayHandle arrayHandle)
+        {
+            return _proxy.SumVector(arrayHandle);
+        }
+
+        public static bool MinMaxInt32(ArrayHandle arrayHandle, out Int32 min, out Int32 max)
+        {
+            return _proxy.MinMaxInt32(arrayHandle, out min, out max);
+        }
+
+        public static bool MinMaxFloat(ArrayHandle arrayHandle, out float min, out float max)
+        {
+            return _proxy.MinMaxFloat(arrayHandle, out min, out max);
+        }
+
+        public static bool MinMaxVector(ArrayHandle arrayHandle, out FVector min, out FVector max)
+        {
+            return _proxy.MinMaxVector(arrayHandle, out min, out max);
+        }
+
+        public static void SortInt32(ArrayHandle arrayHandle)
+        {
+            _proxy.SortInt32(arrayHandle);
+        }
+
+        public static void SortFloat(ArrayHandle arrayHandle)
+        {
+            _proxy.SortFloat(arrayHandle);
+        }
+
+        public static Int32 CountInt32(
+            ArrayHandle arrayHandle, ArrayComparison comparison, Int32 value
+        )
+        {
+            return _proxy.CountInt32(arrayHandle, comparison, value);
+        }
+
+        public static Int32 CountFloat(
+            ArrayHandle arrayHandle, ArrayComparison comparison, float value
+        )
+        {
+            return _proxy.CountFloat(arrayHandle, comparison, value);
+        }
+
+        public static Int32 FindNearestVector(ArrayHandle arrayHandle, FVector point)
+        {
+            return _proxy.FindNearestVector(arrayHandle, point);
+        }
+
+        public static bool SetLookupIndexEnabled(ArrayHandle arrayHandle, bool enabled)
+        {
+            return _proxy.SetLookupIndexEnabled(arrayHandle, enabled);
+        }
+
+        public static void InvalidateLookupIndex(ArrayHandle arrayHandle)
+        {
+            _proxy.InvalidateLookupIndex(arrayHandle);
+        }
+
         public static void Destroy(IntPtr arrayHandle)
         {
             _proxy.Destroy(arrayHandle);
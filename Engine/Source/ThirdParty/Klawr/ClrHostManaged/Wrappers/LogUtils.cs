@@ -23,19 +23,60 @@
 //
 
 using Klawr.ClrHost.Interfaces;
+using System;
+using System.Runtime.InteropServices;
 
 namespace Klawr.ClrHost.Managed
 {
     /// <summary>
     /// Logging functions that output text to the UE console and log file.
     /// </summary>
-    public class LogUtils
+    /// <remarks>
+    /// With the exception of fatal errors messages are not printed immediately, instead they're 
+    /// queued up and then printed in batches when native code calls Flush() (at least once per 
+    /// frame), or when the queue fills up. This way a burst of log messages only costs a couple
+    /// of transitions to native code instead of one per message, and messages can be logged from
+    /// any thread.
+    /// </remarks>
+    public unsafe class LogUtils
     {
         private static LogUtilsProxy _proxy;
+        // Current verbosity of the native log category, native code updates it whenever the 
+        // verbosity changes. Until the native location is bound nothing can be logged, so it
+        // points to a default that suppresses everything.
+        private static int* _verbosity = CreateDefaultVerbosity();
+
+        // must be a power of two
+        private const int QueueCapacity = 4096;
+        private const int MaxBatchRecords = 256;
+
+        private static readonly LogQueue _queue = new LogQueue(QueueCapacity);
+        // only one thread can drain the queue at a time
+        private static readonly object _flushLock = new object();
+        // verbosity and length of each message in a batch
+        private static readonly int[] _batchRecords = new int[MaxBatchRecords * 2];
+        // null-terminated text of each message in a batch
+        private static char[] _batchText = new char[16 * 1024];
 
         internal LogUtils(ref LogUtilsProxy proxy)
         {
             _proxy = proxy;
+            if (proxy.Verbosity != IntPtr.Zero)
+            {
+                _verbosity = (int*)proxy.Verbosity;
+            }
+            // print whatever is still queued up before the app domain goes away
+            AppDomain.CurrentDomain.DomainUnload += (sender, args) => Flush();
+        }
+
+        /// <summary>
+        /// Check if messages of the given verbosity will be printed.
+        /// </summary>
+        /// <remarks>This is just a memory read, so use it to avoid formatting messages that would 
+        /// be discarded anyway.</remarks>
+        public static bool IsLogEnabled(LogVerbosity verbosity)
+        {
+            return (int)verbosity <= *_verbosity;
         }
 
         /// <summary>
@@ -43,6 +84,8 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void LogFatalError(string text)
         {
+            // print any queued messages first since they may help explain the error
+            Flush();
             if (_proxy.LogFatalError != null)
             {
                 _proxy.LogFatalError(text);
@@ -54,9 +97,9 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void LogError(string text)
         {
-            if (_proxy.LogError != null)
+            if (IsLogEnabled(LogVerbosity.Error))
             {
-                _proxy.LogError(text);
+                Enqueue(LogVerbosity.Error, text);
             }
         }
 
@@ -65,9 +108,9 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void LogWarning(string text)
         {
-            if (_proxy.LogWarning != null)
+            if (IsLogEnabled(LogVerbosity.Warning))
             {
-                _proxy.LogWarning(text);
+                Enqueue(LogVerbosity.Warning, text);
             }
         }
 
@@ -76,9 +119,9 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void Display(string text)
         {
-            if (_proxy.Display != null)
+            if (IsLogEnabled(LogVerbosity.Display))
             {
-                _proxy.Display(text);
+                Enqueue(LogVerbosity.Display, text);
             }
         }
 
@@ -87,9 +130,9 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void Log(string text)
         {
-            if (_proxy.Log != null)
+            if (IsLogEnabled(LogVerbosity.Log))
             {
-                _proxy.Log(text);
+                Enqueue(LogVerbosity.Log, text);
             }
         }
 
@@ -98,9 +141,9 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void LogVerbose(string text)
         {
-            if (_proxy.LogVerbose != null)
+            if (IsLogEnabled(LogVerbosity.Verbose))
             {
-                _proxy.LogVerbose(text);
+                Enqueue(LogVerbosity.Verbose, text);
             }
         }
 
@@ -109,9 +152,87 @@ namespace Klawr.ClrHost.Managed
         /// </summary>
         public static void LogVeryVerbose(string text)
         {
-            if (_proxy.LogVeryVerbose != null)
+            if (IsLogEnabled(LogVerbosity.VeryVerbose))
+            {
+                Enqueue(LogVerbosity.VeryVerbose, text);
+            }
+        }
+
+        /// <summary>
+        /// Print all queued messages.
+        /// </summary>
+        public static void Flush()
+        {
+            if (_proxy.LogBatch == null)
+            {
+                return;
+            }
+
+            lock (_flushLock)
+            {
+                int numRecords = 0;
+                int textLength = 0;
+                LogVerbosity verbosity;
+                string message;
+                while (_queue.TryDequeue(out verbosity, out message))
+                {
+                    int requiredLength = textLength + message.Length + 1;
+                    if ((numRecords == MaxBatchRecords) || (requiredLength > _batchText.Length))
+                    {
+                        if (numRecords > 0)
+                        {
+                            SendBatch(numRecords);
+                            numRecords = 0;
+                            textLength = 0;
+                            requiredLength = message.Length + 1;
+                        }
+                        if (requiredLength > _batchText.Length)
+                        {
+                            _batchText = new char[Math.Max(requiredLength, _batchText.Length * 2)];
+                        }
+                    }
+                    _batchRecords[numRecords * 2] = (int)verbosity;
+                    _batchRecords[numRecords * 2 + 1] = message.Length;
+                    message.CopyTo(0, _batchText, textLength, message.Length);
+                    _batchText[requiredLength - 1] = '\0';
+                    textLength = requiredLength;
+                    ++numRecords;
+                }
+                if (numRecords > 0)
+                {
+                    SendBatch(numRecords);
+                }
+            }
+        }
+
+        private static void Enqueue(LogVerbosity verbosity, string text)
+        {
+            if (_proxy.LogBatch == null)
+            {
+                return;
+            }
+            // when the queue fills up faster than native code drains it the thread that's doing 
+            // the logging has to drain it instead, messages are never dropped
+            while (!_queue.TryEnqueue(verbosity, text ?? string.Empty))
+            {
+                Flush();
+            }
+        }
+
+        private static int* CreateDefaultVerbosity()
+        {
+            // deliberately leaked, it's only a few bytes per app domain
+            var verbosity = (int*)Marshal.AllocHGlobal(sizeof(int));
+            *verbosity = (int)LogVerbosity.NoLogging;
+            return verbosity;
+        }
+
+        private static void SendBatch(int numRecords)
+        {
+            fixed (int* records = _batchRecords)
+            fixed (char* text = _batchText)
             {
-                _proxy.LogVeryVerbose(text);
+                _proxy.LogBatch((IntPtr)records, numRecords, (IntPtr)text);
             }
         }
     }
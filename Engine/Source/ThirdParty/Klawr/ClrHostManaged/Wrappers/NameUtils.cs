@@ -0,0 +1,188 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using Klawr.UnrealEngine;
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Threading;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Managed copy of the native FName table.
+    /// </summary>
+    /// <remarks>
+    /// Native name table entries are never removed or modified once added, so the strings can be
+    /// cached for the lifetime of the app domain. Entries are copied from native code in chunks 
+    /// the first time any name in a chunk is converted to a string, after that converting a name 
+    /// to a string doesn't leave managed code.
+    /// </remarks>
+    internal class NameUtils
+    {
+        private static NameUtilsProxy _proxy;
+
+        // number of name table entries fetched from native code at once, must be a power of two
+        private const int ChunkSize = 256;
+        // large enough to hold at least one name of the maximum length (NAME_SIZE)
+        private const int BufferLength = 16 * 1024;
+
+        private static readonly object _lock = new object();
+        // chunks are only ever added (under the lock), so lookups don't need to lock
+        private static string[][] _chunks = new string[0][];
+        private static readonly char[] _buffer = new char[BufferLength];
+        private static readonly int[] _lengths = new int[ChunkSize];
+        private static readonly Dictionary<string, FScriptName> _names = 
+            new Dictionary<string, FScriptName>(StringComparer.Ordinal);
+
+        internal NameUtils(ref NameUtilsProxy proxy)
+        {
+            _proxy = proxy;
+        }
+
+        /// <summary>
+        /// Get the string representation of a name (including the number suffix, if any).
+        /// </summary>
+        public static string GetString(FScriptName name)
+        {
+            string plainString = GetPlainString(name.DisplayIndex);
+            if (name.Number == 0)
+            {
+                return plainString;
+            }
+            // internally name numbers are offset by one so that zero means "no number"
+            return plainString + "_" + (name.Number - 1).ToString(CultureInfo.InvariantCulture);
+        }
+
+        /// <summary>
+        /// Find or add the name matching the given string.
+        /// </summary>
+        public static FScriptName MakeName(string name)
+        {
+            if (name == null)
+            {
+                throw new ArgumentNullException("name");
+            }
+            lock (_lock)
+            {
+                FScriptName result;
+                if (!_names.TryGetValue(name, out result))
+                {
+                    result = _proxy.MakeName(name);
+                    _names.Add(name, result);
+                }
+                return result;
+            }
+        }
+
+        /// <summary>
+        /// Get the string of a name table entry (without a number suffix).
+        /// </summary>
+        private static string GetPlainString(int index)
+        {
+            if (index < 0)
+            {
+                throw new ArgumentOutOfRangeException("index");
+            }
+            string[][] chunks = Volatile.Read(ref _chunks);
+            int chunkIndex = index / ChunkSize;
+            if (chunkIndex < chunks.Length)
+            {
+                string[] chunk = chunks[chunkIndex];
+                if (chunk != null)
+                {
+                    string value = chunk[index & (ChunkSize - 1)];
+                    if (value != null)
+                    {
+                        return value;
+                    }
+                }
+            }
+            string result = FetchChunk(chunkIndex)[index & (ChunkSize - 1)];
+            if (result == null)
+            {
+                throw new ArgumentOutOfRangeException("index", "No such entry in the name table.");
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Copy a chunk of name table entries from native code.
+        /// </summary>
+        private static unsafe string[] FetchChunk(int chunkIndex)
+        {
+            lock (_lock)
+            {
+                string[][] chunks = _chunks;
+                if (chunkIndex >= chunks.Length)
+                {
+                    var newChunks = new string[chunkIndex + 1][];
+                    Array.Copy(chunks, newChunks, chunks.Length);
+                    chunks = newChunks;
+                }
+                string[] chunk = chunks[chunkIndex];
+                if (chunk == null)
+                {
+                    chunk = new string[ChunkSize];
+                    chunks[chunkIndex] = chunk;
+                }
+
+                // entries that were missing when the chunk was last fetched may have been added 
+                // since then, so the whole chunk is fetched again
+                int numFetched = 0;
+                fixed (char* buffer = _buffer)
+                fixed (int* lengths = _lengths)
+                {
+                    while (numFetched < ChunkSize)
+                    {
+                        int count = _proxy.GetNameEntries(
+                            chunkIndex * ChunkSize + numFetched, ChunkSize - numFetched,
+                            (IntPtr)buffer, BufferLength, (IntPtr)lengths
+                        );
+                        if (count == 0)
+                        {
+                            break;
+                        }
+                        int offset = 0;
+                        for (int i = 0; i < count; ++i)
+                        {
+                            int length = lengths[i];
+                            if (length >= 0)
+                            {
+                                if (chunk[numFetched + i] == null)
+                                {
+                                    chunk[numFetched + i] = new string(buffer, offset, length);
+                                }
+                                offset += length;
+                            }
+                        }
+                        numFetched += count;
+                    }
+                }
+                Volatile.Write(ref _chunks, chunks);
+                return chunk;
+            }
+        }
+    }
+}
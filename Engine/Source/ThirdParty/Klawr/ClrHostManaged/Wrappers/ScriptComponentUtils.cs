@@ -0,0 +1,96 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using Klawr.ClrHost.Managed.SafeHandles;
+using System;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Controls how script components tick, used by UKlawrScriptComponent.
+    /// </summary>
+    public class ScriptComponentUtils
+    {
+        private static ScriptComponentUtilsProxy _proxy;
+
+        internal ScriptComponentUtils(ref ScriptComponentUtilsProxy proxy)
+        {
+            _proxy = proxy;
+        }
+
+        /// <summary>
+        /// Set the number of seconds between ticks of a script component.
+        /// </summary>
+        /// <param name="component">Native UKlawrScriptComponent instance.</param>
+        /// <param name="interval">Seconds between ticks, zero to tick every frame.</param>
+        /// <param name="stagger">true to delay the first tick by a fraction of the interval, so
+        /// that components that share the same interval don't all tick in the same frame.</param>
+        public static void SetTickInterval(UObjectHandle component, float interval, bool stagger)
+        {
+            _proxy.SetTickInterval(component, interval, stagger);
+        }
+
+        /// <summary>
+        /// Set the tick group of a script component, this has no effect on components that tick 
+        /// concurrently.
+        /// </summary>
+        public static void SetTickGroup(UObjectHandle component, ScriptTickGroup tickGroup)
+        {
+            _proxy.SetTickGroup(component, (int)tickGroup);
+        }
+
+        /// <summary>
+        /// Stop ticking a script component until Wake() is called.
+        /// </summary>
+        public static void Sleep(UObjectHandle component)
+        {
+            _proxy.Sleep(component);
+        }
+
+        /// <summary>
+        /// Resume ticking a script component that was put to sleep.
+        /// </summary>
+        public static void Wake(UObjectHandle component)
+        {
+            _proxy.Wake(component);
+        }
+
+        /// <summary>
+        /// Check if a script component was put to sleep.
+        /// </summary>
+        public static bool IsSleeping(UObjectHandle component)
+        {
+            return _proxy.IsSleeping(component);
+        }
+
+        /// <summary>
+        /// Get the address the current TickLod of a script component is stored at, the address
+        /// remains valid for the lifetime of the script component.
+        /// </summary>
+        public static IntPtr GetTickLodAddress(UObjectHandle component)
+        {
+            return _proxy.GetTickLodAddress(component);
+        }
+    }
+}
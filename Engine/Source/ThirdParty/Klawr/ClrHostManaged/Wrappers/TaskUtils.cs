@@ -0,0 +1,82 @@
+﻿//
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Klawr.ClrHost.Managed
+{
+    /// <summary>
+    /// Runs work items on engine worker threads, used by EngineTaskScheduler.
+    /// </summary>
+    internal class TaskUtils
+    {
+        /// <summary>
+        /// Native signature of the callback a queued work item calls.
+        /// </summary>
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public delegate void WorkCallback(IntPtr context);
+
+        private static TaskUtilsProxy _proxy;
+
+        internal TaskUtils(ref TaskUtilsProxy proxy)
+        {
+            _proxy = proxy;
+        }
+
+        /// <summary>
+        /// Queue a work item that will call the given callback on an engine worker thread.
+        /// </summary>
+        /// <param name="callback">Function pointer obtained from a WorkCallback delegate, the
+        /// delegate must be kept alive until the callback has been called.</param>
+        /// <param name="context">Passed through to the callback.</param>
+        /// <returns>true if the work item was queued, false if it couldn't be (e.g. because the
+        /// engine is shutting down) in which case the callback will never be called.</returns>
+        public static bool QueueWork(IntPtr callback, IntPtr context)
+        {
+            return (_proxy.QueueWork != null) && _proxy.QueueWork(callback, context);
+        }
+
+        /// <summary>
+        /// Get the number of engine worker threads that may run work items concurrently.
+        /// </summary>
+        public static int GetNumWorkerThreads()
+        {
+            return (_proxy.GetNumWorkerThreads != null) ? _proxy.GetNumWorkerThreads() : 1;
+        }
+
+        /// <summary>
+        /// Stop queued work items that haven't started yet from calling the given callback, and
+        /// wait for the ones that already have to return.
+        /// </summary>
+        /// <param name="callback">Function pointer previously passed to QueueWork().</param>
+        public static void CancelWork(IntPtr callback)
+        {
+            if (_proxy.CancelWork != null)
+            {
+                _proxy.CancelWork(callback);
+            }
+        }
+    }
+}
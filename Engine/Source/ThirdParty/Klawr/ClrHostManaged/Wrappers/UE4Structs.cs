@@ -1,4 +1,6 @@
-﻿using System.Runtime.InteropServices;
+﻿using Klawr.ClrHost.Managed;
+using System;
+using System.Runtime.InteropServices;
 
 namespace Klawr.UnrealEngine
 {
@@ -60,10 +62,57 @@ namespace Klawr.UnrealEngine
     }
 
     [StructLayout(LayoutKind.Sequential)]
-    public struct FScriptName
+    public struct FScriptName : IEquatable<FScriptName>
     {
         public int ComparisonIndex;
         public int DisplayIndex;
         public uint Number;
+
+        /// <summary>
+        /// Find or add the name matching the given string.
+        /// </summary>
+        /// <remarks>Strings that have been converted before are looked up in a managed cache, 
+        /// so only the first conversion of any particular string calls into native code.</remarks>
+        public static FScriptName FromString(string name)
+        {
+            return NameUtils.MakeName(name);
+        }
+
+        /// <summary>
+        /// Compare two names, like FName comparisons this ignores case.
+        /// </summary>
+        public bool Equals(FScriptName other)
+        {
+            return (ComparisonIndex == other.ComparisonIndex) && (Number == other.Number);
+        }
+
+        public override bool Equals(object obj)
+        {
+            return (obj is FScriptName) && Equals((FScriptName)obj);
+        }
+
+        public override int GetHashCode()
+        {
+            return ComparisonIndex ^ (int)(Number << 16);
+        }
+
+        public static bool operator ==(FScriptName a, FScriptName b)
+        {
+            return a.Equals(b);
+        }
+
+        public static bool operator !=(FScriptName a, FScriptName b)
+        {
+            return !a.Equals(b);
+        }
+
+        /// <summary>
+        /// Get the string representation of the name, this doesn't call into native code unless 
+        /// the name was added to the native name table after the managed copy was last updated.
+        /// </summary>
+        public override string ToString()
+        {
+            return NameUtils.GetString(this);
+        }
     }
 }
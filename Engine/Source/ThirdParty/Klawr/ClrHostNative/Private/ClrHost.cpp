@@ -25,6 +25,7 @@
 #include "KlawrClrHostPCH.h"
 #include "ClrHost.h"
 #include "ClrHostControl.h"
+#include "ClrHostMemory.h"
 #include <metahost.h>
 #include "KlawrClrHostInterfaces.h"
 
@@ -107,6 +108,23 @@ struct ProxySizeChecks
 		"ArrayUtilsProxy doesn't have the same size in native and managed code!"
 	);
 
+	static_assert(
+		sizeof(Klawr::Managed::NameUtilsProxy) == sizeof(NameUtilsProxy),
+		"NameUtilsProxy doesn't have the same size in native and managed code!"
+	);
+	static_assert(
+		sizeof(Klawr::Managed::ScriptComponentUtilsProxy) == sizeof(ScriptComponentUtilsProxy),
+		"ScriptComponentUtilsProxy doesn't have the same size in native and managed code!"
+	);
+	static_assert(
+		sizeof(Klawr::Managed::ProfilerUtilsProxy) == sizeof(ProfilerUtilsProxy),
+		"ProfilerUtilsProxy doesn't have the same size in native and managed code!"
+	);
+	static_assert(
+		sizeof(Klawr::Managed::TaskUtilsProxy) == sizeof(TaskUtilsProxy),
+		"TaskUtilsProxy doesn't have the same size in native and managed code!"
+	);
+
 	static_assert(
 		sizeof(Klawr::Managed::ScriptComponentProxy) == sizeof(ScriptComponentProxy),
 		"ScriptComponentProxy doesn't have the same size in native and managed code!"
@@ -114,11 +132,15 @@ struct ProxySizeChecks
 
 };
 
-bool ClrHost::Startup(const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName)
+bool ClrHost::Startup(
+	const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName,
+	const ClrStartupOptions& options
+)
 {
 	_COM_SMARTPTR_TYPEDEF(ICLRMetaHost, IID_ICLRMetaHost);
 	_COM_SMARTPTR_TYPEDEF(ICLRRuntimeInfo, IID_ICLRRuntimeInfo);
 	_COM_SMARTPTR_TYPEDEF(ICLRControl, IID_ICLRControl);
+	_COM_SMARTPTR_TYPEDEF(ICLRGCManager, IID_ICLRGCManager);
 
 	_engineAppDomainAppBase = engineAppDomainAppBase;
 	_gameScriptsAssemblyName = gameScriptsAssemblyName;
@@ -140,6 +162,33 @@ bool ClrHost::Startup(const TCHAR* engineAppDomainAppBase, const TCHAR* gameScri
 		return false;
 	}
 
+	// the GC flavor must be selected before the CLR is loaded
+	DWORD startupFlags = 0;
+	DWORD configFileLength = 0;
+	hr = runtimeInfo->GetDefaultStartupFlags(&startupFlags, nullptr, &configFileLength);
+	if (!verify(SUCCEEDED(hr)))
+	{
+		return false;
+	}
+	startupFlags &= ~(STARTUP_CONCURRENT_GC | STARTUP_SERVER_GC);
+	switch (options.GCFlavor)
+	{
+		case EClrGCFlavor::WorkstationConcurrent:
+			startupFlags |= STARTUP_CONCURRENT_GC;
+			break;
+		case EClrGCFlavor::Server:
+			startupFlags |= STARTUP_SERVER_GC;
+			break;
+		case EClrGCFlavor::ServerConcurrent:
+			startupFlags |= STARTUP_SERVER_GC | STARTUP_CONCURRENT_GC;
+			break;
+	}
+	hr = runtimeInfo->SetDefaultStartupFlags(startupFlags, nullptr);
+	if (!verify(SUCCEEDED(hr)))
+	{
+		return false;
+	}
+
 	// load the CLR (it won't be initialized just yet)
 	hr = runtimeInfo->GetInterface(CLSID_CLRRuntimeHost, IID_PPV_ARGS(&_runtimeHost));
 	if (!verify(SUCCEEDED(hr)))
@@ -149,7 +198,7 @@ bool ClrHost::Startup(const TCHAR* engineAppDomainAppBase, const TCHAR* gameScri
 
 	// hook up our unmanaged host to the runtime host
 	assert(!_hostControl);
-	_hostControl = new ClrHostControl();
+	_hostControl = new ClrHostControl(options);
 	hr = _runtimeHost->SetHostControl(_hostControl);
 	if (!verify(SUCCEEDED(hr)))
 	{
@@ -175,6 +224,26 @@ bool ClrHost::Startup(const TCHAR* engineAppDomainAppBase, const TCHAR* gameScri
 		return false;
 	}
 
+	if (options.MemoryHooks)
+	{
+		// the memory manager attributes pages to the GC heap based on the size of the range they
+		// were reserved in, so the segment size must be known up front (and it can only be set 
+		// before the CLR starts)
+		ICLRGCManagerPtr gcManager;
+		hr = clrControl->GetCLRManager(IID_ICLRGCManager, reinterpret_cast<void**>(&gcManager));
+		if (!verify(SUCCEEDED(hr)))
+		{
+			return false;
+		}
+		hr = gcManager->SetGCStartupLimits(
+			static_cast<DWORD>(ClrHostMemoryManager::GCSegmentSize), 0
+		);
+		if (!verify(SUCCEEDED(hr)))
+		{
+			return false;
+		}
+	}
+
 	// initialize the CLR (not strictly necessary because the runtime can initialize itself)
 	hr = _runtimeHost->Start();
 	return SUCCEEDED(hr);
@@ -235,6 +304,18 @@ bool ClrHost::InitEngineAppDomain(int appDomainID, const NativeUtils& nativeUtil
 			),
 			reinterpret_cast<Klawr::Managed::ArrayUtilsProxy*>(
 				const_cast<ArrayUtilsProxy*>(&nativeUtils.Array)
+			),
+			reinterpret_cast<Klawr::Managed::NameUtilsProxy*>(
+				const_cast<NameUtilsProxy*>(&nativeUtils.Name)
+			),
+			reinterpret_cast<Klawr::Managed::ScriptComponentUtilsProxy*>(
+				const_cast<ScriptComponentUtilsProxy*>(&nativeUtils.ScriptComponent)
+			),
+			reinterpret_cast<Klawr::Managed::ProfilerUtilsProxy*>(
+				const_cast<ProfilerUtilsProxy*>(&nativeUtils.Profiler)
+			),
+			reinterpret_cast<Klawr::Managed::TaskUtilsProxy*>(
+				const_cast<TaskUtilsProxy*>(&nativeUtils.Task)
 			)
 		);
 
@@ -308,6 +389,42 @@ void ClrHost::DestroyScriptComponent(int appDomainID, __int64 instanceID)
 	}
 }
 
+TickScriptComponentsAction ClrHost::GetTickScriptComponentsAction(int appDomainID)
+{
+	auto appDomainManager = _hostControl->GetEngineAppDomainManager(appDomainID);
+	if (appDomainManager)
+	{
+		return reinterpret_cast<TickScriptComponentsAction>(
+			static_cast<INT_PTR>(appDomainManager->GetTickScriptComponentsFunction())
+		);
+	}
+	return nullptr;
+}
+
+UpdateTickLodsAction ClrHost::GetUpdateTickLodsAction(int appDomainID)
+{
+	auto appDomainManager = _hostControl->GetEngineAppDomainManager(appDomainID);
+	if (appDomainManager)
+	{
+		return reinterpret_cast<UpdateTickLodsAction>(
+			static_cast<INT_PTR>(appDomainManager->GetUpdateTickLodsFunction())
+		);
+	}
+	return nullptr;
+}
+
+GetAllocatedBytesFunc ClrHost::GetAllocatedBytesFunction(int appDomainID)
+{
+	auto appDomainManager = _hostControl->GetEngineAppDomainManager(appDomainID);
+	if (appDomainManager)
+	{
+		return reinterpret_cast<GetAllocatedBytesFunc>(
+			static_cast<INT_PTR>(appDomainManager->GetAllocatedBytesFunction())
+		);
+	}
+	return nullptr;
+}
+
 void ClrHost::GetScriptComponentTypes(int appDomainID, std::vector<tstring>& types) const
 {
 	auto appDomainManager = _hostControl->GetEngineAppDomainManager(appDomainID);
@@ -321,4 +438,119 @@ void ClrHost::GetScriptComponentTypes(int appDomainID, std::vector<tstring>& typ
 	}
 }
 
+bool ClrHost::WriteWrapperUsage(int appDomainID, const TCHAR* outputFilename) const
+{
+	auto appDomainManager = _hostControl->GetEngineAppDomainManager(appDomainID);
+	if (appDomainManager)
+	{
+		return !!appDomainManager->WriteWrapperUsage(
+			_gameScriptsAssemblyName.c_str(), outputFilename
+		);
+	}
+	return false;
+}
+
+void ClrHost::FlushLogs()
+{
+	if (_hostControl)
+	{
+		_hostControl->FlushLogs();
+	}
+}
+
+void ClrHost::RunFrame(float deltaTime)
+{
+	if (_hostControl)
+	{
+		_hostControl->RunFrame(deltaTime);
+	}
+}
+
+int32 ClrHost::RunWorkQueues(double budgetSeconds)
+{
+	if (_hostControl)
+	{
+		return _hostControl->RunWorkQueues(budgetSeconds);
+	}
+	return 0;
+}
+
+void ClrHost::LogWorkQueueStats()
+{
+	if (_hostControl)
+	{
+		_hostControl->LogWorkQueueStats();
+	}
+}
+
+void ClrHost::FlushProfilerScopes()
+{
+	if (_hostControl)
+	{
+		_hostControl->FlushProfilerScopes();
+	}
+}
+
+bool ClrHost::SetGCLatencyMode(EClrGCLatencyMode mode)
+{
+	if (!_hostControl)
+	{
+		return false;
+	}
+	auto appDomainManager = _hostControl->GetDefaultAppDomainManager();
+	if (appDomainManager)
+	{
+		return appDomainManager->SetGCLatencyMode(static_cast<long>(mode)) != VARIANT_FALSE;
+	}
+	return false;
+}
+
+void ClrHost::CollectGarbage(int32 generation, bool bBlocking)
+{
+	if (!_hostControl)
+	{
+		return;
+	}
+	auto appDomainManager = _hostControl->GetDefaultAppDomainManager();
+	if (appDomainManager)
+	{
+		appDomainManager->CollectGarbage(generation, bBlocking ? VARIANT_TRUE : VARIANT_FALSE);
+	}
+}
+
+bool ClrHost::TryStartNoGCRegion(int64 totalSize)
+{
+	if (!_hostControl)
+	{
+		return false;
+	}
+	auto appDomainManager = _hostControl->GetDefaultAppDomainManager();
+	if (appDomainManager)
+	{
+		return appDomainManager->TryStartNoGCRegion(totalSize) != VARIANT_FALSE;
+	}
+	return false;
+}
+
+void ClrHost::EndNoGCRegion()
+{
+	if (!_hostControl)
+	{
+		return;
+	}
+	auto appDomainManager = _hostControl->GetDefaultAppDomainManager();
+	if (appDomainManager)
+	{
+		appDomainManager->EndNoGCRegion();
+	}
+}
+
+void ClrHost::NotifyLowMemory()
+{
+	if (_hostControl)
+	{
+		_hostControl->NotifyLowMemory();
+	}
+}
+
 } // namespace Klawr
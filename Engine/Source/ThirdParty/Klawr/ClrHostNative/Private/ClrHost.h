@@ -39,7 +39,10 @@ namespace Klawr {
 class ClrHost : public IClrHost
 {
 public: // IClrHost interface
-	virtual bool Startup(const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName) override;
+	virtual bool Startup(
+		const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName,
+		const ClrStartupOptions& options
+	) override;
 	virtual bool CreateEngineAppDomain(int& outAppDomainID) override;
 	virtual bool InitEngineAppDomain(int appDomainID, const NativeUtils& nativeUtils) override;
 	virtual bool DestroyEngineAppDomain(int appDomainID);
@@ -61,8 +64,23 @@ public: // IClrHost interface
 	) override;
 
 	virtual void DestroyScriptComponent(int appDomainID, __int64 instanceID) override;
+	virtual TickScriptComponentsAction GetTickScriptComponentsAction(int appDomainID) override;
+	virtual UpdateTickLodsAction GetUpdateTickLodsAction(int appDomainID) override;
+	virtual GetAllocatedBytesFunc GetAllocatedBytesFunction(int appDomainID) override;
 
 	virtual void GetScriptComponentTypes(int appDomainID, std::vector<tstring>& types) const override;
+	virtual bool WriteWrapperUsage(int appDomainID, const TCHAR* outputFilename) const override;
+
+	virtual void FlushLogs() override;
+	virtual void RunFrame(float deltaTime) override;
+	virtual int32 RunWorkQueues(double budgetSeconds) override;
+	virtual void LogWorkQueueStats() override;
+	virtual void FlushProfilerScopes() override;
+	virtual bool SetGCLatencyMode(EClrGCLatencyMode mode) override;
+	virtual void CollectGarbage(int32 generation, bool bBlocking) override;
+	virtual bool TryStartNoGCRegion(int64 totalSize) override;
+	virtual void EndNoGCRegion() override;
+	virtual void NotifyLowMemory() override;
 
 public:
 	ClrHost() : _hostControl(nullptr) {}
@@ -24,9 +24,40 @@
 
 #include "KlawrClrHostPCH.h"
 #include "ClrHostControl.h"
+#include "ClrHostMemory.h"
+#include "ClrHostGCManager.h"
 
 namespace Klawr {
 
+ClrHostControl::ClrHostControl(const ClrStartupOptions& options)
+	: _refCount(1)
+	, _memoryManager(nullptr)
+	, _gcManager(nullptr)
+{
+	if (options.MemoryHooks)
+	{
+		_memoryManager = new ClrHostMemoryManager(*options.MemoryHooks);
+	}
+	if (options.OnGCPause)
+	{
+		_gcManager = new ClrHostGCManager(options.OnGCPause);
+	}
+}
+
+ClrHostControl::~ClrHostControl()
+{
+	if (_memoryManager)
+	{
+		_memoryManager->Release();
+		_memoryManager = nullptr;
+	}
+	if (_gcManager)
+	{
+		_gcManager->Release();
+		_gcManager = nullptr;
+	}
+}
+
 IEngineAppDomainManager* ClrHostControl::GetEngineAppDomainManager(int appDomainID)
 {
 	auto it = _engineAppDomainManagers.find(appDomainID);
@@ -49,6 +80,66 @@ bool ClrHostControl::DestroyEngineAppDomain(int appDomainID)
 	return false;
 }
 
+void ClrHostControl::NotifyLowMemory()
+{
+	if (_memoryManager)
+	{
+		_memoryManager->NotifyLowMemory();
+	}
+}
+
+void ClrHostControl::FlushLogs()
+{
+	for (const auto& appDomainManager : _engineAppDomainManagers)
+	{
+		appDomainManager.second->FlushLog();
+	}
+}
+
+void ClrHostControl::RunFrame(float deltaTime)
+{
+	for (const auto& appDomainManager : _engineAppDomainManagers)
+	{
+		appDomainManager.second->RunFrame(deltaTime);
+	}
+}
+
+int32 ClrHostControl::RunWorkQueues(double budgetSeconds)
+{
+	LARGE_INTEGER frequency, start, now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+	int32 numQueued = 0;
+	for (const auto& appDomainManager : _engineAppDomainManagers)
+	{
+		// each app domain gets whatever is left of the budget, so app domains that run first 
+		// may starve the rest (e.g. the editor app domain may starve a PIE app domain)
+		QueryPerformanceCounter(&now);
+		const double elapsedSeconds = 
+			static_cast<double>(now.QuadPart - start.QuadPart) / frequency.QuadPart;
+		numQueued += appDomainManager.second->RunWorkQueue(
+			(budgetSeconds > elapsedSeconds) ? (budgetSeconds - elapsedSeconds) : 0.0
+		);
+	}
+	return numQueued;
+}
+
+void ClrHostControl::LogWorkQueueStats()
+{
+	for (const auto& appDomainManager : _engineAppDomainManagers)
+	{
+		appDomainManager.second->LogWorkQueueStats();
+	}
+}
+
+void ClrHostControl::FlushProfilerScopes()
+{
+	for (const auto& appDomainManager : _engineAppDomainManagers)
+	{
+		appDomainManager.second->FlushProfilerScopes();
+	}
+}
+
 void ClrHostControl::Shutdown()
 {
 	_engineAppDomainManagers.clear();
@@ -62,7 +153,23 @@ void ClrHostControl::Shutdown()
 
 HRESULT STDMETHODCALLTYPE ClrHostControl::GetHostManager(REFIID riid, void** ppObject)
 {
-	// no custom managers have been implemented yet
+	if (!ppObject)
+	{
+		return E_POINTER;
+	}
+	if ((riid == IID_IHostMemoryManager) && _memoryManager)
+	{
+		_memoryManager->AddRef();
+		*ppObject = static_cast<IHostMemoryManager*>(_memoryManager);
+		return S_OK;
+	}
+	if ((riid == IID_IHostGCManager) && _gcManager)
+	{
+		_gcManager->AddRef();
+		*ppObject = static_cast<IHostGCManager*>(_gcManager);
+		return S_OK;
+	}
+	// the CLR will use its default implementation for any other manager
 	*ppObject = nullptr;
 	return E_NOINTERFACE;
 }
@@ -41,10 +41,13 @@ using Managed::IEngineAppDomainManagerPtr;
 class ClrHostControl : public IHostControl
 {
 public:
-	ClrHostControl()
-		: _refCount(1)
-	{
-	}
+	/** 
+	 * @param options If memory hooks are provided the CLR will be given a memory manager that 
+	 *        allocates memory via those hooks, if a GC pause callback is provided the CLR will be
+	 *        given a GC manager that times garbage collections.
+	 */
+	explicit ClrHostControl(const ClrStartupOptions& options);
+	~ClrHostControl();
 
 	IDefaultAppDomainManager* GetDefaultAppDomainManager()
 	{
@@ -59,6 +62,27 @@ public:
 	 */
 	bool DestroyEngineAppDomain(int appDomainID);
 
+	/** Print any log messages queued by managed code in all engine app domains. */
+	void FlushLogs();
+
+	/** Run the continuations of async managed methods that are due in all engine app domains. */
+	void RunFrame(float deltaTime);
+
+	/** 
+	 * Run queued managed work items in all engine app domains until the budget runs out.
+	 * @return Number of work items left in the queues.
+	 */
+	int32 RunWorkQueues(double budgetSeconds);
+
+	/** Log the statistics gathered by the work queues in all engine app domains. */
+	void LogWorkQueueStats();
+
+	/** Emit any profiling scopes recorded on the game thread in all engine app domains. */
+	void FlushProfilerScopes();
+
+	/** Let the CLR know the host is running low on memory (if the CLR uses the host's memory). */
+	void NotifyLowMemory();
+
 	/**
 	 * Unload all engine app domains and release all internal references to any app domain managers.
 	 * @note This should be called only before the CLR is stopped.
@@ -110,6 +134,10 @@ public: // IUnknown interface
 
 private:
 	volatile ULONG _refCount;
+	// memory manager the CLR will use to allocate memory (may be null)
+	class ClrHostMemoryManager* _memoryManager;
+	// GC manager the CLR will notify of garbage collections (may be null)
+	class ClrHostGCManager* _gcManager;
 	// the app domain manager for the default app domain (that can't be unloaded while the CLR is running)
 	IDefaultAppDomainManagerPtr _defaultAppDomainManager;
 	// app domain managers for engine app domains (that can be unloaded while the CLR is running)
@@ -0,0 +1,97 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrClrHostPCH.h"
+#include "ClrHostGCManager.h"
+
+namespace Klawr {
+
+ClrHostGCManager::ClrHostGCManager(ClrStartupOptions::GCPauseAction onGCPause)
+	: _refCount(1)
+	, _onGCPause(onGCPause)
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	_secondsPerCycle = 1.0 / static_cast<double>(frequency.QuadPart);
+	_suspensionStart.QuadPart = 0;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostGCManager::ThreadIsBlockingForSuspension()
+{
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostGCManager::SuspensionStarting()
+{
+	QueryPerformanceCounter(&_suspensionStart);
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostGCManager::SuspensionEnding(DWORD Generation)
+{
+	// the runtime is also suspended for reasons other than garbage collection (e.g. debugging),
+	// those suspensions don't have a valid generation
+	if (Generation <= 2)
+	{
+		LARGE_INTEGER suspensionEnd;
+		QueryPerformanceCounter(&suspensionEnd);
+		const double pauseSeconds = 
+			(suspensionEnd.QuadPart - _suspensionStart.QuadPart) * _secondsPerCycle;
+		_onGCPause(static_cast<int32>(Generation), pauseSeconds);
+	}
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostGCManager::QueryInterface(REFIID riid, void** ppvObject)
+{
+	if (!ppvObject)
+	{
+		return E_POINTER;
+	}
+	if ((riid == IID_IUnknown) || (riid == IID_IHostGCManager))
+	{
+		*ppvObject = this;
+		AddRef();
+		return S_OK;
+	}
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE ClrHostGCManager::AddRef()
+{
+	return InterlockedIncrement(&_refCount);
+}
+
+ULONG STDMETHODCALLTYPE ClrHostGCManager::Release()
+{
+	ULONG refCount = InterlockedDecrement(&_refCount);
+	if (refCount == 0)
+	{
+		delete this;
+	}
+	return refCount;
+}
+
+} // namespace Klawr
@@ -0,0 +1,59 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+
+namespace Klawr {
+
+/**
+ * @brief Times garbage collections.
+ *
+ * The CLR suspends all managed threads (in all app domains) for the blocking portion of every 
+ * garbage collection, and notifies this manager when the suspension starts and ends.
+ */
+class ClrHostGCManager : public IHostGCManager
+{
+public:
+	explicit ClrHostGCManager(ClrStartupOptions::GCPauseAction onGCPause);
+
+public: // IHostGCManager interface
+	virtual HRESULT STDMETHODCALLTYPE ThreadIsBlockingForSuspension() override;
+	virtual HRESULT STDMETHODCALLTYPE SuspensionStarting() override;
+	virtual HRESULT STDMETHODCALLTYPE SuspensionEnding(DWORD Generation) override;
+
+public: // IUnknown interface
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override;
+	virtual ULONG STDMETHODCALLTYPE AddRef() override;
+	virtual ULONG STDMETHODCALLTYPE Release() override;
+
+private:
+	volatile ULONG _refCount;
+	ClrStartupOptions::GCPauseAction _onGCPause;
+	double _secondsPerCycle;
+	// only one suspension can be in progress at any one time
+	LARGE_INTEGER _suspensionStart;
+};
+
+} // namespace Klawr
@@ -0,0 +1,469 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+
+#include "KlawrClrHostPCH.h"
+#include "ClrHostMemory.h"
+
+namespace Klawr {
+
+namespace {
+
+// the size of each block allocated via the hooks is stored in front of the block, 
+// this also keeps the block 16-byte aligned
+const SIZE_T BlockHeaderSize = 16;
+
+bool IsExecutable(DWORD protect)
+{
+	return (protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | 
+		PAGE_EXECUTE_WRITECOPY)) != 0;
+}
+
+} // unnamed namespace
+
+ClrHostMalloc::ClrHostMalloc(const ClrMemoryHooks& hooks, bool bExecutable)
+	: _refCount(1)
+	, _hooks(hooks)
+	, _executableHeap(nullptr)
+{
+	if (bExecutable)
+	{
+		_executableHeap = HeapCreate(HEAP_CREATE_ENABLE_EXECUTE, 0, 0);
+		assert(_executableHeap);
+	}
+}
+
+ClrHostMalloc::~ClrHostMalloc()
+{
+	if (_executableHeap)
+	{
+		HeapDestroy(_executableHeap);
+	}
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMalloc::Alloc(
+	SIZE_T cbSize, EMemoryCriticalLevel eCriticalLevel, void** ppMem
+)
+{
+	if (!ppMem)
+	{
+		return E_POINTER;
+	}
+
+	if (_executableHeap)
+	{
+		*ppMem = HeapAlloc(_executableHeap, 0, cbSize);
+		if (!*ppMem)
+		{
+			return E_OUTOFMEMORY;
+		}
+		_hooks.OnMemoryChanged(EClrMemoryCategory::ExecutableHeap, cbSize);
+		return S_OK;
+	}
+
+	auto block = static_cast<uint8*>(_hooks.Malloc(cbSize + BlockHeaderSize));
+	if (!block)
+	{
+		*ppMem = nullptr;
+		return E_OUTOFMEMORY;
+	}
+	*reinterpret_cast<SIZE_T*>(block) = cbSize;
+	*ppMem = block + BlockHeaderSize;
+	_hooks.OnMemoryChanged(EClrMemoryCategory::Heap, cbSize);
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMalloc::DebugAlloc(
+	SIZE_T cbSize, EMemoryCriticalLevel eCriticalLevel, char* pszFileName, int iLineNo,
+	void** ppMem
+)
+{
+	return Alloc(cbSize, eCriticalLevel, ppMem);
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMalloc::Free(void* pMem)
+{
+	if (!pMem)
+	{
+		return S_OK;
+	}
+
+	if (_executableHeap)
+	{
+		const SIZE_T size = HeapSize(_executableHeap, 0, pMem);
+		if (!HeapFree(_executableHeap, 0, pMem))
+		{
+			return HRESULT_FROM_WIN32(GetLastError());
+		}
+		_hooks.OnMemoryChanged(EClrMemoryCategory::ExecutableHeap, -static_cast<int64>(size));
+		return S_OK;
+	}
+
+	auto block = static_cast<uint8*>(pMem) - BlockHeaderSize;
+	const SIZE_T size = *reinterpret_cast<SIZE_T*>(block);
+	_hooks.Free(block);
+	_hooks.OnMemoryChanged(EClrMemoryCategory::Heap, -static_cast<int64>(size));
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMalloc::QueryInterface(REFIID riid, void** ppvObject)
+{
+	if (!ppvObject)
+	{
+		return E_POINTER;
+	}
+	if ((riid == IID_IUnknown) || (riid == IID_IHostMalloc))
+	{
+		*ppvObject = this;
+		AddRef();
+		return S_OK;
+	}
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE ClrHostMalloc::AddRef()
+{
+	return InterlockedIncrement(&_refCount);
+}
+
+ULONG STDMETHODCALLTYPE ClrHostMalloc::Release()
+{
+	ULONG refCount = InterlockedDecrement(&_refCount);
+	if (refCount == 0)
+	{
+		delete this;
+	}
+	return refCount;
+}
+
+ClrHostMemoryManager::ClrHostMemoryManager(const ClrMemoryHooks& hooks)
+	: _refCount(1)
+	, _hooks(hooks)
+	, _notificationCallback(nullptr)
+{
+	InitializeSRWLock(&_gcReservationsLock);
+	InitializeSRWLock(&_commitLock);
+}
+
+ClrHostMemoryManager::~ClrHostMemoryManager()
+{
+	if (_notificationCallback)
+	{
+		_notificationCallback->Release();
+	}
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::CreateMalloc(
+	DWORD dwMallocType, IHostMalloc** ppMalloc
+)
+{
+	if (!ppMalloc)
+	{
+		return E_POINTER;
+	}
+	// both the hooks and the executable heap are thread-safe, so MALLOC_THREADSAFE is a given
+	*ppMalloc = new ClrHostMalloc(_hooks, (dwMallocType & MALLOC_EXECUTABLE) != 0);
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::VirtualAlloc(
+	void* pAddress, SIZE_T dwSize, DWORD flAllocationType, DWORD flProtect,
+	EMemoryCriticalLevel eCriticalLevel, void** ppMem
+)
+{
+	if (!ppMem)
+	{
+		return E_POINTER;
+	}
+
+	// committing pages that are already committed is allowed, so only newly committed pages
+	// should be reported
+	const bool bCommit = (flAllocationType & MEM_COMMIT) != 0;
+	if (bCommit)
+	{
+		AcquireSRWLockExclusive(&_commitLock);
+	}
+	CommittedBytes before = { 0, 0 };
+	if (bCommit && pAddress)
+	{
+		before = GetCommittedBytes(pAddress, dwSize);
+	}
+
+	*ppMem = ::VirtualAlloc(pAddress, dwSize, flAllocationType, flProtect);
+	if (*ppMem)
+	{
+		if ((flAllocationType & MEM_RESERVE) && (dwSize >= GCMinReservationSize))
+		{
+			AcquireSRWLockExclusive(&_gcReservationsLock);
+			_gcReservations.insert(*ppMem);
+			ReleaseSRWLockExclusive(&_gcReservationsLock);
+		}
+
+		if (bCommit)
+		{
+			ReportChange(before, GetCommittedBytes(*ppMem, dwSize), IsGCHeapAddress(*ppMem));
+		}
+	}
+
+	if (bCommit)
+	{
+		ReleaseSRWLockExclusive(&_commitLock);
+	}
+	return *ppMem ? S_OK : E_OUTOFMEMORY;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::VirtualFree(
+	LPVOID lpAddress, SIZE_T dwSize, DWORD dwFreeType
+)
+{
+	const bool bIsGCHeap = IsGCHeapAddress(lpAddress);
+
+	AcquireSRWLockExclusive(&_commitLock);
+	// when releasing dwSize is zero, and the whole allocation is released
+	const CommittedBytes before = GetCommittedBytes(lpAddress, dwSize);
+	const bool bFreed = ::VirtualFree(lpAddress, dwSize, dwFreeType) != FALSE;
+	const DWORD error = bFreed ? ERROR_SUCCESS : GetLastError();
+	if (bFreed)
+	{
+		const CommittedBytes after = { 0, 0 };
+		ReportChange(before, after, bIsGCHeap);
+	}
+	ReleaseSRWLockExclusive(&_commitLock);
+
+	if (!bFreed)
+	{
+		return HRESULT_FROM_WIN32(error);
+	}
+
+	if (bIsGCHeap && (dwFreeType & MEM_RELEASE))
+	{
+		AcquireSRWLockExclusive(&_gcReservationsLock);
+		_gcReservations.erase(lpAddress);
+		ReleaseSRWLockExclusive(&_gcReservationsLock);
+	}
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::VirtualQuery(
+	void* lpAddress, void* lpBuffer, SIZE_T dwLength, SIZE_T* pResult
+)
+{
+	if (!pResult)
+	{
+		return E_POINTER;
+	}
+	*pResult = ::VirtualQuery(
+		lpAddress, static_cast<PMEMORY_BASIC_INFORMATION>(lpBuffer), dwLength
+	);
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::VirtualProtect(
+	void* lpAddress, SIZE_T dwSize, DWORD flNewProtect, DWORD* pflOldProtect
+)
+{
+	// pages that become (non-)executable move to a different category
+	const bool bIsGCHeap = IsGCHeapAddress(lpAddress);
+
+	AcquireSRWLockExclusive(&_commitLock);
+	const CommittedBytes before = GetCommittedBytes(lpAddress, dwSize);
+	const bool bProtected = 
+		::VirtualProtect(lpAddress, dwSize, flNewProtect, pflOldProtect) != FALSE;
+	const DWORD error = bProtected ? ERROR_SUCCESS : GetLastError();
+	if (bProtected)
+	{
+		ReportChange(before, GetCommittedBytes(lpAddress, dwSize), bIsGCHeap);
+	}
+	ReleaseSRWLockExclusive(&_commitLock);
+
+	return bProtected ? S_OK : HRESULT_FROM_WIN32(error);
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::GetMemoryLoad(
+	DWORD* pMemoryLoad, SIZE_T* pAvailableBytes
+)
+{
+	if (!pMemoryLoad || !pAvailableBytes)
+	{
+		return E_POINTER;
+	}
+	MEMORYSTATUSEX status;
+	status.dwLength = sizeof(status);
+	if (!GlobalMemoryStatusEx(&status))
+	{
+		return E_FAIL;
+	}
+	*pMemoryLoad = status.dwMemoryLoad;
+	*pAvailableBytes = static_cast<SIZE_T>(status.ullAvailPhys);
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::RegisterMemoryNotificationCallback(
+	ICLRMemoryNotificationCallback* pCallback
+)
+{
+	// the callback is invoked by NotifyLowMemory()
+	if (pCallback)
+	{
+		pCallback->AddRef();
+	}
+	if (_notificationCallback)
+	{
+		_notificationCallback->Release();
+	}
+	_notificationCallback = pCallback;
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::NeedsVirtualAddressSpace(
+	LPVOID startAddress, SIZE_T size
+)
+{
+	// the engine doesn't reserve address space at fixed addresses, so there's nothing to free up
+	return S_OK;
+}
+
+void STDMETHODCALLTYPE ClrHostMemoryManager::AcquiredVirtualAddressSpace(
+	LPVOID startAddress, SIZE_T size
+)
+{
+}
+
+void STDMETHODCALLTYPE ClrHostMemoryManager::ReleasedVirtualAddressSpace(LPVOID startAddress)
+{
+}
+
+void ClrHostMemoryManager::NotifyLowMemory()
+{
+	// the CLR registers the callback once during startup, before any managed code runs
+	if (_notificationCallback)
+	{
+		_notificationCallback->OnMemoryNotification(eMemoryAvailableLow);
+	}
+}
+
+HRESULT STDMETHODCALLTYPE ClrHostMemoryManager::QueryInterface(REFIID riid, void** ppvObject)
+{
+	if (!ppvObject)
+	{
+		return E_POINTER;
+	}
+	if ((riid == IID_IUnknown) || (riid == IID_IHostMemoryManager))
+	{
+		*ppvObject = this;
+		AddRef();
+		return S_OK;
+	}
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE ClrHostMemoryManager::AddRef()
+{
+	return InterlockedIncrement(&_refCount);
+}
+
+ULONG STDMETHODCALLTYPE ClrHostMemoryManager::Release()
+{
+	ULONG refCount = InterlockedDecrement(&_refCount);
+	if (refCount == 0)
+	{
+		delete this;
+	}
+	return refCount;
+}
+
+ClrHostMemoryManager::CommittedBytes ClrHostMemoryManager::GetCommittedBytes(
+	void* address, SIZE_T size
+)
+{
+	CommittedBytes result = { 0, 0 };
+	
+	MEMORY_BASIC_INFORMATION info;
+	if (!address || !::VirtualQuery(address, &info, sizeof(info)))
+	{
+		return result;
+	}
+	
+	const void* allocationBase = info.AllocationBase;
+	auto current = static_cast<uint8*>(address);
+	auto end = size ? (current + size) : nullptr;
+	while (::VirtualQuery(current, &info, sizeof(info)) && 
+		(info.AllocationBase == allocationBase) && (!end || (current < end)))
+	{
+		auto regionEnd = static_cast<uint8*>(info.BaseAddress) + info.RegionSize;
+		if (end && (regionEnd > end))
+		{
+			regionEnd = end;
+		}
+		if (info.State == MEM_COMMIT)
+		{
+			const int64 bytes = regionEnd - current;
+			if (IsExecutable(info.Protect))
+			{
+				result.Executable += bytes;
+			}
+			else
+			{
+				result.Regular += bytes;
+			}
+		}
+		current = regionEnd;
+	}
+	return result;
+}
+
+bool ClrHostMemoryManager::IsGCHeapAddress(void* address)
+{
+	MEMORY_BASIC_INFORMATION info;
+	if (!address || !::VirtualQuery(address, &info, sizeof(info)))
+	{
+		return false;
+	}
+	AcquireSRWLockShared(&_gcReservationsLock);
+	const bool bIsGCHeap = _gcReservations.count(info.AllocationBase) != 0;
+	ReleaseSRWLockShared(&_gcReservationsLock);
+	return bIsGCHeap;
+}
+
+void ClrHostMemoryManager::ReportChange(
+	const CommittedBytes& before, const CommittedBytes& after, bool bIsGCHeap
+)
+{
+	if (after.Regular != before.Regular)
+	{
+		_hooks.OnMemoryChanged(
+			bIsGCHeap ? EClrMemoryCategory::GCHeap : EClrMemoryCategory::LoaderHeap, 
+			after.Regular - before.Regular
+		);
+	}
+	if (after.Executable != before.Executable)
+	{
+		_hooks.OnMemoryChanged(
+			EClrMemoryCategory::ExecutableVirtualMemory, after.Executable - before.Executable
+		);
+	}
+}
+
+} // namespace Klawr
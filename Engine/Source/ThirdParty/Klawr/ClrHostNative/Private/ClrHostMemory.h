@@ -0,0 +1,170 @@
+//-------------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2014 Vadim Macagon
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//-------------------------------------------------------------------------------
+#pragma once
+
+#include "KlawrClrHost.h"
+#include <set>
+
+namespace Klawr {
+
+/**
+ * @brief Allocates small blocks of memory for the CLR.
+ *
+ * Non-executable blocks are allocated via the memory hooks supplied by the host, executable 
+ * blocks are allocated from a private executable heap since general purpose allocators don't
+ * hand out executable memory.
+ */
+class ClrHostMalloc : public IHostMalloc
+{
+public:
+	ClrHostMalloc(const ClrMemoryHooks& hooks, bool bExecutable);
+	~ClrHostMalloc();
+
+public: // IHostMalloc interface
+	virtual HRESULT STDMETHODCALLTYPE Alloc(
+		SIZE_T cbSize, EMemoryCriticalLevel eCriticalLevel, void** ppMem
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE DebugAlloc(
+		SIZE_T cbSize, EMemoryCriticalLevel eCriticalLevel, char* pszFileName, int iLineNo,
+		void** ppMem
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE Free(void* pMem) override;
+
+public: // IUnknown interface
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override;
+	virtual ULONG STDMETHODCALLTYPE AddRef() override;
+	virtual ULONG STDMETHODCALLTYPE Release() override;
+
+private:
+	volatile ULONG _refCount;
+	ClrMemoryHooks _hooks;
+	// only used for executable blocks
+	HANDLE _executableHeap;
+};
+
+/**
+ * @brief Memory manager the CLR uses to allocate all of its memory.
+ *
+ * Blocks allocated via IHostMalloc instances are routed through the memory hooks supplied by 
+ * the host (where possible), pages are still allocated directly from the OS since the CLR relies
+ * on being able to reserve address space and commit it later, but all committed pages are
+ * reported to the host.
+ *
+ * The CLR doesn't say what the pages it allocates are for, but the host sets the size of the GC
+ * segments (see GCSegmentSize) and the GC reserves address space for the managed heap one segment
+ * at a time (large object heap segments are half as big, or as big as the object that didn't fit),
+ * while the loader heaps and everything else reserve ranges of a few MB at most. Each reservation
+ * is attributed to the GC heap or the loader heaps when it's made, and pages committed in it later
+ * are reported in the same category.
+ */
+class ClrHostMemoryManager : public IHostMemoryManager
+{
+public:
+	/** 
+	 * Size of the segments the GC reserves for the small object heap, passed to 
+	 * ICLRGCManager::SetGCStartupLimits() so the CLR doesn't pick its own (the default depends on
+	 * the GC flavor and the number of cores).
+	 */
+	static const SIZE_T GCSegmentSize = 256 * 1024 * 1024;
+
+public:
+	explicit ClrHostMemoryManager(const ClrMemoryHooks& hooks);
+	~ClrHostMemoryManager();
+
+public: // IHostMemoryManager interface
+	virtual HRESULT STDMETHODCALLTYPE CreateMalloc(DWORD dwMallocType, IHostMalloc** ppMalloc) override;
+	virtual HRESULT STDMETHODCALLTYPE VirtualAlloc(
+		void* pAddress, SIZE_T dwSize, DWORD flAllocationType, DWORD flProtect,
+		EMemoryCriticalLevel eCriticalLevel, void** ppMem
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE VirtualFree(
+		LPVOID lpAddress, SIZE_T dwSize, DWORD dwFreeType
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE VirtualQuery(
+		void* lpAddress, void* lpBuffer, SIZE_T dwLength, SIZE_T* pResult
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE VirtualProtect(
+		void* lpAddress, SIZE_T dwSize, DWORD flNewProtect, DWORD* pflOldProtect
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE GetMemoryLoad(
+		DWORD* pMemoryLoad, SIZE_T* pAvailableBytes
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE RegisterMemoryNotificationCallback(
+		ICLRMemoryNotificationCallback* pCallback
+	) override;
+	virtual HRESULT STDMETHODCALLTYPE NeedsVirtualAddressSpace(
+		LPVOID startAddress, SIZE_T size
+	) override;
+	virtual void STDMETHODCALLTYPE AcquiredVirtualAddressSpace(
+		LPVOID startAddress, SIZE_T size
+	) override;
+	virtual void STDMETHODCALLTYPE ReleasedVirtualAddressSpace(LPVOID startAddress) override;
+
+	/** Tell the CLR that memory is running low, so it collects garbage more aggressively. */
+	void NotifyLowMemory();
+
+public: // IUnknown interface
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override;
+	virtual ULONG STDMETHODCALLTYPE AddRef() override;
+	virtual ULONG STDMETHODCALLTYPE Release() override;
+
+private:
+	/** Number of committed bytes in a range of pages. */
+	struct CommittedBytes
+	{
+		int64 Regular;
+		int64 Executable;
+	};
+
+	/** 
+	 * Count the committed bytes in the given range, if size is zero the range extends to the
+	 * end of the allocation the address belongs to.
+	 */
+	static CommittedBytes GetCommittedBytes(void* address, SIZE_T size);
+	/** Report the difference between two measurements of the same range to the host. */
+	void ReportChange(
+		const CommittedBytes& before, const CommittedBytes& after, bool bIsGCHeap
+	);
+	/** Check if the given address is within a range of address space reserved by the GC. */
+	bool IsGCHeapAddress(void* address);
+
+private:
+	/** The smallest range the GC reserves, a large object heap segment. */
+	static const SIZE_T GCMinReservationSize = GCSegmentSize / 2;
+
+	volatile ULONG _refCount;
+	ClrMemoryHooks _hooks;
+	ICLRMemoryNotificationCallback* _notificationCallback;
+	/** Base addresses of the ranges reserved by the GC. */
+	std::set<void*> _gcReservations;
+	/** Guards _gcReservations, the CLR allocates pages on many threads. */
+	SRWLOCK _gcReservationsLock;
+	/** 
+	 * Held while committed pages are measured, changed, and measured again, otherwise two threads
+	 * committing the same pages at the same time would both report them.
+	 */
+	SRWLOCK _commitLock;
+};
+
+} // namespace Klawr
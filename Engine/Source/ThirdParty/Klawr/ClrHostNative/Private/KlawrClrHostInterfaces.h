@@ -22,6 +22,10 @@ namespace Klawr
 		using ObjectUtilsProxy = Klawr_ClrHost_Managed::ObjectUtilsProxy;
 		using LogUtilsProxy = Klawr_ClrHost_Managed::LogUtilsProxy;
 		using ArrayUtilsProxy = Klawr_ClrHost_Managed::ArrayUtilsProxy;
+		using NameUtilsProxy = Klawr_ClrHost_Managed::NameUtilsProxy;
+		using ScriptComponentUtilsProxy = Klawr_ClrHost_Managed::ScriptComponentUtilsProxy;
+		using ProfilerUtilsProxy = Klawr_ClrHost_Managed::ProfilerUtilsProxy;
+		using TaskUtilsProxy = Klawr_ClrHost_Managed::TaskUtilsProxy;
 
 		using ScriptComponentProxy = Klawr_ClrHost_Managed::ScriptComponentProxy;
 		using ScriptObjectInstanceInfo = Klawr_ClrHost_Managed::ScriptObjectInstanceInfo;
@@ -97,6 +97,8 @@ struct ScriptComponentProxy
 	typedef void (*OnUnregisterAction)();
 	typedef void (*InitializeComponentAction)();
 	typedef void (*TickComponentAction)(float);
+	typedef int32 (*SelectTickLodFunc)(float, unsigned char, int32);
+	typedef void (*FlushProfilerScopesAction)();
 
 	/** Unique ID of the managed UKlawrScriptComponent instance this proxy represents. */
 	__int64 InstanceID;
@@ -112,6 +114,149 @@ struct ScriptComponentProxy
 	InitializeComponentAction InitializeComponent;
 	/** Bound to UKlawrScriptComponent.TickComponent() (may be null). */
 	TickComponentAction TickComponent;
+	/** 
+	 * Non-zero if the managed type is marked with ConcurrentTickAttribute, in which case the 
+	 * component should be ticked via IClrHost::GetTickScriptComponentsAction() rather than 
+	 * TickComponent.
+	 */
+	int32 bCanTickConcurrently;
+	/** Seconds between ticks specified by the managed TickSettingsAttribute (zero for every frame). */
+	float TickInterval;
+	/** One of the Klawr.ClrHost.Managed.ScriptTickGroup values. */
+	int32 TickGroup;
+	/** Non-zero if components with a tick interval should be spread across frames. */
+	int32 bStaggerTicks;
+	/** Non-zero if the managed type is marked with TickLodAttribute. */
+	int32 bUseTickLod;
+	/** View distance up to which the component ticks at full rate. */
+	float TickLodNearDistance;
+	/** View distance up to which the component ticks at the reduced rate. */
+	float TickLodFarDistance;
+	/** Seconds between ticks at the reduced rate. */
+	float TickLodReducedInterval;
+	/** Seconds between ticks at the minimal rate (beyond the far distance). */
+	float TickLodMinimalInterval;
+	/** Non-zero if ticking should be suspended while the owner isn't rendered. */
+	int32 bSuspendTickWhenNotRendered;
+	/** 
+	 * Bound to UKlawrScriptComponent.SelectTickLod() (may be null), this is never called directly,
+	 * it's called via IClrHost::GetUpdateTickLodsAction() instead.
+	 */
+	SelectTickLodFunc SelectTickLod;
+	/** 
+	 * Emits any profiling scopes managed code recorded on the calling thread (never null), should 
+	 * be called after TickComponent while the engine is collecting stats.
+	 */
+	FlushProfilerScopesAction FlushProfilerScopes;
+};
+
+/** 
+ * Calls TickComponent() on a batch of script components (identified by instance ID) with the 
+ * corresponding delta times, batches of concurrently tickable script components can be ticked on
+ * multiple threads at once.
+ */
+typedef void (*TickScriptComponentsAction)(
+	const __int64* instanceIDs, const float* deltaTimes, int32 count
+);
+
+/**
+ * Calls SelectTickLod() on a batch of script components (identified by instance ID), passing in
+ * the view distance, whether the owner was recently rendered, and the default tick LOD computed
+ * natively for each component. The default tick LODs are overwritten with the selected ones.
+ */
+typedef void (*UpdateTickLodsAction)(
+	const __int64* instanceIDs, const float* viewDistances, const unsigned char* recentlyRendered,
+	int32* tickLods, int32 count
+);
+
+/** 
+ * Returns the total number of bytes allocated by managed code in an engine app domain since 
+ * allocation monitoring was enabled, the count is only updated when a thread runs out of its
+ * allocation context (roughly every 8 KB), so it's too coarse to measure individual calls.
+ */
+typedef int64 (*GetAllocatedBytesFunc)();
+
+/** Kinds of memory the CLR allocates through the host. */
+enum class EClrMemoryCategory : int32
+{
+	/** Small blocks the CLR allocates for its own data structures. */
+	Heap,
+	/** Small blocks of executable memory (stubs, thunks). */
+	ExecutableHeap,
+	/** Pages the GC commits for the managed heap. */
+	GCHeap,
+	/** Other pages the CLR reserves and commits itself, mostly loader heaps (type data). */
+	LoaderHeap,
+	/** Executable pages the CLR commits itself, mostly JIT compiled code. */
+	ExecutableVirtualMemory,
+
+	Count
+};
+
+/**
+ * @brief Functions the CLR host uses to allocate memory on behalf of the CLR.
+ *
+ * Non-executable heap allocations are routed through Malloc and Free. Executable memory and
+ * whole pages can't come from a general purpose allocator, so those are still allocated 
+ * by the host directly. OnMemoryChanged is called for all allocations so they can be tracked.
+ */
+struct ClrMemoryHooks
+{
+	/** Allocate a block of memory that's aligned to at least 16 bytes. */
+	void* (*Malloc)(size_t size);
+	/** Free a block of memory previously allocated with Malloc. */
+	void (*Free)(void* ptr);
+	/** Called (on any thread) whenever the CLR allocates or frees memory in some category. */
+	void (*OnMemoryChanged)(EClrMemoryCategory category, int64 delta);
+};
+
+/** Flavors of the CLR garbage collector, the flavor can only be chosen at startup. */
+enum class EClrGCFlavor : int32
+{
+	/** Workstation GC, collections block all managed threads until they complete. */
+	Workstation,
+	/** Workstation GC that performs full collections on a background thread (the CLR default). */
+	WorkstationConcurrent,
+	/** Server GC, uses one GC heap and thread per core. */
+	Server,
+	/** Server GC that performs full collections on background threads. */
+	ServerConcurrent,
+};
+
+/** 
+ * @brief GC latency modes, these match the values of System.Runtime.GCLatencyMode.
+ */
+enum class EClrGCLatencyMode : int32
+{
+	/** Disables concurrent collections, most throughput but longest pauses. */
+	Batch = 0,
+	/** Concurrent collections enabled (the default). */
+	Interactive = 1,
+	/** Avoids full collections unless memory is low, only meant for short periods of time. */
+	LowLatency = 2,
+	/** Avoids blocking full collections for as long as possible. */
+	SustainedLowLatency = 3,
+};
+
+/** Options that are applied when the CLR is started. */
+struct ClrStartupOptions
+{
+	typedef void (*GCPauseAction)(int32 generation, double pauseSeconds);
+
+	/** Flavor of garbage collector the CLR should use. */
+	EClrGCFlavor GCFlavor;
+	/** 
+	 * Functions the CLR should use to allocate memory, if null the CLR will allocate memory 
+	 * directly from the OS.
+	 */
+	const ClrMemoryHooks* MemoryHooks;
+	/** 
+	 * Called (on the thread that triggered the collection) after every garbage collection with 
+	 * the collected generation and the length of time managed threads were suspended for, 
+	 * may be null. The runtime is still suspended at that point, so the callback must not block
+	 * (or log).
+	 */
+	GCPauseAction OnGCPause;
 };
 
 /** This public interface can be used to pass native wrapper functions to the CLR host. */
@@ -126,10 +271,12 @@ public:
 	 *        the application executable is located).
 	 * @param gameScriptsAssemblyName The name of the assembly containing game scripts, it will be
 	 *        automatically loaded into each engine app domain.
+	 * @param options Options to start the CLR with.
 	 * @return true if the CLR was started up successfully, false otherwise
 	 */
 	virtual bool Startup(
-		const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName
+		const TCHAR* engineAppDomainAppBase, const TCHAR* gameScriptsAssemblyName,
+		const ClrStartupOptions& options
 	) = 0;
 
 	/**
@@ -186,6 +333,29 @@ public:
 
 	virtual void DestroyScriptComponent(int appDomainID, __int64 instanceID) = 0;
 
+	/**
+	 * @brief Get the function that ticks batches of script components in an engine app domain.
+	 * @return The function, or null if the app domain doesn't exist.
+	 */
+	virtual TickScriptComponentsAction GetTickScriptComponentsAction(int appDomainID) = 0;
+
+	/**
+	 * @brief Get the function that selects the tick LODs of batches of script components in an
+	 *        engine app domain.
+	 * @return The function, or null if the app domain doesn't exist.
+	 */
+	virtual UpdateTickLodsAction GetUpdateTickLodsAction(int appDomainID) = 0;
+
+	/**
+	 * @brief Get the function that returns the number of bytes allocated by managed code in an
+	 *        engine app domain.
+	 *
+	 * The first call enables app domain resource monitoring for the whole process, which can't be
+	 * disabled again, so this should only be called when the allocation count is actually needed.
+	 * @return The function, or null if the app domain doesn't exist.
+	 */
+	virtual GetAllocatedBytesFunc GetAllocatedBytesFunction(int appDomainID) = 0;
+
 	/**
 	 * @brief Get the fully qualified names (including namespace) of all currently loaded managed 
 	 *        types derived from UKlawrScriptComponent.
@@ -193,6 +363,89 @@ public:
 	 */
 	virtual void GetScriptComponentTypes(int appDomainID, std::vector<tstring>& types) const = 0;
 
+	/**
+	 * @brief Write out the names of all the wrapper types and members referenced by the game 
+	 *        scripts assembly loaded in an engine app domain, one per line.
+	 *
+	 * The code generator can use the resulting file to trim the wrappers of a packaged game down 
+	 * to what the game scripts actually use.
+	 * @param outputFilename Name of the file to write.
+	 * @return true if the file was written, false otherwise
+	 */
+	virtual bool WriteWrapperUsage(int appDomainID, const TCHAR* outputFilename) const = 0;
+
+	/**
+	 * @brief Print any log messages queued by managed code in all engine app domains.
+	 *
+	 * Managed code doesn't log messages immediately, instead the messages are queued and printed
+	 * in batches, this should be called at least once per frame to keep the queues drained.
+	 */
+	virtual void FlushLogs() = 0;
+
+	/**
+	 * @brief Run the continuations of async managed methods that are due this frame in all 
+	 *        engine app domains.
+	 *
+	 * This must be called on the game thread once per frame.
+	 * @param deltaTime Number of seconds since the previous frame.
+	 */
+	virtual void RunFrame(float deltaTime) = 0;
+
+	/**
+	 * @brief Run work items queued by managed code in all engine app domains until the budget 
+	 *        runs out, the budget is shared by all the app domains.
+	 *
+	 * This must be called on the game thread once per frame.
+	 * @param budgetSeconds Number of seconds the work items can run for.
+	 * @return Number of work items left in the queues.
+	 */
+	virtual int32 RunWorkQueues(double budgetSeconds) = 0;
+
+	/** @brief Log the statistics gathered by the work queues in all engine app domains. */
+	virtual void LogWorkQueueStats() = 0;
+
+	/**
+	 * @brief Emit any profiling scopes managed code recorded on the game thread in all engine
+	 *        app domains.
+	 *
+	 * Managed code only records profiling scopes while the engine is collecting stats, this is 
+	 * how it finds out whether the engine is, so this must be called on the game thread once per
+	 * frame.
+	 */
+	virtual void FlushProfilerScopes() = 0;
+
+	/** 
+	 * @brief Change the GC latency mode, this affects all app domains.
+	 * @return true if the latency mode was changed, false otherwise
+	 */
+	virtual bool SetGCLatencyMode(EClrGCLatencyMode mode) = 0;
+
+	/**
+	 * @brief Collect garbage in all app domains.
+	 * @param generation The oldest generation to collect, -1 to collect all generations.
+	 * @param bBlocking true if the collection should complete before this method returns, 
+	 *        false to let the GC perform a background collection if it can.
+	 */
+	virtual void CollectGarbage(int32 generation, bool bBlocking) = 0;
+
+	/**
+	 * @brief Attempt to prevent garbage collections until EndNoGCRegion() is called.
+	 * @param totalSize Number of bytes that can be allocated before a collection is forced.
+	 * @return true if the no GC region was entered, false otherwise
+	 */
+	virtual bool TryStartNoGCRegion(int64 totalSize) = 0;
+
+	/** @brief Allow garbage collections again after a successful call to TryStartNoGCRegion(). */
+	virtual void EndNoGCRegion() = 0;
+
+	/**
+	 * @brief Let the CLR know the engine is running low on memory, the GC will then collect 
+	 *        more aggressively until memory is available again.
+	 *
+	 * Only has an effect if memory hooks were passed to Startup().
+	 */
+	virtual void NotifyLowMemory() = 0;
+
 public:
 	/** Get the singleton instance. */
 	static IClrHost* Get();
@@ -24,6 +24,7 @@
 #pragma once
 
 struct FScriptName;
+struct FVector;
 
 namespace Klawr {
 
@@ -64,7 +65,17 @@ struct ObjectUtilsProxy
  */
 struct LogUtilsProxy
 {
+	/** A message in a batch of messages queued by managed code. */
+	struct LogRecord
+	{
+		/** One of the ELogVerbosity values. */
+		int32 Verbosity;
+		/** Number of characters in the message (excluding the null terminator). */
+		int32 Length;
+	};
+
 	typedef void (*LogAction)(const TCHAR* text);
+	typedef void (*LogBatchAction)(const LogRecord* records, int32 numRecords, const TCHAR* text);
 
 	/** Print an error to the UE4 console and log file, then crash (even if logging is disabled). */
 	LogAction LogFatalError;
@@ -80,11 +91,57 @@ struct LogUtilsProxy
 	LogAction LogVerbose;
 	/** Print a verbose message to a log file (if VeryVerbose logging is enabled). */
 	LogAction LogVeryVerbose;
+	/** 
+	 * Print a batch of messages, text contains the null-terminated message of each record, 
+	 * one after another in the same order as the records.
+	 */
+	LogBatchAction LogBatch;
+	/** 
+	 * Points to the current verbosity (one of the ELogVerbosity values) of the log category 
+	 * used by the functions above, managed code reads it to skip messages that would be 
+	 * discarded anyway without calling into native code.
+	 */
+	const volatile int32* Verbosity;
+};
+
+/** 
+ * @brief A length-prefixed UTF-16 string that is passed to managed code by value.
+ *
+ * Unlike strings returned via MakeStringCopyForCLR() the CLR doesn't take ownership of (and 
+ * doesn't free) the characters referenced by a StringRef, instead managed code builds a
+ * System.String straight from the pointer and length as soon as the native function returns.
+ * The characters must therefore remain valid until then, which is the case for strings owned
+ * by UObject properties and array elements, and strings copied to a per-thread return buffer.
+ *
+ * @note This struct has a managed counterpart by the same name defined in Klawr.ClrHost.Managed.
+ */
+struct StringRef
+{
+	/** Characters of the string, not necessarily null-terminated, may be null if Length is 0. */
+	const TCHAR* Chars;
+	/** Number of characters in the string (excluding any null-terminator). */
+	int32 Length;
 };
 
 // This class needs to be implemented by clients of the library.
 class FArrayHelper;
 
+/** 
+ * @brief Comparison applied to each array element by the ArrayUtilsProxy::Count* functions.
+ *
+ * @note This enum has a managed counterpart named ArrayComparison defined in 
+ *       Klawr.ClrHost.Managed, the two must be kept in sync.
+ */
+enum class EArrayComparison : int32
+{
+	Equal,
+	NotEqual,
+	Less,
+	LessOrEqual,
+	Greater,
+	GreaterOrEqual
+};
+
 /** 
  * @brief Contains pointers to native TArray manipulation functions.
  *
@@ -98,7 +155,7 @@ struct ArrayUtilsProxy
 {
 	int32 (*Num)(FArrayHelper* arrayHelper);
 	void* (*GetRawPtr)(FArrayHelper* arrayHelper, int32 index);
-	const TCHAR* (*GetString)(FArrayHelper* arrayHelper, int32 index);
+	StringRef (*GetString)(FArrayHelper* arrayHelper, int32 index);
 	FScriptName (*GetName)(FArrayHelper* arrayHelper, int32 index);
 	class UObject* (*GetObject)(FArrayHelper* arrayHelper, int32 index);
 	void (*SetUInt8At)(FArrayHelper* arrayHelper, int32 index, uint8 item);
@@ -120,15 +177,176 @@ struct ArrayUtilsProxy
 	int32 (*FindObject)(FArrayHelper* arrayHelper, class UObject* item);
 	void (*Insert)(FArrayHelper* arrayHelper, int32 index);
 	void (*RemoveAt)(FArrayHelper* arrayHelper, int32 index);
+	int32 (*AddDefaulted)(FArrayHelper* arrayHelper, int32 count);
+	void (*InsertDefaulted)(FArrayHelper* arrayHelper, int32 index, int32 count);
+	int32 (*AppendRaw)(FArrayHelper* arrayHelper, const void* items, int32 count);
+	void (*InsertRaw)(FArrayHelper* arrayHelper, int32 index, const void* items, int32 count);
+	void (*RemoveRange)(FArrayHelper* arrayHelper, int32 index, int32 count);
+	void (*Reserve)(FArrayHelper* arrayHelper, int32 capacity);
+	void (*SetFloatAt)(FArrayHelper* arrayHelper, int32 index, float item);
+	void (*SetVectorAt)(FArrayHelper* arrayHelper, int32 index, FVector item);
+	int32 (*FindFloat)(FArrayHelper* arrayHelper, float item);
+	int32 (*FindVector)(FArrayHelper* arrayHelper, FVector item);
+	int64 (*SumInt32)(FArrayHelper* arrayHelper);
+	float (*SumFloat)(FArrayHelper* arrayHelper);
+	FVector (*SumVector)(FArrayHelper* arrayHelper);
+	/** Return false if the array is empty, otherwise store the min/max elements and return true. */
+	uint8 (*MinMaxInt32)(FArrayHelper* arrayHelper, int32* outMin, int32* outMax);
+	uint8 (*MinMaxFloat)(FArrayHelper* arrayHelper, float* outMin, float* outMax);
+	/** Computes the component-wise bounds of all the vectors in the array. */
+	uint8 (*MinMaxVector)(FArrayHelper* arrayHelper, FVector* outMin, FVector* outMax);
+	void (*SortInt32)(FArrayHelper* arrayHelper);
+	void (*SortFloat)(FArrayHelper* arrayHelper);
+	int32 (*CountInt32)(FArrayHelper* arrayHelper, EArrayComparison comparison, int32 value);
+	int32 (*CountFloat)(FArrayHelper* arrayHelper, EArrayComparison comparison, float value);
+	/** Return the index of the element closest to the given point, or -1 if the array is empty. */
+	int32 (*FindNearestVector)(FArrayHelper* arrayHelper, FVector point);
+	/** 
+	 * Enable/disable a hashed index that speeds up FindString/FindName, only FString and FName
+	 * arrays can be indexed. Return true if the index is enabled.
+	 */
+	uint8 (*SetLookupIndexEnabled)(FArrayHelper* arrayHelper, uint8 bEnabled);
+	/** Must be called after native code overwrites elements of an indexed array in place. */
+	void (*InvalidateLookupIndex)(FArrayHelper* arrayHelper);
 	void (*Destroy)(FArrayHelper* arrayHelper);
 };
 
+/** 
+ * @brief Contains pointers to native FName utility functions.
+ *
+ * These native functions will be called by managed code to populate a managed copy of the
+ * name table, so that names can be compared and converted to strings without calling back 
+ * into native code every time.
+ *
+ * @note This struct has a managed counterpart by the same name defined in Klawr.ClrHost.Managed,
+ *       the managed counterpart is also exposed to native code via COM under the 
+ *       Klawr::Managed namespace (but it's hidden from clients of this library).
+ */
+struct NameUtilsProxy
+{
+	/** 
+	 * Copy the plain strings (without the number suffix) of a range of name table entries to
+	 * a buffer, the strings are not null-terminated. The length of each entry is written to
+	 * outLengths, or -1 if there is no entry at that index. Return the number of entries copied,
+	 * which will be less than count if the buffer is full or the end of the name table is reached.
+	 */
+	int32 (*GetNameEntries)(
+		int32 firstIndex, int32 count, TCHAR* buffer, int32 bufferLength, int32* outLengths
+	);
+	/** Find or add the name matching the given string. */
+	FScriptName (*MakeName)(const TCHAR* name);
+};
+
+/** 
+ * @brief Contains pointers to native functions that control how script components tick.
+ *
+ * These native functions will be called by managed code, the component passed to each function
+ * must be a UKlawrScriptComponent.
+ *
+ * @note This struct has a managed counterpart by the same name defined in Klawr.ClrHost.Managed,
+ *       the managed counterpart is also exposed to native code via COM under the 
+ *       Klawr::Managed namespace (but it's hidden from clients of this library).
+ */
+struct ScriptComponentUtilsProxy
+{
+	typedef void (*SetTickIntervalAction)(class UObject* component, float interval, unsigned char bStagger);
+	typedef void (*SetTickGroupAction)(class UObject* component, int32 tickGroup);
+	typedef void (*SleepAction)(class UObject* component);
+	typedef void (*WakeAction)(class UObject* component);
+	typedef unsigned char (*IsSleepingFunc)(class UObject* component);
+	typedef const int32* (*GetTickLodAddressFunc)(class UObject* component);
+
+	/** 
+	 * Set the number of seconds between ticks (zero to tick every frame), if bStagger is 
+	 * non-zero the first tick is delayed by a fraction of the interval so that components 
+	 * sharing the same interval don't all tick in the same frame. 
+	 */
+	SetTickIntervalAction SetTickInterval;
+	/** Set the tick group, takes one of the Klawr.ClrHost.Managed.ScriptTickGroup values. */
+	SetTickGroupAction SetTickGroup;
+	/** Stop ticking the component until Wake() is called. */
+	SleepAction Sleep;
+	/** Resume ticking a component that was put to sleep. */
+	WakeAction Wake;
+	/** Check if the component was put to sleep. */
+	IsSleepingFunc IsSleeping;
+	/** 
+	 * Get the address the current tick LOD of the component is stored at, the address remains
+	 * valid for the lifetime of the component so managed code can read the tick LOD directly.
+	 */
+	GetTickLodAddressFunc GetTickLodAddress;
+};
+
+/** 
+ * @brief Contains pointers to native functions that forward profiling scopes recorded by managed
+ *        code to the engine stats system.
+ *
+ * @note This struct has a managed counterpart by the same name defined in Klawr.ClrHost.Managed,
+ *       the managed counterpart is also exposed to native code via COM under the 
+ *       Klawr::Managed namespace (but it's hidden from clients of this library).
+ */
+struct ProfilerUtilsProxy
+{
+	typedef int32 (*RegisterScopeFunc)(const TCHAR* name);
+	typedef unsigned char (*EmitScopesFunc)(
+		const int32* scopeEvents, const int64* timestamps, int32 count
+	);
+
+	/** 
+	 * Get the ID of the named profiling scope, the same name always maps to the same ID 
+	 * (regardless of the app domain it's registered from). May be called from any thread.
+	 */
+	RegisterScopeFunc RegisterScope;
+	/** 
+	 * Emit a batch of profiling scopes recorded on the calling thread, each event is either the
+	 * ID of a scope that begins, or the complement (~) of the ID of a scope that ends, the 
+	 * timestamps are in QueryPerformanceCounter() ticks. Scopes whose begin and end aren't both 
+	 * in the batch are discarded. Returns non-zero if the engine is collecting stats.
+	 */
+	EmitScopesFunc EmitScopes;
+};
+
+/** 
+ * @brief Contains pointers to native functions that run managed work items on engine worker 
+ *        threads, used by Klawr.ClrHost.Managed.Threading.EngineTaskScheduler.
+ *
+ * @note This struct has a managed counterpart by the same name defined in Klawr.ClrHost.Managed,
+ *       the managed counterpart is also exposed to native code via COM under the 
+ *       Klawr::Managed namespace (but it's hidden from clients of this library).
+ */
+struct TaskUtilsProxy
+{
+	typedef void (*WorkCallback)(void* context);
+	typedef unsigned char (*QueueWorkFunc)(WorkCallback callback, void* context);
+	typedef int32 (*GetNumWorkerThreadsFunc)();
+	typedef void (*CancelWorkFunc)(WorkCallback callback);
+
+	/** 
+	 * Queue a work item that will call the callback with the given context exactly once on an
+	 * engine worker thread. Returns zero if the work item couldn't be queued (e.g. because the
+	 * engine is shutting down), in which case the callback will never be called.
+	 */
+	QueueWorkFunc QueueWork;
+	/** Get the number of engine worker threads that may run work items concurrently. */
+	GetNumWorkerThreadsFunc GetNumWorkerThreads;
+	/** 
+	 * Stop queued work items that haven't started yet from calling the given callback, and wait
+	 * for the ones that already have to return. Must be called before the callback goes away
+	 * (i.e. when the app domain it belongs to is unloaded).
+	 */
+	CancelWorkFunc CancelWork;
+};
+
 /** Encapsulates native utility functions that are exported to managed code. */
 struct NativeUtils
 {
 	ObjectUtilsProxy Object;
 	LogUtilsProxy Log;
 	ArrayUtilsProxy Array;
+	NameUtilsProxy Name;
+	ScriptComponentUtilsProxy ScriptComponent;
+	ProfilerUtilsProxy Profiler;
+	TaskUtilsProxy Task;
 };
 
 } // namespace Klawr